@@ -10,11 +10,23 @@
 
 namespace Hazel 
 {
+	static ApplicationSpecification EditorSpecification()
+	{
+		ApplicationSpecification specification;
+		specification.Name = "Editor";
+		// the editor doesn't need more than the display rate, don't spin a core between frames
+		specification.TargetFrameRate = 60.0;
+		return specification;
+	}
+
 	class Hazelnut : public Application
 	{
 	public:
-		Hazelnut() : Application("Editor")
+		Hazelnut() : Application(EditorSpecification())
 		{
+			if (HasStartupFailed())
+				return;
+
 			// ExapleLayer helps us to see the effect imediately.
 			// PushLayer(new ExampleLayer());
 			//PushLayer(new EditorLayer(GetWindow()));
@@ -0,0 +1,63 @@
+#include "MemoryStatsPanel.h"
+
+#include <imgui.h>
+
+namespace Hazel {
+
+	void MemoryStatsPanel::OnImGuiRender()
+	{
+		if (!m_Open)
+			return;
+
+		ImGui::Begin("Memory", &m_Open);
+
+		if (!MemoryTracker::IsEnabled())
+		{
+			ImGui::TextUnformatted("Memory tracking is disabled in this build (HZ_MEMORY_TRACKING=0)");
+			ImGui::End();
+			return;
+		}
+
+		MemoryTagStats total = MemoryTracker::GetTotalStats();
+		ImGui::Text("Live: %.2f MB   Allocations last frame: %llu (%.1f KB)",
+			total.LiveBytes / (1024.0 * 1024.0), (unsigned long long)total.FrameAllocations, total.FrameBytes / 1024.0);
+
+		bool guard = MemoryTracker::IsSteadyStateGuardEnabled();
+		if (ImGui::Checkbox("Steady-state guard", &guard))
+		{
+			MemoryTracker::ResetGuardViolations();
+			MemoryTracker::SetSteadyStateGuard(guard);
+		}
+		uint64_t violations = MemoryTracker::GetGuardViolationCount();
+		if (violations > 0)
+		{
+			MemoryGuardViolation first = MemoryTracker::GetFirstGuardViolation();
+			ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.3f, 1.0f), "%llu tagged allocations, first: %llu bytes in %s (frame %llu)",
+				(unsigned long long)violations, (unsigned long long)first.Size, MemoryTracker::GetTagName(first.Tag),
+				(unsigned long long)first.FrameIndex);
+		}
+
+		ImGui::Separator();
+		ImGui::Columns(5, "MemoryTags");
+		ImGui::Text("Tag"); ImGui::NextColumn();
+		ImGui::Text("Live KB"); ImGui::NextColumn();
+		ImGui::Text("Peak KB"); ImGui::NextColumn();
+		ImGui::Text("Live allocs"); ImGui::NextColumn();
+		ImGui::Text("Last frame"); ImGui::NextColumn();
+		ImGui::Separator();
+
+		for (uint32_t i = 0; i < (uint32_t)MemoryTag::Count; i++)
+		{
+			MemoryTagStats stats = MemoryTracker::GetStats((MemoryTag)i);
+			ImGui::TextUnformatted(MemoryTracker::GetTagName((MemoryTag)i)); ImGui::NextColumn();
+			ImGui::Text("%.1f", stats.LiveBytes / 1024.0); ImGui::NextColumn();
+			ImGui::Text("%.1f", stats.PeakBytes / 1024.0); ImGui::NextColumn();
+			ImGui::Text("%llu", (unsigned long long)stats.LiveAllocations); ImGui::NextColumn();
+			ImGui::Text("%llu", (unsigned long long)stats.FrameAllocations); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+
+		ImGui::End();
+	}
+
+}
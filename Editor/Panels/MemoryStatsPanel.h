@@ -0,0 +1,22 @@
+#pragma once
+#include "Hazel.h"
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Memory/MemoryTracker.h"
+
+namespace Hazel {
+
+	// 按标签显示 MemoryTracker 的统计：当前/峰值字节、存活分配数、上一帧分配数
+	class MemoryStatsPanel
+	{
+	public:
+		MemoryStatsPanel() = default;
+
+		void OnImGuiRender();
+
+		inline bool& IsOpen() { return m_Open; }
+
+	private:
+		bool m_Open = true;
+	};
+
+}
@@ -0,0 +1,59 @@
+#include "PerfCountersOverlay.h"
+
+#include <imgui.h>
+
+namespace Hazel {
+
+	void PerfCountersOverlay::OnImGuiRender()
+	{
+		if (!m_Open)
+			return;
+
+		const float padding = 10.0f;
+		ImGuiIO& io = ImGui::GetIO();
+		ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - padding, padding), ImGuiCond_Always, ImVec2(1.0f, 0.0f));
+		ImGui::SetNextWindowBgAlpha(0.35f);
+		ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings
+			| ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav | ImGuiWindowFlags_NoMove;
+
+		if (!ImGui::Begin("Frame Counters", &m_Open, flags))
+		{
+			ImGui::End();
+			return;
+		}
+
+		PerfCounters::GetHistory(m_History);
+		if (m_History.empty())
+		{
+			ImGui::TextUnformatted("No frames yet");
+			ImGui::End();
+			return;
+		}
+
+		const PerfCounterFrame& last = m_History.back();
+		ImGui::Text("Frame %llu  CPU %.2f ms", (unsigned long long)last.FrameIndex, last.CpuFrameMs);
+		ImGui::Separator();
+		for (uint32_t i = 0; i < (uint32_t)PerfCounter::Count; i++)
+		{
+			PerfCounter counter = (PerfCounter)i;
+			if (counter == PerfCounter::ConstantBufferBytes)
+				ImGui::Text("%-24s %10.1f KB", PerfCounters::GetCounterName(counter), last.Get(counter) / 1024.0);
+			else
+				ImGui::Text("%-24s %10llu", PerfCounters::GetCounterName(counter), (unsigned long long)last.Get(counter));
+		}
+
+		m_CpuMs.resize(m_History.size());
+		m_DrawCalls.resize(m_History.size());
+		for (size_t f = 0; f < m_History.size(); f++)
+		{
+			m_CpuMs[f] = m_History[f].CpuFrameMs;
+			m_DrawCalls[f] = (float)m_History[f].Get(PerfCounter::DrawCalls);
+		}
+		ImGui::Separator();
+		ImGui::PlotLines("CPU ms", m_CpuMs.data(), (int)m_CpuMs.size(), 0, nullptr, 0.0f, FLT_MAX, ImVec2(220.0f, 40.0f));
+		ImGui::PlotLines("Draws", m_DrawCalls.data(), (int)m_DrawCalls.size(), 0, nullptr, 0.0f, FLT_MAX, ImVec2(220.0f, 40.0f));
+
+		ImGui::End();
+	}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "Hazel.h"
+#include "Runtime/Core/Core.h"
+#include "Runtime/Debug/PerfCounters.h"
+
+namespace Hazel {
+
+	// 视口角落的半透明 HUD：上一帧的热点计数 + 最近几百帧的 CPU 时间 / DrawCall 曲线
+	class PerfCountersOverlay
+	{
+	public:
+		PerfCountersOverlay() = default;
+
+		void OnImGuiRender();
+
+		inline bool& IsOpen() { return m_Open; }
+
+	private:
+		bool m_Open = true;
+		// 每帧复用，避免 HUD 自己在稳态下分配
+		std::vector<PerfCounterFrame> m_History;
+		std::vector<float> m_CpuMs;
+		std::vector<float> m_DrawCalls;
+	};
+
+}
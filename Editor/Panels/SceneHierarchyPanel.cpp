@@ -4,53 +4,325 @@
 #include <imgui_internal.h>
 #include "Runtime/Scene/Component.h"
 
+#include <algorithm>
+#include <cctype>
+
 namespace Hazel {
 
+	// 缓存的实体列表按实体下标排序
+	struct CompareItems
+	{
+		template<typename Item>
+		bool operator()(const Item& a, const Item& b) const { return entt::to_entity(a.Entity) < entt::to_entity(b.Entity); }
+	};
+
 	SceneHierarchyPanel::SceneHierarchyPanel(const Ref<Scene>& context)
 	{
 		SetContext(context);
 	}
 
+	SceneHierarchyPanel::~SceneHierarchyPanel()
+	{
+		WaitForFilter();
+		Disconnect();
+	}
+
 	void SceneHierarchyPanel::SetContext(const Ref<Scene>& context)
 	{
+		WaitForFilter();
+		Disconnect();
 		m_Context = context;
+		m_SelectionContext = {};
+		m_Expanded.clear();
+		m_FilterMatches.clear();
+		m_ShowFilterResult = false;
+		m_FilterDirty = m_SearchBuffer[0] != 0;
+		if (!m_Context)
+			return;
+
+		Connect();
+		RebuildItems();
 	}
 
-	void SceneHierarchyPanel::OnImGuiRender()
+	void SceneHierarchyPanel::Connect()
 	{
-		ImGui::ShowDemoWindow();
+		entt::registry& registry = m_Context->m_Registry;
+		registry.on_construct<TagComponent>().connect<&SceneHierarchyPanel::OnTagConstruct>(*this);
+		registry.on_destroy<TagComponent>().connect<&SceneHierarchyPanel::OnTagDestroy>(*this);
+		registry.on_update<TagComponent>().connect<&SceneHierarchyPanel::OnTagUpdate>(*this);
+	}
 
-		ImGui::Begin("Scene Hierarchy");
-		m_Context->m_Registry.each([&](auto entityID) 
+	void SceneHierarchyPanel::Disconnect()
+	{
+		if (!m_Context)
+			return;
+		entt::registry& registry = m_Context->m_Registry;
+		registry.on_construct<TagComponent>().disconnect<&SceneHierarchyPanel::OnTagConstruct>(*this);
+		registry.on_destroy<TagComponent>().disconnect<&SceneHierarchyPanel::OnTagDestroy>(*this);
+		registry.on_update<TagComponent>().disconnect<&SceneHierarchyPanel::OnTagUpdate>(*this);
+	}
+
+	// 信号里只记下来，等下一帧 OnImGuiRender 开头一起处理；on_construct 时 Tag 可能还没赋值
+	void SceneHierarchyPanel::OnTagConstruct(entt::registry& registry, entt::entity entity)
+	{
+		m_PendingAdded.push_back(entity);
+	}
+
+	void SceneHierarchyPanel::OnTagDestroy(entt::registry& registry, entt::entity entity)
+	{
+		m_PendingRemoved = true;
+	}
+
+	void SceneHierarchyPanel::OnTagUpdate(entt::registry& registry, entt::entity entity)
+	{
+		m_PendingRenamed.push_back(entity);
+	}
+
+	void SceneHierarchyPanel::RebuildItems()
+	{
+		HZ_PROFILE_FUNCTION();
+		WaitForFilter();
+		m_Items = CreateRef<std::vector<HierarchyItem>>();
+		auto view = m_Context->m_Registry.view<TagComponent>();
+		m_Items->reserve(view.size());
+		for (auto [entity, tag] : view.each())
+			m_Items->push_back({ entity, tag.Tag });
+		std::sort(m_Items->begin(), m_Items->end(), CompareItems());
+
+		m_PendingAdded.clear();
+		m_PendingRenamed.clear();
+		m_PendingRemoved = false;
+		m_HierarchyVersion = m_Context->GetTransformSystem().GetHierarchyVersion();
+		m_RestoreCount = m_Context->GetRestoreCount();
+		m_RowsDirty = true;
+		m_FilterDirty |= m_SearchBuffer[0] != 0;
+	}
+
+	std::vector<SceneHierarchyPanel::HierarchyItem>& SceneHierarchyPanel::GetMutableItems()
+	{
+		if (m_FilterJob && m_FilterJob->Items == m_Items)
+			m_Items = CreateRef<std::vector<HierarchyItem>>(*m_Items);
+		return *m_Items;
+	}
+
+	void SceneHierarchyPanel::ApplyPendingChanges()
+	{
+		HZ_PROFILE_FUNCTION();
+		// 恢复快照时原地覆盖的 TagComponent 池不触发信号，名字可能全变了，整体重建
+		if (m_Context->GetRestoreCount() != m_RestoreCount)
+		{
+			RebuildItems();
+			return;
+		}
+
+		entt::registry& registry = m_Context->m_Registry;
+		const uint32_t hierarchyVersion = m_Context->GetTransformSystem().GetHierarchyVersion();
+		if (hierarchyVersion != m_HierarchyVersion)
 		{
-			Entity entity{ entityID, m_Context.get() };
-			DrawEntityNode(entity);
+			m_HierarchyVersion = hierarchyVersion;
+			m_RowsDirty = true;
+		}
+		if (!m_PendingRemoved && m_PendingAdded.empty() && m_PendingRenamed.empty())
+			return;
 
-		});
+		std::vector<HierarchyItem>& items = GetMutableItems();
+		if (m_PendingRemoved)
+		{
+			// 销毁之后同一帧又加回来的实体此时还有 TagComponent，保留
+			items.erase(std::remove_if(items.begin(), items.end(), [&](const HierarchyItem& item)
+			{
+				return !registry.valid(item.Entity) || !registry.all_of<TagComponent>(item.Entity);
+			}), items.end());
+			if (m_SelectionContext && !registry.valid(m_SelectionContext.GetHandle()))
+				m_SelectionContext = {};
+		}
 
-		if (m_isMenuEnablede)
+		if (!m_PendingAdded.empty())
 		{
-			DrawLeftMouseMenu(m_Context);
+			// 新实体排好序后和原列表归并，不整体重排
+			const size_t oldCount = items.size();
+			for (entt::entity entity : m_PendingAdded)
+			{
+				if (registry.valid(entity) && registry.all_of<TagComponent>(entity))
+					items.push_back({ entity, registry.get<TagComponent>(entity).Tag });
+			}
+			std::sort(items.begin() + oldCount, items.end(), CompareItems());
+			std::inplace_merge(items.begin(), items.begin() + oldCount, items.end(), CompareItems());
+
+			// 同一个实体重新加过 TagComponent 时会出现两次，留后加的（名字是新的）
+			size_t count = 0;
+			for (size_t i = 0; i < items.size(); i++)
+			{
+				if (count > 0 && items[count - 1].Entity == items[i].Entity)
+					items[count - 1] = std::move(items[i]);
+				else if (count++ != i)
+					items[count - 1] = std::move(items[i]);
+			}
+			items.resize(count);
 		}
 
+		for (entt::entity entity : m_PendingRenamed)
+		{
+			HierarchyItem key{ entity };
+			auto it = std::lower_bound(items.begin(), items.end(), key, CompareItems());
+			if (it != items.end() && it->Entity == entity && registry.all_of<TagComponent>(entity))
+				it->Name = registry.get<TagComponent>(entity).Tag;
+		}
 
-		if (ImGui::IsMouseDown(0) && ImGui::IsWindowHovered()) 
+		m_PendingAdded.clear();
+		m_PendingRenamed.clear();
+		m_PendingRemoved = false;
+		m_RowsDirty = true;
+		m_FilterDirty |= m_SearchBuffer[0] != 0;
+	}
+
+	void SceneHierarchyPanel::UpdateFilter()
+	{
+		// 上一次搜索完成了就取结果；搜索框已经又改过的话结果先用着，下面马上开始新的一次
+		if (m_FilterJob && m_FilterJob->Counter.IsDone())
 		{
-			m_SelectionContext = {};
+			m_FilterMatches = std::move(m_FilterJob->Matches);
+			m_FilterJob.reset();
+			m_ShowFilterResult = m_SearchBuffer[0] != 0;
+			m_RowsDirty = true;
+		}
+
+		if (!m_FilterDirty || m_FilterJob)
+			return;
+		m_FilterDirty = false;
+
+		if (m_SearchBuffer[0] == 0)
+		{
+			m_FilterMatches.clear();
+			m_ShowFilterResult = false;
+			m_RowsDirty = true;
+			return;
+		}
+
+		m_FilterJob = CreateRef<FilterJob>();
+		m_FilterJob->Items = m_Items;
+		m_FilterJob->Pattern = m_SearchBuffer;
+		for (char& c : m_FilterJob->Pattern)
+			c = (char)std::tolower((unsigned char)c);
+
+		Ref<FilterJob> job = m_FilterJob;
+		JobSystem::Run([job]() { RunFilter(*job); }, &job->Counter);
+	}
+
+	void SceneHierarchyPanel::RunFilter(FilterJob& job)
+	{
+		HZ_PROFILE_FUNCTION();
+		auto equalNoCase = [](char a, char b) { return std::tolower((unsigned char)a) == b; };
+		for (const HierarchyItem& item : *job.Items)
+		{
+			if (std::search(item.Name.begin(), item.Name.end(), job.Pattern.begin(), job.Pattern.end(), equalNoCase) != item.Name.end())
+				job.Matches.push_back(item.Entity);
+		}
+	}
+
+	void SceneHierarchyPanel::WaitForFilter()
+	{
+		if (!m_FilterJob)
+			return;
+		JobSystem::Wait(m_FilterJob->Counter);
+		m_FilterJob.reset();
+		// 结果没用上，有搜索词的话下一帧重新搜
+		m_FilterDirty = m_SearchBuffer[0] != 0;
+	}
+
+	void SceneHierarchyPanel::RebuildRows()
+	{
+		HZ_PROFILE_FUNCTION();
+		m_RowsDirty = false;
+		m_Rows.clear();
+		entt::registry& registry = m_Context->m_Registry;
+
+		if (m_ShowFilterResult)
+		{
+			for (entt::entity entity : m_FilterMatches)
+			{
+				if (registry.valid(entity) && registry.all_of<TagComponent>(entity))
+					m_Rows.push_back({ entity, 0, false });
+			}
+			return;
+		}
+
+		// 从根节点开始深度优先展开，用显式栈，层级很深时也不会递归太多层
+		std::vector<std::pair<entt::entity, uint32_t>> stack;
+		for (const HierarchyItem& item : *m_Items)
+		{
+			const RelationshipComponent* relationship = registry.try_get<RelationshipComponent>(item.Entity);
+			if (relationship && relationship->Parent != entt::null)
+				continue;
+
+			stack.push_back({ item.Entity, 0 });
+			while (!stack.empty())
+			{
+				auto [entity, depth] = stack.back();
+				stack.pop_back();
+				if (!registry.all_of<TagComponent>(entity))
+					continue;
+
+				const RelationshipComponent* node = registry.try_get<RelationshipComponent>(entity);
+				const bool hasChildren = node && node->FirstChild != entt::null;
+				m_Rows.push_back({ entity, depth, hasChildren });
+				if (!hasChildren || !m_Expanded.contains(entt::to_integral(entity)))
+					continue;
+
+				// 倒着压栈，出栈时按兄弟顺序
+				for (entt::entity child = node->LastChild; child != entt::null;
+					child = registry.get<RelationshipComponent>(child).PrevSibling)
+				{
+					stack.push_back({ child, depth + 1 });
+				}
+			}
+		}
+	}
+
+	void SceneHierarchyPanel::OnImGuiRender()
+	{
+		if (!m_Context)
+			return;
+
+		ApplyPendingChanges();
+
+		ImGui::Begin("Scene Hierarchy");
+		if (ImGui::InputTextWithHint("##Search", "Search", m_SearchBuffer, sizeof(m_SearchBuffer)))
+			m_FilterDirty = true;
+		UpdateFilter();
+		if (m_RowsDirty)
+			RebuildRows();
+
+		// 只提交可见的行；展开 / 折叠改的是下一帧的行
+		ImGui::BeginChild("##Entities");
+		ImGuiListClipper clipper;
+		clipper.Begin((int)m_Rows.size());
+		while (clipper.Step())
+		{
+			for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+				DrawEntityRow(m_Rows[i]);
+		}
+		clipper.End();
 
+		if (ImGui::IsMouseDown(0) && ImGui::IsWindowHovered() && !ImGui::IsAnyItemHovered())
+		{
+			m_SelectionContext = {};
 		}
-		else if (ImGui::IsMouseClicked(1)) 
+		else if (ImGui::IsMouseClicked(1) && ImGui::IsWindowHovered())
 		{
 			m_isMenuEnablede = true;
 		}
+		ImGui::EndChild();
+
+		if (m_isMenuEnablede)
+		{
+			DrawLeftMouseMenu(m_Context);
+		}
 		//else if (ImGui::IsMouseClicked(0) && m_MenuItem == MenuItem::NULL_SELECTED)
 		//{
 		//	m_isMenuEnablede = false;
 		//}
 
-
-		
-
 		ImGui::End();
 
 
@@ -63,28 +335,46 @@ namespace Hazel {
 		ImGui::End();
 	}
 
-	void SceneHierarchyPanel::DrawEntityNode(Entity entity)
+	void SceneHierarchyPanel::DrawEntityRow(const HierarchyRow& row)
 	{
-		if (entity.HasComponent<TagComponent>())
+		entt::registry& registry = m_Context->m_Registry;
+		const std::string& tag = registry.get<TagComponent>(row.Entity).Tag;
+		const uint32_t key = entt::to_integral(row.Entity);
+		Entity entity{ row.Entity, m_Context.get() };
+
+		// 行是摊平的，不用 TreePush，按深度手动缩进
+		ImGuiTreeNodeFlags flags = ((m_SelectionContext == entity) ? ImGuiTreeNodeFlags_Selected : 0)
+			| ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+		if (!row.HasChildren)
+			flags |= ImGuiTreeNodeFlags_Leaf;
+		const bool expanded = row.HasChildren && m_Expanded.contains(key);
+
+		const float indent = row.Depth * ImGui::GetStyle().IndentSpacing;
+		if (indent > 0.0f)
+			ImGui::Indent(indent);
+		ImGui::SetNextItemOpen(expanded);
+		bool opened = ImGui::TreeNodeEx((void*)(uint64_t)key, flags, "%s", tag.c_str());
+		if (ImGui::IsItemClicked())
+		{
+			m_SelectionContext = entity;
+		}
+		if (indent > 0.0f)
+			ImGui::Unindent(indent);
+
+		if (row.HasChildren && opened != expanded)
 		{
-			auto& tc = entity.GetComponent<TagComponent>().Tag;
-			ImGuiTreeNodeFlags flags = ((m_SelectionContext == entity) ? ImGuiTreeNodeFlags_Selected : 0) | ImGuiTreeNodeFlags_OpenOnArrow;
-			bool opened = ImGui::TreeNodeEx((void*)(uint64_t)(uint32_t)entity, flags, tc.c_str());
-			if (ImGui::IsItemClicked())
-			{
-				m_SelectionContext = entity;
-			}
 			if (opened)
-			{
-				ImGui::Text("Some Child...");
-				ImGui::TreePop();
-			}
-		
+				m_Expanded.insert(key);
+			else
+				m_Expanded.erase(key);
+			m_RowsDirty = true;
 		}
 	}
 
-	static void DrawVec3Control(const std::string& label, glm::vec3& values, float resetValue = 0.0f, float columnWidth = 100.0f) 
+	// 返回本帧是否修改了 values
+	static bool DrawVec3Control(const std::string& label, glm::vec3& values, float resetValue = 0.0f, float columnWidth = 100.0f) 
 	{
+		bool changed = false;
 		ImGui::PushID(label.c_str());
 
 		ImGui::Columns(2);
@@ -104,11 +394,14 @@ namespace Hazel {
 
 
 		if (ImGui::Button("X",buttonSize))
+		{
 			values.x = resetValue;
+			changed = true;
+		}
 		ImGui::PopStyleColor(3);
 
 		ImGui::SameLine();
-		ImGui::DragFloat("##X", &values.x, 0.1f);
+		changed |= ImGui::DragFloat("##X", &values.x, 0.1f);
 		ImGui::PopItemWidth();
 		ImGui::SameLine();
 
@@ -116,11 +409,14 @@ namespace Hazel {
 		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4{ 0.3f, 0.8f, 0.3f, 1.0f });
 		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4{ 0.2f, 0.7f, 0.2f, 1.0f });
 		if (ImGui::Button("Y", buttonSize))
+		{
 			values.y = resetValue;
+			changed = true;
+		}
 		ImGui::PopStyleColor(3);
 
 		ImGui::SameLine();
-		ImGui::DragFloat("##Y", &values.y, 0.1f);
+		changed |= ImGui::DragFloat("##Y", &values.y, 0.1f);
 		ImGui::PopItemWidth();
 		ImGui::SameLine();
 
@@ -128,18 +424,21 @@ namespace Hazel {
 		ImGui::PushStyleColor(ImGuiCol_ButtonHovered, ImVec4{ 0.2f, 0.35f, 0.9f, 1.0f });
 		ImGui::PushStyleColor(ImGuiCol_ButtonActive, ImVec4{ 0.1f, 0.25f, 0.8f, 1.0f });
 		if (ImGui::Button("Z", buttonSize))
+		{
 			values.z = resetValue;
+			changed = true;
+		}
 		ImGui::PopStyleColor(3);
 
 		ImGui::SameLine();
-		ImGui::DragFloat("##Z", &values.z, 0.1f);
+		changed |= ImGui::DragFloat("##Z", &values.z, 0.1f);
 		ImGui::PopItemWidth();
 
 		ImGui::PopStyleVar();
 		ImGui::Columns(1);
 
 		ImGui::PopID();
-
+		return changed;
 	}
 
 	void SceneHierarchyPanel::DrawComponents(Entity entity)
@@ -153,6 +452,7 @@ namespace Hazel {
 			if (ImGui::InputText("Tag", buffer, sizeof(buffer)))
 			{
 				tag = std::string(buffer);
+				m_PendingRenamed.push_back(entity.GetHandle());
 			}
 		}
 
@@ -162,13 +462,20 @@ namespace Hazel {
 			{
 				auto& transform = entity.GetComponent<TransformComponent>();
 				//ImGui::DragFloat3("Position", glm::value_ptr(transform), 0.1f);
-				DrawVec3Control("Position", transform.Translation);
+				bool changed = DrawVec3Control("Position", transform.Translation);
 				// if we use radians
 				//glm::vec3 rotation = glm::degrees(transform.Rotation);
 				//DrawVec3Control("Rotation", rotation);
 				//transform.Rotation = glm::radians(rotation);
-				DrawVec3Control("Rotation", transform.Rotation);
-				DrawVec3Control("Scale", transform.Scale, 1.0f);
+				if (DrawVec3Control("Rotation", transform.Rotation))
+				{
+					// 编辑欧拉角后不再用四元数
+					transform.UseQuaternion = false;
+					changed = true;
+				}
+				changed |= DrawVec3Control("Scale", transform.Scale, 1.0f);
+				if (changed)
+					transform.MarkDirty();
 				ImGui::TreePop();
 			}
 		}
@@ -3,14 +3,32 @@
 #include "Runtime/Core/Core.h"
 #include "Runtime/Scene/Scene.h"
 #include "Runtime/Scene/Entity.h"
+#include "Runtime/Core/Containers/FlatHashMap.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+
+#include <string>
+#include <vector>
 
 namespace Hazel {
 
+	// 场景层级面板，实体多（10 万以上）时每帧只处理窗口里看得见的行：
+	// - 带 TagComponent 的实体按实体下标排好序缓存起来，监听 TagComponent 的构造 / 销毁 / 替换信号，
+	//   下一帧开头批量合并，不再每帧遍历 registry
+	// - 按展开状态摊平成行缓存，实体、层级结构（TransformSystem::GetHierarchyVersion）或展开状态变化时才重建；
+	//   绘制用 ImGuiListClipper，只提交可见的行
+	// - 搜索（不区分大小写的子串匹配）放到 JobSystem 上，任务只读一份名字列表的拷贝，
+	//   结果回来之前继续显示上一次的内容；搜索时显示匹配实体的平铺列表
+	// 名字列表只跟着信号、属性面板里的修改和 Scene::RestoreSnapshot（整体重建）更新，
+	// 别处直接改 Tag 字符串时搜索用的还是旧名字
 	class SceneHierarchyPanel
 	{
 	public:
 		SceneHierarchyPanel() = default;
 		SceneHierarchyPanel(const Ref<Scene>& context);
+		~SceneHierarchyPanel();
+		// 信号连接到了 this 上，不能拷贝
+		SceneHierarchyPanel(const SceneHierarchyPanel&) = delete;
+		SceneHierarchyPanel& operator=(const SceneHierarchyPanel&) = delete;
 
 		void SetContext(const Ref<Scene>& context);
 		void OnImGuiRender();
@@ -24,11 +42,66 @@ namespace Hazel {
 		};
 
 	private:
-		void DrawEntityNode(Entity entity);
+		struct HierarchyItem
+		{
+			entt::entity Entity;
+			std::string Name;
+		};
+
+		struct HierarchyRow
+		{
+			entt::entity Entity;
+			uint32_t Depth;
+			bool HasChildren;
+		};
+
+		// 一次搜索的输入和输出，任务线程只访问这里的数据
+		struct FilterJob
+		{
+			Ref<const std::vector<HierarchyItem>> Items;
+			std::string Pattern;
+			std::vector<entt::entity> Matches;
+			JobCounter Counter;
+		};
+
+		void Connect();
+		void Disconnect();
+		void OnTagConstruct(entt::registry& registry, entt::entity entity);
+		void OnTagDestroy(entt::registry& registry, entt::entity entity);
+		void OnTagUpdate(entt::registry& registry, entt::entity entity);
+
+		void RebuildItems();
+		void ApplyPendingChanges();
+		// 搜索任务还拿着当前列表时先拷贝一份再改
+		std::vector<HierarchyItem>& GetMutableItems();
+		void UpdateFilter();
+		static void RunFilter(FilterJob& job);
+		void WaitForFilter();
+		void RebuildRows();
+
+		void DrawEntityRow(const HierarchyRow& row);
 		void DrawComponents(Entity entity);
 		void DrawLeftMouseMenu(const Ref<Scene>& context);
 		Ref<Scene> m_Context;
 
+		// 按 entt::to_entity 排序
+		Ref<std::vector<HierarchyItem>> m_Items;
+		std::vector<entt::entity> m_PendingAdded;
+		std::vector<entt::entity> m_PendingRenamed;
+		bool m_PendingRemoved = false;
+
+		std::vector<HierarchyRow> m_Rows;
+		FlatHashSet<uint32_t> m_Expanded;
+		uint32_t m_HierarchyVersion = 0;
+		uint32_t m_RestoreCount = 0;
+		bool m_RowsDirty = true;
+
+		char m_SearchBuffer[256] = {};
+		Ref<FilterJob> m_FilterJob;
+		std::vector<entt::entity> m_FilterMatches;
+		bool m_FilterDirty = false;
+		bool m_ShowFilterResult = false;
+
 		Entity m_SelectionContext;
 		bool m_isMenuEnablede = false;
 		MenuItem m_MenuItem = NULL_SELECTED;
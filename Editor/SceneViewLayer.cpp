@@ -5,14 +5,18 @@
 #include "Platform/D3D12/D3D12Buffer.h"
 #include "Platform/D3D12/D3D12Shader.h"
 #include "Platform/D3D12/D3D12VertexArray.h"
+#include "Platform/D3D12/D3D12CommandList.h"
 #include "Runtime/Graphics/RHI/Core/VertexArray.h"
 #include "Runtime/Asset/Core/MaterialLibrary.h"
 #include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
 #include "Runtime/Graphics/RHI/Interface/ICommandListManager.h"
 #include "Runtime/Graphics/RHI/Core/CommandList.h"
 #include "Runtime/Graphics/RHI/Core/ScopedCommandList.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "Runtime/Graphics/RHI/Interface/IPipelineStateManager.h"
 #include "Runtime/Graphics/RHI/Interface/PipelineTypes.h"
+#include "Runtime/Graphics/Shader/ShaderLibrary.h"
+#include "Runtime/Core/Threading/InitGraph.h"
 
 
 namespace Hazel
@@ -29,181 +33,204 @@ namespace Hazel
     {
         my_texture_srv_gpu_handle.ptr = -1;
         //�������Ż���
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
 
-        HRESULT hr = S_OK;
-        assert(SUCCEEDED(hr));
-
 		IGfxViewManager& gfxViewManager = IGfxViewManager::Get();
 
-        D3D12_COMMAND_QUEUE_DESC queueDesc = {};
-        queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
-        queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
-        queueDesc.NodeMask = 1;
-
         mCommandQueue = renderAPIManager->GetCommandQueue();
         //hr = device->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&mCommandQueue));
         //assert(SUCCEEDED(hr));
 
+        std::string abpath = std::filesystem::current_path().u8string();
+        std::string cubeModelPath = abpath + std::string("/Resource/Resources/Models/Cube/Cube.obj");
+        mesh = Mesh::Create();
 
+        // 启动资源按依赖并行加载：
+        // 着色器编译、模型导入、根签名、PSO 在工作线程；
+        // 需要录制上传命令或访问视图缓存的步骤（RT、材质贴图、顶点缓冲、常量缓冲）留在主线程
+        InitGraph startup("SceneViewLayer");
 
-        TextureBufferSpecification spec = { 800, 600, TextureType::TEXTURE2D, TextureFormat::RGBA32, TextureRenderUsage::RENDER_TARGET, MultiSample::NONE};
+        startup.Add("RenderTargets", [this]()
+        {
+            TextureBufferSpecification spec = { 800, 600, TextureType::TEXTURE2D, TextureFormat::RGBA32, TextureRenderUsage::RENDER_TARGET, MultiSample::NONE};
+            m_BackBuffer = TextureBuffer::Create(spec);
+            m_DepthBuffer = TextureBuffer::Create({ 800, 600, TextureType::TEXTURE2D, TextureFormat::DEPTH24STENCIL8, TextureRenderUsage::RENDER_TARGET, MultiSample::NONE });
+        }, {}, InitThread::Main);
 
-        m_BackBuffer = TextureBuffer::Create(spec);
-        m_DepthBuffer = TextureBuffer::Create({ 800, 600, TextureType::TEXTURE2D, TextureFormat::DEPTH24STENCIL8, TextureRenderUsage::RENDER_TARGET, MultiSample::NONE });
+        startup.Add("ColorShader", [this]()
+        {
+            m_ColorShader = ShaderLibrary::GetGlobal().LoadCached("Resource/shaders/color.hlsl");
+        });
 
-        m_ColorShader = Shader::Create("Resource/shaders/color.hlsl");
+        // TestMat 引用同一个 color.hlsl，等着色器进缓存后再加载，避免重复编译
+        startup.Add("TestMaterial", [this]()
+        {
+            MaterialLibrary& materialLibrary = MaterialLibrary::Get();
+            material = materialLibrary.LoadMaterial("Resource/Materials/TestMat.meta");
+            //auto resourceBinding = material->GetShader()->GetReflection()->ReflectResourceBindings();
+            //auto parameters = material->GetShader()->GetReflection()->ReflectRegisterBlocks();
+        }, { "ColorShader" }, InitThread::Main);
 
-		MaterialLibrary& materialLibrary = MaterialLibrary::Get();
-		material = materialLibrary.LoadMaterial("Resource/Materials/TestMat.meta");
-		//auto resourceBinding = material->GetShader()->GetReflection()->ReflectResourceBindings();
-		//auto parameters = material->GetShader()->GetReflection()->ReflectRegisterBlocks();
-        
+        startup.Add("CubeImport", [this, cubeModelPath]()
+        {
+            mesh->ImportMesh(cubeModelPath);
+        });
 
-        std::string abpath = std::filesystem::current_path().u8string();
-        std::string cubeModelPath = abpath + std::string("/Resource/Resources/Models/Cube/Cube.obj");
-        mesh = Mesh::Create();
-        mesh->LoadMesh(cubeModelPath);
+        startup.Add("CubeUpload", [this]()
+        {
+            mesh->UploadMesh();
+        }, { "CubeImport" }, InitThread::Main);
 
         // build root signature
-        
-        // Shader programs typically require resources as input (constant buffers,
-    // textures, samplers).  The root signature defines the resources the shader
-    // programs expect.  If we think of the shader programs as a function, and
-    // the input resources as function parameters, then the root signature can be
-    // thought of as defining the function signature.  
-
-    // Root parameter can be a table, root descriptor or root constants.
-        CD3DX12_ROOT_PARAMETER slotRootParameter[1];
-
-        // Create a single descriptor table of CBVs.
-        CD3DX12_DESCRIPTOR_RANGE cbvTable;
-        cbvTable.Init(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0);
-        slotRootParameter[0].InitAsDescriptorTable(1, &cbvTable);
-
-        // A root signature is an array of root parameters.
-        CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc(1, slotRootParameter, 0, nullptr,
-            D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
-
-        // create a root signature with a single slot which points to a descriptor range consisting of a single constant buffer
-        ComPtr<ID3DBlob> serializedRootSig = nullptr;
-        ComPtr<ID3DBlob> errorBlob = nullptr;
-        hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
-            serializedRootSig.GetAddressOf(), errorBlob.GetAddressOf());
-
-        if (errorBlob != nullptr)
+        startup.Add("RootSignature", [this, device]()
         {
-            ::OutputDebugStringA((char*)errorBlob->GetBufferPointer());
-        }
-        ThrowIfFailed(hr);
+            // Shader programs typically require resources as input (constant buffers,
+        // textures, samplers).  The root signature defines the resources the shader
+        // programs expect.  If we think of the shader programs as a function, and
+        // the input resources as function parameters, then the root signature can be
+        // thought of as defining the function signature.  
+
+        // Root parameter can be a table, root descriptor or root constants.
+            CD3DX12_ROOT_PARAMETER slotRootParameter[1];
+
+            // Create a single descriptor table of CBVs.
+            CD3DX12_DESCRIPTOR_RANGE cbvTable;
+            cbvTable.Init(D3D12_DESCRIPTOR_RANGE_TYPE_CBV, 1, 0);
+            slotRootParameter[0].InitAsDescriptorTable(1, &cbvTable);
+
+            // A root signature is an array of root parameters.
+            CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc(1, slotRootParameter, 0, nullptr,
+                D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
+
+            // create a root signature with a single slot which points to a descriptor range consisting of a single constant buffer
+            ComPtr<ID3DBlob> serializedRootSig = nullptr;
+            ComPtr<ID3DBlob> errorBlob = nullptr;
+            HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
+                serializedRootSig.GetAddressOf(), errorBlob.GetAddressOf());
+
+            if (errorBlob != nullptr)
+            {
+                ::OutputDebugStringA((char*)errorBlob->GetBufferPointer());
+            }
+            ThrowIfFailed(hr);
 
-        ThrowIfFailed(device->CreateRootSignature(
-            0,
-            serializedRootSig->GetBufferPointer(),
-            serializedRootSig->GetBufferSize(),
-            IID_PPV_ARGS(&mRootSignature)));
+            ThrowIfFailed(device->CreateRootSignature(
+                0,
+                serializedRootSig->GetBufferPointer(),
+                serializedRootSig->GetBufferSize(),
+                IID_PPV_ARGS(&mRootSignature)));
+        });
 
         // build pso
-
-        D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc;
-        ZeroMemory(&psoDesc, sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC));
+        startup.Add("PSO", [this, device]()
+        {
+            D3D12_GRAPHICS_PIPELINE_STATE_DESC psoDesc;
+            ZeroMemory(&psoDesc, sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC));
         
 
-        D3D12Shader* d3d12Shader = dynamic_cast<D3D12Shader*>(m_ColorShader.get());
-		mInputLayout = d3d12Shader->GetD3D12InputLayout();
-        mvsByteCode = d3d12Shader->GetVSByteCode();
-        mpsByteCode = d3d12Shader->GetPSByteCode();
-        psoDesc.InputLayout = { mInputLayout.data(), (UINT)mInputLayout.size()};
-        psoDesc.pRootSignature = mRootSignature.Get();
-        psoDesc.VS =
-        {
-            reinterpret_cast<BYTE*>(mvsByteCode->GetBufferPointer()),
-            mvsByteCode->GetBufferSize()
-        };
-        psoDesc.PS =
+            D3D12Shader* d3d12Shader = RHICast<D3D12Shader>(m_ColorShader);
+    		mInputLayout = d3d12Shader->GetD3D12InputLayout();
+            mvsByteCode = d3d12Shader->GetVSByteCode();
+            mpsByteCode = d3d12Shader->GetPSByteCode();
+            psoDesc.InputLayout = { mInputLayout.data(), (UINT)mInputLayout.size()};
+            psoDesc.pRootSignature = mRootSignature.Get();
+            psoDesc.VS =
+            {
+                reinterpret_cast<BYTE*>(mvsByteCode->GetBufferPointer()),
+                mvsByteCode->GetBufferSize()
+            };
+            psoDesc.PS =
+            {
+                reinterpret_cast<BYTE*>(mpsByteCode->GetBufferPointer()),
+                mpsByteCode->GetBufferSize()
+            };
+            psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
+            psoDesc.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
+            psoDesc.DepthStencilState = CD3DX12_DEPTH_STENCIL_DESC(D3D12_DEFAULT);
+            psoDesc.SampleMask = UINT_MAX;
+            psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
+            psoDesc.NumRenderTargets = 1;
+            psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
+            psoDesc.SampleDesc.Count = 1;
+            psoDesc.SampleDesc.Quality = 0;
+            psoDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
+            ThrowIfFailed(device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&mPSO)));
+        }, { "ColorShader", "RootSignature" });
+
+        startup.Add("Pipeline", [this]()
         {
-            reinterpret_cast<BYTE*>(mpsByteCode->GetBufferPointer()),
-            mpsByteCode->GetBufferSize()
-        };
-        psoDesc.RasterizerState = CD3DX12_RASTERIZER_DESC(D3D12_DEFAULT);
-        psoDesc.BlendState = CD3DX12_BLEND_DESC(D3D12_DEFAULT);
-        psoDesc.DepthStencilState = CD3DX12_DEPTH_STENCIL_DESC(D3D12_DEFAULT);
-        psoDesc.SampleMask = UINT_MAX;
-        psoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_TRIANGLE;
-        psoDesc.NumRenderTargets = 1;
-        psoDesc.RTVFormats[0] = DXGI_FORMAT_R8G8B8A8_UNORM;
-        psoDesc.SampleDesc.Count = 1;
-        psoDesc.SampleDesc.Quality = 0;
-        psoDesc.DSVFormat = DXGI_FORMAT_D24_UNORM_S8_UINT;
-        ThrowIfFailed(device->CreateGraphicsPipelineState(&psoDesc, IID_PPV_ARGS(&mPSO)));
-
-
-
-		auto& pipelineStateManager = IPipelineStateManager::Get();
-
-		GraphicsPipelineDesc desc = {};
-        desc.SetBlendState(BlendStateDesc::Opaque())
-            .SetDepthStencilState(DepthStencilStateDesc::Default())
-            .SetPrimitiveTopology(PrimitiveTopology::TriangleList)
-            .SetRasterizerState(RasterizerStateDesc::Default())
-            .SetShader(m_ColorShader);
-        auto pipelineState = pipelineStateManager.CreateGraphicsPipeline(desc);
+    		auto& pipelineStateManager = IPipelineStateManager::Get();
 
+    		GraphicsPipelineDesc desc = {};
+            desc.SetBlendState(BlendStateDesc::Opaque())
+                .SetDepthStencilState(DepthStencilStateDesc::Default())
+                .SetPrimitiveTopology(PrimitiveTopology::TriangleList)
+                .SetRasterizerState(RasterizerStateDesc::Default())
+                .SetShader(m_ColorShader);
+            auto pipelineState = pipelineStateManager.CreateGraphicsPipeline(desc);
+        }, { "ColorShader" }, InitThread::Main);
 
         // No need to execute command list here - initialization commands are immediate
         // mCommandQueue->ExecuteCommandLists(1, (ID3D12CommandList* const*)&rawCommandList);
         // renderAPIManager->FlushCommandQueue();
         //FlushCommandQueue();
 
-        mScreenViewport.TopLeftX = 0;
-        mScreenViewport.TopLeftY = 0;
-        mScreenViewport.Width = static_cast<float>(800);
-        mScreenViewport.Height = static_cast<float>(600);
-        mScreenViewport.MinDepth = 0.0f;
-        mScreenViewport.MaxDepth = 1.0f;
-
-        mScissorRect = { 0, 0, 800, 600 };
-      
-        // Convert Spherical to Cartesian coordinates.
-        float mTheta = 1.5f * XM_PI;
-        float mPhi = XM_PIDIV4;
-        float mRadius = 5;
-        float x = mRadius * sinf(mPhi) * cosf(mTheta);
-        float z = mRadius * sinf(mPhi) * sinf(mTheta);
-        float y = mRadius * cosf(mPhi);
-
-        // Build the view matrix.
-        XMVECTOR pos = XMVectorSet(x, y, z, 1.0f);
-        XMVECTOR target = XMVectorZero();
-        XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
-
-        XMMATRIX view = XMMatrixLookAtLH(pos, target, up);
-        XMStoreFloat4x4(&mView, view);
-
-        XMMATRIX P = XMMatrixPerspectiveFovLH(0.25f * MathHelper::Pi, (800.0f/600.0f), 1.0f, 1000.0f);
-        XMStoreFloat4x4(&mProj, P);
-
-        XMMATRIX world = XMLoadFloat4x4(&mWorld);
-        XMMATRIX proj = XMLoadFloat4x4(&mProj);
-        XMMATRIX worldViewProj = world * view * proj;
-        XMStoreFloat4x4(&mWorld, XMMatrixTranspose(worldViewProj));
-
-
-  //      // 直接使用mWorld中的数据，确保内存布局兼容
-        material->Set<glm::mat4>("gWorldViewProj", *reinterpret_cast<glm::mat4*>(&mWorld));
-        material->Set("baseColor", glm::vec4(1.0, 0.0, 0.0, 1.0));
-        material->SyncToRawData();
-        auto propertyBlock = material->GetPropertyBlock(0, 0);
-		std::vector<float> rawData;
-        if (propertyBlock != nullptr) 
+        startup.Add("ObjectConstants", [this, &gfxViewManager]()
         {
-            rawData = propertyBlock->RawData;
-        }
-        UINT32 size = rawData.size()* sizeof(float);
-        objectCB = ConstantBuffer::Create(size);
-        objectCB->SetData(rawData.data(), size);
-		gfxViewManager.CreateConstantBufferView(objectCB);
+            mScreenViewport.TopLeftX = 0;
+            mScreenViewport.TopLeftY = 0;
+            mScreenViewport.Width = static_cast<float>(800);
+            mScreenViewport.Height = static_cast<float>(600);
+            mScreenViewport.MinDepth = 0.0f;
+            mScreenViewport.MaxDepth = 1.0f;
+
+            mScissorRect = { 0, 0, 800, 600 };
+      
+            // Convert Spherical to Cartesian coordinates.
+            float mTheta = 1.5f * XM_PI;
+            float mPhi = XM_PIDIV4;
+            float mRadius = 5;
+            float x = mRadius * sinf(mPhi) * cosf(mTheta);
+            float z = mRadius * sinf(mPhi) * sinf(mTheta);
+            float y = mRadius * cosf(mPhi);
+
+            // Build the view matrix.
+            XMVECTOR pos = XMVectorSet(x, y, z, 1.0f);
+            XMVECTOR target = XMVectorZero();
+            XMVECTOR up = XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
+
+            XMMATRIX view = XMMatrixLookAtLH(pos, target, up);
+            XMStoreFloat4x4(&mView, view);
+
+            XMMATRIX P = XMMatrixPerspectiveFovLH(0.25f * MathHelper::Pi, (800.0f/600.0f), 1.0f, 1000.0f);
+            XMStoreFloat4x4(&mProj, P);
+
+            XMMATRIX world = XMLoadFloat4x4(&mWorld);
+            XMMATRIX proj = XMLoadFloat4x4(&mProj);
+            XMMATRIX worldViewProj = world * view * proj;
+            XMStoreFloat4x4(&mWorld, XMMatrixTranspose(worldViewProj));
+
+
+      //      // 直接使用mWorld中的数据，确保内存布局兼容
+            material->Set<glm::mat4>("gWorldViewProj", *reinterpret_cast<glm::mat4*>(&mWorld));
+            material->Set("baseColor", glm::vec4(1.0, 0.0, 0.0, 1.0));
+            material->SyncToRawData();
+            auto propertyBlock = material->GetPropertyBlock(0, 0);
+    		std::vector<float> rawData;
+            if (propertyBlock != nullptr) 
+            {
+                rawData = propertyBlock->RawData;
+            }
+            UINT32 size = rawData.size()* sizeof(float);
+            objectCB = ConstantBuffer::Create(size);
+            objectCB->SetData(rawData.data(), size);
+    		gfxViewManager.CreateConstantBufferView(objectCB);
+        }, { "TestMaterial" }, InitThread::Main);
+
+        if (!startup.Run())
+            HZ_ERROR("SceneViewLayer: startup failed, see the init report below");
+        startup.LogReport();
     }
 
     void SceneViewLayer::OnDetach()
@@ -213,7 +240,8 @@ namespace Hazel
 
     void SceneViewLayer::OnUpdate(Timestep ts)
     {
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        HZ_MEMORY_TAG(Editor);
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
 
         auto& manager = ICommandListManager::Get();
@@ -276,132 +304,20 @@ namespace Hazel
         auto d3dCbvHeap = static_cast<ID3D12DescriptorHeap*>(gfxViewManager.GetHeap(DescriptorHeapType::CbvSrvUav));
         ID3D12DescriptorHeap* descriptorHeaps[] = { d3dCbvHeap };
         m_CommandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
+        HZ_PERF_COUNTER_INC(DescriptorHeapSwitches);
 
         m_CommandList->SetGraphicsRootSignature(mRootSignature.Get());
 
-        D3D12VertexBuffer* positionBuffer = nullptr;
-        auto vertexBufferIter = mesh->meshData->GetVertexBuffers().find(VertexProperty::Position);
-        if (vertexBufferIter != mesh->meshData->GetVertexBuffers().end()) {
-            positionBuffer = dynamic_cast<D3D12VertexBuffer*>(vertexBufferIter->second.get());
-        }
-
-        D3D12VertexBuffer* normalBuffer = nullptr;
-        auto normalBufferIter = mesh->meshData->GetVertexBuffers().find(VertexProperty::Normal);
-        if (normalBufferIter != mesh->meshData->GetVertexBuffers().end()) {
-            normalBuffer = dynamic_cast<D3D12VertexBuffer*>(normalBufferIter->second.get());
-        }
-
-        D3D12VertexBuffer* tangentBuffer = nullptr;
-        auto tangentBufferIter = mesh->meshData->GetVertexBuffers().find(VertexProperty::Tangent);
-        if (tangentBufferIter != mesh->meshData->GetVertexBuffers().end()) {
-            tangentBuffer = dynamic_cast<D3D12VertexBuffer*>(tangentBufferIter->second.get());
-        }
-
-        D3D12VertexBuffer* texcoordBuffer = nullptr;
-        auto texcoordBufferIter = mesh->meshData->GetVertexBuffers().find(VertexProperty::TexCoord0);
-        if (texcoordBufferIter != mesh->meshData->GetVertexBuffers().end()) {
-            texcoordBuffer = dynamic_cast<D3D12VertexBuffer*>(texcoordBufferIter->second.get());
-        }
-
-        D3D12VertexBuffer* texcoord1Buffer = nullptr;
-        auto texcoord1BufferIter = mesh->meshData->GetVertexBuffers().find(VertexProperty::TexCoord1);
-        if (texcoord1BufferIter != mesh->meshData->GetVertexBuffers().end()) {
-            texcoord1Buffer = dynamic_cast<D3D12VertexBuffer*>(texcoord1BufferIter->second.get());
-        }
-
-        D3D12VertexBuffer* colorBuffer = nullptr;
-        auto colorBufferIter = mesh->meshData->GetVertexBuffers().find(VertexProperty::VertexColor);
-        if (colorBufferIter != mesh->meshData->GetVertexBuffers().end()) {
-            colorBuffer = dynamic_cast<D3D12VertexBuffer*>(colorBufferIter->second.get());
-        }
-
-
-
-
-
-        D3D12IndexBuffer* indexBuffer = dynamic_cast<D3D12IndexBuffer*>(mesh->meshData->GetIndexBuffer().get());
-        // Create vertex buffer views for each vertex property
-        D3D12_VERTEX_BUFFER_VIEW positionVBV;
-        if (positionBuffer) {
-            positionVBV.BufferLocation = positionBuffer->VertexBufferGPU->GetGPUVirtualAddress();
-            positionVBV.StrideInBytes = positionBuffer->GetStride();
-            positionVBV.SizeInBytes = positionBuffer->GetCount();
-        }
-
-        D3D12_VERTEX_BUFFER_VIEW normalVBV;
-        if (normalBuffer) {
-            normalVBV.BufferLocation = normalBuffer->VertexBufferGPU->GetGPUVirtualAddress();
-            normalVBV.StrideInBytes = normalBuffer->GetStride();
-            normalVBV.SizeInBytes = normalBuffer->GetCount();
-        }
-
-        D3D12_VERTEX_BUFFER_VIEW tangentVBV;
-        if (tangentBuffer) {
-            tangentVBV.BufferLocation = tangentBuffer->VertexBufferGPU->GetGPUVirtualAddress();
-            tangentVBV.StrideInBytes = tangentBuffer->GetStride();
-            tangentVBV.SizeInBytes = tangentBuffer->GetCount();
-        }
-
-        D3D12_VERTEX_BUFFER_VIEW texcoordVBV;
-        if (texcoordBuffer) {
-            texcoordVBV.BufferLocation = texcoordBuffer->VertexBufferGPU->GetGPUVirtualAddress();
-            texcoordVBV.StrideInBytes = texcoordBuffer->GetStride();
-            texcoordVBV.SizeInBytes = texcoordBuffer->GetCount();
-        }
-
-        D3D12_VERTEX_BUFFER_VIEW texcoord1VBV;
-        if (texcoord1Buffer) {
-            texcoord1VBV.BufferLocation = texcoord1Buffer->VertexBufferGPU->GetGPUVirtualAddress();
-            texcoord1VBV.StrideInBytes = texcoord1Buffer->GetStride();
-            texcoord1VBV.SizeInBytes = texcoord1Buffer->GetCount();
-        }
-
-        D3D12_VERTEX_BUFFER_VIEW colorVBV;
-        if (colorBuffer) {
-            colorVBV.BufferLocation = colorBuffer->VertexBufferGPU->GetGPUVirtualAddress();
-            colorVBV.StrideInBytes = colorBuffer->GetStride();
-            colorVBV.SizeInBytes = colorBuffer->GetCount();
-        }
-
-
-        D3D12_INDEX_BUFFER_VIEW ibv;
-        ibv.BufferLocation = indexBuffer->IndexBufferGPU->GetGPUVirtualAddress();
-        ibv.Format = indexBuffer->GetIndexFormat();
-        ibv.SizeInBytes = indexBuffer->GetIndexBufferSize();
-        // Create an array of vertex buffer views
-        D3D12_VERTEX_BUFFER_VIEW vertexBufferViews[6];
-        UINT numViews = 0;
-
-        if (positionBuffer) {
-            vertexBufferViews[numViews++] = positionVBV;
-        }
-        if (normalBuffer) {
-            vertexBufferViews[numViews++] = normalVBV;
-        }
-        if (tangentBuffer) {
-            vertexBufferViews[numViews++] = tangentVBV;
-        }
-        if (texcoordBuffer) {
-            vertexBufferViews[numViews++] = texcoordVBV;
-        }
-        if (texcoord1Buffer) {
-            vertexBufferViews[numViews++] = texcoord1VBV;
-        }
-        if (colorBuffer) {
-            vertexBufferViews[numViews++] = colorVBV;
-        }
-
-        // Set all vertex buffer views at once
-        m_CommandList->IASetVertexBuffers(0, numViews, vertexBufferViews);
-        m_CommandList->IASetIndexBuffer(&ibv);
-        m_CommandList->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        // Vertex/index buffer views are built by D3D12CommandList::SetVertexArray. In a static dispatch
+        // build RHICast is a static_cast and the calls below bind directly to the final D3D12 types.
+        D3D12CommandList* d3dCmdList = RHICast<D3D12CommandList>(m_cmdList);
+        D3D12IndexBuffer* indexBuffer = RHICast<D3D12IndexBuffer>(mesh->meshData->GetIndexBuffer());
+        d3dCmdList->SetVertexArray(mesh->meshData);
 
         auto Allocation = gfxViewManager.CreateConstantBufferView(objectCB);
         m_CommandList->SetGraphicsRootDescriptorTable(0, d3dCbvHeap->GetGPUDescriptorHandleForHeapStart());
 
-        m_CommandList->DrawInstanced(
-            indexBuffer->GetIndexBufferSize(),
-            1, 0, 0);
+        d3dCmdList->Draw(indexBuffer->GetIndexBufferSize(), 1, 0);
 
         cmdList->ChangeResourceState(m_BackBuffer, TextureRenderUsage::RENDER_TARGET, TextureRenderUsage::RENDER_TEXTURE);
 
@@ -422,6 +338,7 @@ namespace Hazel
 
     void SceneViewLayer::OnImGuiRender()
     {
+        HZ_MEMORY_TAG(Editor);
         static bool p_open = true;
         static bool opt_fullscreen = true;
         static bool opt_renderResult = true;
@@ -492,6 +409,8 @@ namespace Hazel
 
             if (ImGui::BeginMenu("Debug"))
             {
+                ImGui::MenuItem("Memory", NULL, &m_MemoryStatsPanel.IsOpen());
+                ImGui::MenuItem("Frame Counters", NULL, &m_PerfCountersOverlay.IsOpen());
                 //if (ImGui::MenuItem("ShowImguiDemoWindow") && ImGui::IsWindowHovered()) 
                 //{
                 //    ImGui::ShowDemoWindow();
@@ -505,6 +424,8 @@ namespace Hazel
         }
 
         //m_SceneHierarchyPanel.OnImGuiRender();
+        m_MemoryStatsPanel.OnImGuiRender();
+        m_PerfCountersOverlay.OnImGuiRender();
 
         ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
         ImGui::Begin("ViewPort");
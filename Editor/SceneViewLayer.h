@@ -5,6 +5,8 @@
 #include "glm/gtc/type_ptr.hpp"
 #include "glm/gtc/matrix_transform.hpp"
 #include "Panels/SceneHierarchyPanel.h"
+#include "Panels/MemoryStatsPanel.h"
+#include "Panels/PerfCountersOverlay.h"
 #include "Platform/D3D12/d3dx12.h"
 #include "Platform/D3D12/d3dUtil.h"
 #include "Platform/D3D12/D3D12RenderAPIManager.h"
@@ -65,6 +67,9 @@ namespace Hazel
 
 		Ref<ConstantBuffer> objectCB;
 		Ref<Mesh> mesh;
+
+		MemoryStatsPanel m_MemoryStatsPanel;
+		PerfCountersOverlay m_PerfCountersOverlay;
 	};
 
 
@@ -45,4 +45,5 @@
 #include "Runtime/Scene/Scene.h"
 #include "Runtime/Scene/Component.h"
 #include "Runtime/Scene/Entity.h"
+#include "Runtime/Scene/SceneSerializer.h"
 // -----------------------------------
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
 #include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "Runtime/Graphics/RHI/Interface/DescriptorTypes.h"
 
 
@@ -102,7 +103,7 @@ namespace Hazel {
 		//	g_pd3dSrvDescHeap->GetCPUDescriptorHandleForHeapStart(),
 		//	g_pd3dSrvDescHeap->GetGPUDescriptorHandleForHeapStart());
 		ImGui_ImplWin32_Init(Application::Get().GetWindow().GetNativeWindow());
-		renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+		renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
 		IGfxViewManager& gfxViewManager = IGfxViewManager::Get();
 		// 使用 ImGui 专用堆而不是共享的 CbvSrvUav 堆
 		ID3D12DescriptorHeap* imguiSrvHeap = static_cast<ID3D12DescriptorHeap*>(gfxViewManager.GetHeap(DescriptorHeapType::ImGuiSrvUav));
@@ -132,6 +133,7 @@ namespace Hazel {
 
 	void ImGuiLayer::Begin()
 	{
+		HZ_MEMORY_TAG(ImGui);
 #ifdef RENDER_API_OPENGL
 		ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplGlfw_NewFrame();
@@ -149,6 +151,7 @@ namespace Hazel {
 
 	void ImGuiLayer::End()
 	{
+		HZ_MEMORY_TAG(ImGui);
 #ifdef RENDER_API_OPENGL
 		ImGuiIO& io = ImGui::GetIO();
 		Application& app = Application::Get();
@@ -208,6 +211,7 @@ namespace Hazel {
 
 		ID3D12DescriptorHeap* descriptorHeaps[] = { imguiHeap };
 		mCommandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
+		HZ_PERF_COUNTER_INC(DescriptorHeapSwitches);
 		ImGui_ImplDX12_RenderDrawData(ImGui::GetDrawData(), mCommandList.Get());
 		// Indicate a state transition on the resource usage.
 		mCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(renderAPIManager->GetCurrentBackBuffer(),
@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "D3D12Buffer.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "Platform/D3D12/D3D12RenderAPIManager.h"
 #include "Runtime/Core/Application.h"
 #include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
@@ -16,7 +17,7 @@ namespace Hazel
 		elementSize = d3dUtil::CalcConstantBufferByteSize(elementSize);
         m_BufferSize = elementSize;
         // todo:: ����ط��϶���Ҫ�޸ģ� ������application������
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
         
         
@@ -62,7 +63,7 @@ namespace Hazel
     {
         m_BufferSize = size;
 		m_BufferStride = stride;
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12CommandQueue> commandQueue = renderAPIManager->GetCommandQueue();
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
         
@@ -121,7 +122,7 @@ namespace Hazel
 
     D3D12IndexBuffer::D3D12IndexBuffer(uint16_t* indices, uint32_t size)
     {
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12CommandQueue> commandQueue = renderAPIManager->GetCommandQueue();
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
 
@@ -16,7 +16,7 @@ namespace Hazel
 	};
 
 
-	class D3D12VertexBuffer : public VertexBuffer
+	class D3D12VertexBuffer final : public VertexBuffer
 	{
 	public:
 		D3D12VertexBuffer(float* vertices, uint32_t size, uint32_t stride);
@@ -40,7 +40,7 @@ namespace Hazel
 
 	};
 
-	class D3D12IndexBuffer : public IndexBuffer
+	class D3D12IndexBuffer final : public IndexBuffer
 	{
 	public:
 		D3D12IndexBuffer(uint16_t* indices, uint32_t size);
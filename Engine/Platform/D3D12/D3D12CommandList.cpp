@@ -1,7 +1,9 @@
 #include "hzpch.h"
 #include "D3D12CommandList.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "Platform/D3D12/D3D12RenderAPIManager.h"
 #include "Platform/D3D12/D3D12GraphicsPipeline.h"
+#include "Platform/D3D12/D3D12Buffer.h"
 #include "Hazel.h"
 #include "Platform/D3D12/d3dx12.h"
 #include "Platform/D3D12/d3dUtil.h"
@@ -24,6 +26,15 @@ namespace Hazel
 		}
 	}
 
+	D3D12CommandList::D3D12CommandList(const CommandListHandle& handle, CommandListType type)
+		: CommandList() {
+		m_type = type;
+		m_CommandAllocator = static_cast<ID3D12CommandAllocator*>(handle.commandAllocator);
+		m_CommandList = static_cast<ID3D12GraphicsCommandList*>(handle.commandList);
+		m_nativeHandle = handle;
+		UpdateNativeHandle();
+	}
+
 
 	D3D12CommandList::~D3D12CommandList()
 	{
@@ -82,6 +93,8 @@ namespace Hazel
 		// 提取D3D12 PSO并设置
 		ID3D12PipelineState* pso = ExtractD3D12PSO(pipeline);
 		if (pso) {
+			if (pipeline != m_currentPipeline)
+				HZ_PERF_COUNTER_INC(PipelineSwitches);
 			m_CommandList->SetPipelineState(pso);
 			m_currentPipeline = pipeline;
 			
@@ -186,6 +199,57 @@ namespace Hazel
 
 	}
 
+	void D3D12CommandList::SetVertexArray(const Ref<VertexArray>& vertexArray)
+	{
+		if (!m_CommandList || !vertexArray) {
+			HZ_CORE_ERROR("[D3D12CommandList] Cannot set vertex array: CommandList or VertexArray is null");
+			return;
+		}
+
+		// map按VertexProperty排序，slot顺序和输入布局一致
+		D3D12_VERTEX_BUFFER_VIEW vertexBufferViews[6];
+		UINT numViews = 0;
+		for (const auto& [property, vertexBuffer] : vertexArray->GetVertexBuffers()) {
+			if (!vertexBuffer || numViews >= _countof(vertexBufferViews)) {
+				continue;
+			}
+			auto* d3dBuffer = static_cast<D3D12VertexBuffer*>(vertexBuffer.get());
+			D3D12_VERTEX_BUFFER_VIEW& view = vertexBufferViews[numViews++];
+			view.BufferLocation = d3dBuffer->VertexBufferGPU->GetGPUVirtualAddress();
+			view.StrideInBytes = d3dBuffer->GetStride();
+			view.SizeInBytes = d3dBuffer->GetCount();
+		}
+		m_CommandList->IASetVertexBuffers(0, numViews, vertexBufferViews);
+
+		if (const Ref<IndexBuffer>& indexBuffer = vertexArray->GetIndexBuffer()) {
+			auto* d3dIndexBuffer = static_cast<D3D12IndexBuffer*>(indexBuffer.get());
+			D3D12_INDEX_BUFFER_VIEW ibv;
+			ibv.BufferLocation = d3dIndexBuffer->IndexBufferGPU->GetGPUVirtualAddress();
+			ibv.Format = d3dIndexBuffer->GetIndexFormat();
+			ibv.SizeInBytes = d3dIndexBuffer->GetIndexBufferSize();
+			m_CommandList->IASetIndexBuffer(&ibv);
+		}
+		m_CommandList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+		m_commandCount++;
+	}
+
+	void D3D12CommandList::DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t startIndex, int32_t baseVertex)
+	{
+		m_CommandList->DrawIndexedInstanced(indexCount, instanceCount, startIndex, baseVertex, 0);
+		HZ_PERF_COUNTER_INC(DrawCalls);
+		HZ_PERF_COUNTER_ADD(Instances, instanceCount);
+		m_commandCount++;
+	}
+
+	void D3D12CommandList::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex)
+	{
+		m_CommandList->DrawInstanced(vertexCount, instanceCount, startVertex, 0);
+		HZ_PERF_COUNTER_INC(DrawCalls);
+		HZ_PERF_COUNTER_ADD(Instances, instanceCount);
+		m_commandCount++;
+	}
+
 	//void D3D12CommandList::BindCbvHeap(const Ref<GfxDescHeap>& cbvHeap)
 	//{
 	//	auto d3dCbvHeap = cbvHeap->getHeap<Microsoft::WRL::ComPtr<ID3D12DescriptorHeap>>();
@@ -240,8 +304,7 @@ namespace Hazel
 	}
 
 	void D3D12CommandList::InitializeD3D12Resources() {
-		D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(
-			RenderAPIManager::getInstance()->GetManager().get());
+		D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
 		if (!renderAPIManager) {
 			HZ_CORE_ERROR("[D3D12CommandList] Failed to get D3D12RenderAPIManager");
 			return;
@@ -6,10 +6,12 @@
 
 namespace Hazel 
 {
-	class D3D12CommandList : public CommandList
+	class D3D12CommandList final : public CommandList
 	{
 	public:
 		D3D12CommandList(CommandListType type = CommandListType::Graphics);
+		// 直接接管管理器分配好的原生对象，不再创建新的D3D12对象
+		D3D12CommandList(const CommandListHandle& handle, CommandListType type);
 		virtual ~D3D12CommandList();
 		
 		// CommandList接口实现
@@ -22,6 +24,11 @@ namespace Hazel
 		                               const TextureRenderUsage& fromFormat, 
 		                               const TextureRenderUsage& toFormat) override;
 		
+		// 绘制操作
+		virtual void SetVertexArray(const Ref<VertexArray>& vertexArray) override;
+		virtual void DrawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t startIndex = 0, int32_t baseVertex = 0) override;
+		virtual void Draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t startVertex = 0) override;
+		
 		// 新增：渲染管线操作
 		virtual void SetPipelineState(Ref<IGraphicsPipeline> pipeline) override;
 		virtual Ref<IGraphicsPipeline> GetCurrentPipeline() const override;
@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "D3D12CommandListAllocator.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "D3D12RenderAPIManager.h"
 #include "Runtime/Graphics/RenderAPIManager.h"
 #include "Runtime/Core/Log/Log.h"
@@ -29,8 +30,7 @@ namespace Hazel {
 
     void D3D12CommandListAllocator::Initialize() {
         // 获取D3D12设备
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(
-            RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         HZ_CORE_ASSERT(renderAPIManager, "Failed to get D3D12RenderAPIManager");
         
         m_Device = renderAPIManager->GetD3DDevice();
@@ -2,6 +2,8 @@
 #include "D3D12CommandListManager.h"
 #include "D3D12CommandList.h"
 #include "Runtime/Core/Log/Log.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Core/Memory/Allocator/ObjectPool.h"
 #include <future>
 #include <chrono>
 #include "D3D12Utils.h"
@@ -68,6 +70,7 @@ namespace Hazel {
         }
 
         CommandListHandle handle = allocation.handle;
+        HZ_PERF_COUNTER_INC(CommandListsAcquired);
         
         // 记录活跃的CommandList
         {
@@ -196,14 +199,13 @@ namespace Hazel {
             return;
         }
 
-        // 简单的异步执行实现
-        // 实际项目中应该使用线程池和更复杂的同步机制
-        std::thread([commandList, callback]() {
+        // 交给任务系统执行，不再每次创建分离线程
+        JobSystem::Run([commandList, callback]() {
             commandList->Execute();
             if (callback) {
                 callback();
             }
-        }).detach();
+        });
     }
 
     void D3D12CommandListManager::WaitForCompletion(Ref<CommandList> commandList) {
@@ -235,21 +237,9 @@ namespace Hazel {
     }
 
     Ref<CommandList> D3D12CommandListManager::WrapHandle(const CommandListHandle& handle, CommandListType type) {
-        // 创建D3D12CommandList包装器
-        auto commandList = CreateRef<D3D12CommandList>(type);
-        
-        // 设置原生句柄
-        commandList->SetNativeHandle(handle);
-        
-        // 设置D3D12对象
-        auto d3d12CommandList = static_cast<D3D12CommandList*>(commandList.get());
-        auto d3dAllocator = static_cast<ID3D12CommandAllocator*>(handle.commandAllocator);
+        // 包装器和控制块都来自对象池，直接接管句柄里的D3D12对象
+        auto commandList = CreatePooledRef<D3D12CommandList>(handle, type);
         auto d3dCommandList = static_cast<ID3D12GraphicsCommandList*>(handle.commandList);
-        
-        d3d12CommandList->SetD3D12Objects(
-            Microsoft::WRL::ComPtr<ID3D12CommandAllocator>(d3dAllocator),
-            Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>(d3dCommandList)
-        );
 
         // 🔥 关键修复：确保CommandList处于Closed状态
         // 因为从分配器获取的CommandList应该是Closed状态的
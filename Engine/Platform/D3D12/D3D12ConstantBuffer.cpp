@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "D3D12ConstantBuffer.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "Platform/D3D12/D3D12RenderAPIManager.h"
 #include "Runtime/Core/Application.h"
 
@@ -14,7 +15,7 @@ namespace Hazel
         m_BufferSize = elementSize;
         
         // 获取D3D12设备
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
         
         // 创建上传缓冲区
@@ -43,6 +44,7 @@ namespace Hazel
         // 确保源数据指针和目标缓冲区都已正确映射
         if (srcData && mMappedData) {
             memcpy(mMappedData, srcData, length);
+            HZ_PERF_COUNTER_ADD(ConstantBufferBytes, length);
         }
         else {
             // 处理无效输入：无效指针
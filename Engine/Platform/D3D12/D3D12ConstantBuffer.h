@@ -4,7 +4,7 @@
 
 namespace Hazel 
 {
-	class D3D12ConstantBuffer : public ConstantBuffer
+	class D3D12ConstantBuffer final : public ConstantBuffer
 	{
 	public:
 		D3D12ConstantBuffer(uint32_t elementSize);
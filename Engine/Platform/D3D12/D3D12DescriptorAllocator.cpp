@@ -45,15 +45,9 @@ namespace Hazel {
             return DescriptorAllocation{};
         }
         
-        // 尝试从空闲块中分配 - 使用 lower_bound 找到第一个足够大的块
-        auto it = m_FreeBlocks.lower_bound(count);
-        if (it != m_FreeBlocks.end()) {
-            uint32_t freeBlockCount = it->first;
-            uint32_t freeBlockOffset = it->second;
-            
-            // 移除这个空闲块
-            m_FreeBlocks.erase(it);
-            
+        // 尝试从空闲块中分配 - 取第一个足够大的块，剩余部分自动放回
+        uint32_t freeBlockOffset = 0;
+        if (m_FreeBlocks.Allocate(count, freeBlockOffset)) {
             // 创建分配结果
             DescriptorAllocation allocation;
             allocation.baseHandle.heapIndex = 0; // 我们只有一个堆
@@ -64,13 +58,7 @@ namespace Hazel {
             allocation.heapIndex = 0;
             allocation.descriptorSize = m_DescriptorSize;
             
-            // 如果空闲块还有剩余，重新插入剩余部分
-            if (freeBlockCount > count) {
-                uint32_t remainingCount = freeBlockCount - count;
-                uint32_t remainingOffset = freeBlockOffset + count;
-                m_FreeBlocks.insert({remainingCount, remainingOffset});
-            }
-            
+            HZ_PERF_COUNTER_ADD(DescriptorsAllocated, count);
             return allocation;
         }
         
@@ -86,6 +74,7 @@ namespace Hazel {
             allocation.descriptorSize = m_DescriptorSize;
             
             m_CurrentOffset += count;
+            HZ_PERF_COUNTER_ADD(DescriptorsAllocated, count);
             return allocation;
         }
         
@@ -105,15 +94,15 @@ namespace Hazel {
         D3D12_CPU_DESCRIPTOR_HANDLE heapStart = m_DescriptorHeap->GetCPUDescriptorHandleForHeapStart();
         uint32_t offset = static_cast<uint32_t>((allocation.baseHandle.cpuHandle - heapStart.ptr) / m_DescriptorSize);
         
-        // 添加到空闲块 - multimap 会自动按 count 排序
-        m_FreeBlocks.insert({allocation.count, offset});
+        // 添加到空闲块 - 按 count 有序插入
+        m_FreeBlocks.Free(offset, allocation.count);
     }
 
     void D3D12DescriptorAllocator::Reset() {
         std::lock_guard<std::mutex> lock(m_AllocationMutex);
         
         // 清空空闲块映射
-        m_FreeBlocks.clear();
+        m_FreeBlocks.Clear();
         
         // 重置偏移量
         m_CurrentOffset = 0;
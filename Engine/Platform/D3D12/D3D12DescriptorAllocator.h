@@ -3,7 +3,7 @@
 #include "Runtime/Graphics/RHI/Interface/IDescritorAllocator.h"
 #include "Platform/D3D12/d3dx12.h"
 #include "Platform/D3D12/d3dUtil.h"
-#include <map>
+#include "Runtime/Graphics/RHI/Interface/DescriptorFreeList.h"
 #include <mutex>
 
 namespace Hazel {
@@ -35,9 +35,8 @@ namespace Hazel {
         uint32_t m_DescriptorSize;
         uint32_t m_CurrentOffset;
         
-        // 空闲块管理 - 使用 multimap 按 count 排序，支持相同大小的多个块
-        // key: count (块大小), value: offset (块偏移)
-        std::multimap<uint32_t, uint32_t> m_FreeBlocks;
+        // 空闲块管理 - 按 count 排序的连续数组，支持相同大小的多个块
+        DescriptorFreeList m_FreeBlocks;
         std::mutex m_AllocationMutex;
         
         // Helper functions
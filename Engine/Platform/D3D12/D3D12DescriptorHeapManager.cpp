@@ -2,6 +2,7 @@
 #include "D3D12DescriptorHeapManager.h"
 #include "Runtime/Graphics/Texture/TextureBuffer.h"
 #include "Runtime/Graphics/RHI/Core/Buffer.h"
+#include "Runtime/Core/Memory/Allocator/FrameArena.h"
 #include <string>
 
 namespace Hazel {
@@ -68,9 +69,9 @@ namespace Hazel {
         const DescriptorHandle* srcHandles,
         const DescriptorHandle& dstHandleStart)
     {
-        // 准备源句柄数组
-        std::vector<D3D12_CPU_DESCRIPTOR_HANDLE> srcCpuHandles(numDescriptors);
-        std::vector<UINT> srcRangeSizes(numDescriptors, 1);
+        // 准备源句柄数组（帧临时内存，不走堆）
+        FrameVector<D3D12_CPU_DESCRIPTOR_HANDLE> srcCpuHandles(numDescriptors);
+        FrameVector<UINT> srcRangeSizes(numDescriptors, 1);
         
         for (uint32_t i = 0; i < numDescriptors; ++i) {
             srcCpuHandles[i].ptr = srcHandles[i].cpuHandle;
@@ -104,16 +105,18 @@ namespace Hazel {
                 const TextureBuffer* texture = static_cast<const TextureBuffer*>(resourcePtr);
                 ID3D12Resource* d3dResource = static_cast<ID3D12Resource*>(texture->GetNativeResource());
                 
+#ifdef HZ_DEBUG
                 // 设置调试名称 - 包含CPU handle地址
                 wchar_t debugName[64];
                 swprintf_s(debugName, L"SRV_CPUHandle_%llX", destHandle.ptr);
                 d3dResource->SetName(debugName);
+#endif
                 
                 D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = ConvertToD3D12SRVDesc(viewDesc);
                 m_Device->CreateShaderResourceView(d3dResource, &srvDesc, destHandle);
                 
                 // 调试日志
-                HZ_CORE_INFO("Created SRV - CPU Handle: {0}, Resource: {1}", 
+                HZ_CORE_TRACE("Created SRV - CPU Handle: {0}, Resource: {1}", 
                     destHandle.ptr, reinterpret_cast<uintptr_t>(d3dResource));
                 break;
             }
@@ -122,15 +125,17 @@ namespace Hazel {
                 const TextureBuffer* texture = static_cast<const TextureBuffer*>(resourcePtr);
                 ID3D12Resource* d3dResource = static_cast<ID3D12Resource*>(texture->GetNativeResource());
                 
+#ifdef HZ_DEBUG
                 // 设置调试名称
                 wchar_t debugName[64];
                 swprintf_s(debugName, L"RTV_CPUHandle_%llX", destHandle.ptr);
                 d3dResource->SetName(debugName);
+#endif
                 
                 D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = ConvertToD3D12RTVDesc(viewDesc);
                 m_Device->CreateRenderTargetView(d3dResource, &rtvDesc, destHandle);
                 
-                HZ_CORE_INFO("Created RTV - CPU Handle: {0}, Resource: {1}", 
+                HZ_CORE_TRACE("Created RTV - CPU Handle: {0}, Resource: {1}", 
                     destHandle.ptr, reinterpret_cast<uintptr_t>(d3dResource));
                 break;
             }
@@ -139,15 +144,17 @@ namespace Hazel {
                 const TextureBuffer* texture = static_cast<const TextureBuffer*>(resourcePtr);
                 ID3D12Resource* d3dResource = static_cast<ID3D12Resource*>(texture->GetNativeResource());
                 
+#ifdef HZ_DEBUG
                 // 设置调试名称
                 wchar_t debugName[64];
                 swprintf_s(debugName, L"DSV_CPUHandle_%llX", destHandle.ptr);
                 d3dResource->SetName(debugName);
+#endif
                 
                 D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = ConvertToD3D12DSVDesc(viewDesc);
                 m_Device->CreateDepthStencilView(d3dResource, &dsvDesc, destHandle);
                 
-                HZ_CORE_INFO("Created DSV - CPU Handle: {0}, Resource: {1}", 
+                HZ_CORE_TRACE("Created DSV - CPU Handle: {0}, Resource: {1}", 
                     destHandle.ptr, reinterpret_cast<uintptr_t>(d3dResource));
                 break;
             }
@@ -156,16 +163,18 @@ namespace Hazel {
                 const ConstantBuffer* buffer = static_cast<const ConstantBuffer*>(resourcePtr);
                 ID3D12Resource* d3dResource = static_cast<ID3D12Resource*>(buffer->GetNativeResource());
                 
+#ifdef HZ_DEBUG
                 // 设置调试名称
                 wchar_t debugName[64];
                 swprintf_s(debugName, L"CBV_CPUHandle_%llX", destHandle.ptr);
                 d3dResource->SetName(debugName);
+#endif
                 
                 D3D12_CONSTANT_BUFFER_VIEW_DESC cbvDesc = ConvertToD3D12CBVDesc(viewDesc, d3dResource);
                 m_Device->CreateConstantBufferView(&cbvDesc, destHandle);
                 
                 // CBV特殊调试信息 - 显示GPU虚拟地址
-                HZ_CORE_INFO("Created CBV - CPU Handle: {0}, Resource: {1}, GPU VAddr: {2}, Size: {3}", 
+                HZ_CORE_TRACE("Created CBV - CPU Handle: {0}, Resource: {1}, GPU VAddr: {2}, Size: {3}", 
                     destHandle.ptr, reinterpret_cast<uintptr_t>(d3dResource), 
                     cbvDesc.BufferLocation, cbvDesc.SizeInBytes);
                 break;
@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "D3D12GfxViewManager.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "D3D12RenderAPIManager.h"
 #include "Runtime/Core/Application.h"
 #include "D3D12DescriptorHeapManager.h"
@@ -11,8 +12,7 @@ namespace Hazel {
 
     D3D12GfxViewManager::D3D12GfxViewManager() {
         // Get D3D12 device from render API manager
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(
-            RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         m_Device = renderAPIManager->GetD3DDevice();
     }
 
@@ -55,7 +55,7 @@ namespace Hazel {
         newView = m_HeapManager->CreateView(DescriptorType::RTV, texture.get());
 
         // 缓存新创建的视图
-        m_ViewCache[resourceId][DescriptorType::RTV] = newView;
+        m_ViewCache[resourceId].Set(DescriptorType::RTV, newView);
         
         return newView;
     }
@@ -74,7 +74,7 @@ namespace Hazel {
         DescriptorAllocation newView{}; // TODO: 实际创建逻辑
         newView = m_HeapManager->CreateView(DescriptorType::DSV, texture.get());
         // 缓存新创建的视图
-        m_ViewCache[resourceId][DescriptorType::DSV] = newView;
+        m_ViewCache[resourceId].Set(DescriptorType::DSV, newView);
         
         return newView;
     }
@@ -94,7 +94,7 @@ namespace Hazel {
 		newView = m_HeapManager->CreateView(DescriptorType::SRV, texture.get());
 
         // 缓存新创建的视图
-        m_ViewCache[resourceId][DescriptorType::SRV] = newView;
+        m_ViewCache[resourceId].Set(DescriptorType::SRV, newView);
         
         return newView;
     }
@@ -114,7 +114,7 @@ namespace Hazel {
         ViewDescription desc = ViewDescription::Buffer(buffer->GetBufferSize(), 1, 0);
         newView = m_HeapManager->CreateView(DescriptorType::CBV, buffer.get(), &desc);
         // 缓存新创建的视图
-        m_ViewCache[resourceId][DescriptorType::CBV] = newView;
+        m_ViewCache[resourceId].Set(DescriptorType::CBV, newView);
         
         return newView;
     }
@@ -168,10 +168,7 @@ namespace Hazel {
     DescriptorAllocation D3D12GfxViewManager::GetCachedView(const boost::uuids::uuid& resourceId, DescriptorType type) {
         auto resourceIt = m_ViewCache.find(resourceId);
         if (resourceIt != m_ViewCache.end()) {
-            auto typeIt = resourceIt->second.find(type);
-            if (typeIt != resourceIt->second.end()) {
-                return typeIt->second;
-            }
+            return resourceIt->second.Find(type);
         }
         return DescriptorAllocation{};
     }
@@ -4,6 +4,7 @@
 #include "Runtime/Graphics/RHI/Interface/DescriptorTypes.h"
 #include "Platform/D3D12/d3dx12.h"
 #include "Platform/D3D12/d3dUtil.h"
+#include "Runtime/Core/Containers/FlatHashMap.h"
 #include <unordered_map>
 #include <boost/functional/hash.hpp>
 
@@ -58,7 +59,8 @@ namespace Hazel {
         std::unique_ptr<IDescriptorHeapManager> m_HeapManager;
         
         // Cached views for resource reuse
-        std::unordered_map<boost::uuids::uuid, std::unordered_map<DescriptorType, DescriptorAllocation>, boost::hash<boost::uuids::uuid>> m_ViewCache;
+        // 开放寻址表 + 每个资源内联的视图列表，资源反复创建销毁时不按节点分配内存
+        FlatHashMap<boost::uuids::uuid, ResourceViews, boost::hash<boost::uuids::uuid>> m_ViewCache;
         
         // Frame allocators for temporary descriptors
         std::unordered_map<DescriptorHeapType, std::unique_ptr<PerFrameDescriptorAllocator>> m_FrameAllocators;
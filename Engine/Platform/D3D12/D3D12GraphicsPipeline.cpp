@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "D3D12GraphicsPipeline.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "D3D12Shader.h"
 #include "D3D12RenderAPIManager.h"
 #include "D3D12RootSignature.h"
@@ -14,8 +15,7 @@ namespace Hazel {
         HZ_CORE_ASSERT(desc.shader, "Shader cannot be null");
         
         // 获取D3D12设备
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(
-            RenderAPIManager::getInstance().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         m_Device = renderAPIManager->GetD3DDevice();
         HZ_CORE_ASSERT(m_Device, "Failed to get D3D12 device");
         
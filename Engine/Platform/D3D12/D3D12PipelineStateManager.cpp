@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "D3D12PipelineStateManager.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "D3D12RenderAPIManager.h"
 #include <functional>
 
@@ -19,8 +20,7 @@ namespace Hazel {
     void D3D12PipelineStateManager::Initialize()
     {
         // 获取D3D12设备
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(
-            RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         m_Device = renderAPIManager->GetD3DDevice();
         HZ_CORE_ASSERT(m_Device, "Failed to get D3D12 device");
     }
@@ -54,11 +54,7 @@ namespace Hazel {
         // 添加到缓存（使用弱引用避免循环引用）
         m_PipelineCache[hash] = std::weak_ptr<IGraphicsPipeline>(pipeline);
         
-        // 检查是否需要垃圾回收
-        if (m_PipelineCache.size() > GC_THRESHOLD) {
-            GarbageCollect();
-        }
-        
+        // 失效的弱引用由 Application 注册的 PipelineCacheSweep 分帧清理，这里不再整表扫描
         return pipeline;
     }
 
@@ -86,83 +82,6 @@ namespace Hazel {
         return m_PipelineCache.size();
     }
 
-    uint64_t D3D12PipelineStateManager::HashPipelineDesc(const GraphicsPipelineDesc& desc) const
-    {
-        // 使用std::hash组合各个组件的哈希值
-        size_t hash = 0;
-        
-        // 哈希shader指针（假设同一个shader对象表示同一个shader）
-        hash ^= std::hash<void*>{}(desc.shader.get()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        // 哈希光栅化状态
-        hash ^= HashRasterizerState(desc.rasterizerState) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        // 哈希混合状态
-        hash ^= HashBlendState(desc.blendState) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        // 哈希深度模板状态
-        hash ^= HashDepthStencilState(desc.depthStencilState) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        // 哈希图元拓扑
-        hash ^= std::hash<int>{}(static_cast<int>(desc.primitiveTopology)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        // 哈希渲染目标格式
-        hash ^= std::hash<int>{}(static_cast<int>(desc.colorFormat)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        hash ^= std::hash<int>{}(static_cast<int>(desc.depthStencilFormat)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        // 哈希采样设置
-        hash ^= std::hash<uint32_t>{}(desc.sampleCount) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        hash ^= std::hash<uint32_t>{}(desc.sampleQuality) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
-        
-        return hash;
-    }
-
-    size_t D3D12PipelineStateManager::HashRasterizerState(const RasterizerStateDesc& desc) const
-    {
-        size_t hash = 0;
-        hash ^= std::hash<int>{}(static_cast<int>(desc.fillMode));
-        hash ^= std::hash<int>{}(static_cast<int>(desc.cullMode)) << 1;
-        hash ^= std::hash<bool>{}(desc.frontCounterClockwise) << 2;
-        hash ^= std::hash<bool>{}(desc.depthClipEnable) << 3;
-        hash ^= std::hash<bool>{}(desc.scissorEnable) << 4;
-        hash ^= std::hash<float>{}(desc.depthBias) << 5;
-        hash ^= std::hash<float>{}(desc.depthBiasClamp) << 6;
-        hash ^= std::hash<float>{}(desc.slopeScaledDepthBias) << 7;
-        return hash;
-    }
-
-    size_t D3D12PipelineStateManager::HashBlendState(const BlendStateDesc& desc) const
-    {
-        size_t hash = 0;
-        hash ^= std::hash<bool>{}(desc.alphaToCoverageEnable);
-        hash ^= std::hash<bool>{}(desc.independentBlendEnable) << 1;
-        
-        // 对于简化，只哈希第一个渲染目标的混合状态
-        const auto& rt = desc.renderTargetBlend[0];
-        hash ^= std::hash<bool>{}(rt.blendEnable) << 2;
-        hash ^= std::hash<int>{}(static_cast<int>(rt.srcColorBlendFactor)) << 3;
-        hash ^= std::hash<int>{}(static_cast<int>(rt.dstColorBlendFactor)) << 4;
-        hash ^= std::hash<int>{}(static_cast<int>(rt.colorBlendOp)) << 5;
-        hash ^= std::hash<int>{}(static_cast<int>(rt.srcAlphaBlendFactor)) << 6;
-        hash ^= std::hash<int>{}(static_cast<int>(rt.dstAlphaBlendFactor)) << 7;
-        hash ^= std::hash<int>{}(static_cast<int>(rt.alphaBlendOp)) << 8;
-        hash ^= std::hash<uint8_t>{}(rt.colorWriteMask) << 9;
-        
-        return hash;
-    }
-
-    size_t D3D12PipelineStateManager::HashDepthStencilState(const DepthStencilStateDesc& desc) const
-    {
-        size_t hash = 0;
-        hash ^= std::hash<bool>{}(desc.depthEnable);
-        hash ^= std::hash<bool>{}(desc.depthWriteEnable) << 1;
-        hash ^= std::hash<int>{}(static_cast<int>(desc.depthFunc)) << 2;
-        hash ^= std::hash<bool>{}(desc.stencilEnable) << 3;
-        hash ^= std::hash<uint8_t>{}(desc.stencilReadMask) << 4;
-        hash ^= std::hash<uint8_t>{}(desc.stencilWriteMask) << 5;
-        return hash;
-    }
-
     size_t D3D12PipelineStateManager::PipelineDescHasher::operator()(const GraphicsPipelineDesc& desc) const
     {
         // 这是一个静态哈希器，但我们使用实例方法来复用代码
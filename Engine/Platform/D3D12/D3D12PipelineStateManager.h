@@ -19,14 +19,7 @@ namespace Hazel {
         virtual void GarbageCollect() override;
         virtual size_t GetCachedPipelineCount() const override;
         
-    protected:
-        virtual uint64_t HashPipelineDesc(const GraphicsPipelineDesc& desc) const override;
-        
     private:
-        // 辅助哈希方法
-        size_t HashRasterizerState(const RasterizerStateDesc& desc) const;
-        size_t HashBlendState(const BlendStateDesc& desc) const;
-        size_t HashDepthStencilState(const DepthStencilStateDesc& desc) const;
         // 初始化D3D12设备引用
         void Initialize();
         
@@ -48,7 +41,6 @@ namespace Hazel {
         
         // 垃圾回收的策略设置
         static constexpr size_t MAX_CACHED_PIPELINES = 1000;
-        static constexpr size_t GC_THRESHOLD = 800;
     };
 
 } // namespace Hazel 
\ No newline at end of file
@@ -17,7 +17,7 @@ using namespace std;
 using namespace DirectX;
 namespace Hazel {
 
-	class D3D12RenderAPIManager : public RenderAPIManager
+	class D3D12RenderAPIManager final : public RenderAPIManager
 	{
 	public:
 		struct FrameContext
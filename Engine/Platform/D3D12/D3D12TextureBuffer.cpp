@@ -1,5 +1,6 @@
 #include "hzpch.h"
 #include "Platform/D3D12/D3D12TextureBuffer.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 #include "Runtime/Core/Application.h"
 #include "glm/gtc/type_ptr.hpp"
 
@@ -50,7 +51,7 @@ namespace Hazel
 
         // ����ط��Ȳ����� device�������ˡ�����
         // ԭ��������ط��Ҳ�Ӧ����ô��devices...
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
         device->CreateCommittedResource
         (
@@ -90,7 +91,7 @@ namespace Hazel
 
         // ����ط��Ȳ����� device�������ˡ�����
         // ԭ��������ط��Ҳ�Ӧ����ô��devices...
-        D3D12RenderAPIManager* renderAPIManager = dynamic_cast<D3D12RenderAPIManager*>(RenderAPIManager::getInstance()->GetManager().get());
+        D3D12RenderAPIManager* renderAPIManager = RHICast<D3D12RenderAPIManager>(RenderAPIManager::getInstance());
         Microsoft::WRL::ComPtr<ID3D12Device> device = renderAPIManager->GetD3DDevice();
         device->CreateCommittedResource
         (
@@ -4,7 +4,7 @@
 #include "Platform/D3D12/d3dx12.h"
 namespace Hazel {
 
-	class D3D12VertexArray : public VertexArray
+	class D3D12VertexArray final : public VertexArray
 	{
 	public:
 		D3D12VertexArray();
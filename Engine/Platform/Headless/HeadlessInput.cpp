@@ -0,0 +1,34 @@
+#include "hzpch.h"
+#include "Runtime/Core/Input/Input.h"
+
+// Windows builds poll input through WindowsInput.cpp, headless platforms have no devices
+#ifndef HZ_PLATFORM_WINDOWS
+namespace Hazel {
+
+	bool Input::IsKeyPressed(int keycode)
+	{
+		return false;
+	}
+
+	bool Input::IsMouseButtonPressed(int button)
+	{
+		return false;
+	}
+
+	std::pair<float, float> Input::GetMousePosition()
+	{
+		return { 0.0f, 0.0f };
+	}
+
+	float Input::GetMouseX()
+	{
+		return 0.0f;
+	}
+
+	float Input::GetMouseY()
+	{
+		return 0.0f;
+	}
+
+}
+#endif
@@ -0,0 +1,36 @@
+#include "hzpch.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#include "Runtime/Core/Events/ApplicationEvent.h"
+
+namespace Hazel {
+
+#ifndef HZ_PLATFORM_WINDOWS
+	// no native window backend on this platform
+	Window* Window::Create(const WindowProps& props)
+	{
+		return new HeadlessWindow(props);
+	}
+#endif
+
+	HeadlessWindow::HeadlessWindow(const WindowProps& props)
+	{
+		m_Data.Title = props.Title;
+		m_Data.Width = props.Width;
+		m_Data.Height = props.Height;
+
+		HZ_CORE_INFO("Creating headless window {0} ({1}, {2})", props.Title, props.Width, props.Height);
+	}
+
+	void HeadlessWindow::Resize(unsigned int width, unsigned int height)
+	{
+		m_Data.Width = width;
+		m_Data.Height = height;
+
+		if (m_Data.EventCallback)
+		{
+			WindowResizeEvent event(width, height, width == 0 || height == 0, false);
+			m_Data.EventCallback(event);
+		}
+	}
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Runtime/Core/Window/Window.h"
+
+namespace Hazel {
+
+	// Window without an OS window or swap chain. Used by headless Application runs
+	// (benchmarks / CI perf runs) and as the only window backend on Linux.
+	class HeadlessWindow : public Window
+	{
+	public:
+		HeadlessWindow(const WindowProps& props);
+		virtual ~HeadlessWindow() = default;
+
+		void OnUpdate() override {}
+
+		inline unsigned int GetWidth() const override { return m_Data.Width; }
+		inline unsigned int GetHeight() const override { return m_Data.Height; }
+
+		// Window attributes
+		inline void SetEventCallback(const EventCallbackFn& callback) override { m_Data.EventCallback = callback; }
+		void SetBackGroundColor() override {}
+		void SetVSync(bool enabled) override { m_Data.VSync = enabled; }
+		bool IsVSync() const override { return m_Data.VSync; }
+
+		inline virtual void* GetNativeWindow() const override { return nullptr; }
+
+		// simulate an OS resize, sends a WindowResizeEvent through the event callback
+		void Resize(unsigned int width, unsigned int height);
+	private:
+		struct WindowData
+		{
+			std::string Title;
+			unsigned int Width, Height;
+			bool VSync = false;
+
+			EventCallbackFn EventCallback;
+		};
+
+		WindowData m_Data;
+	};
+
+}
@@ -0,0 +1,62 @@
+#include "hzpch.h"
+#include "NullBuffer.h"
+#include "NullRHIStats.h"
+#include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
+#include <cstring>
+
+namespace Hazel
+{
+    NullVertexBuffer::NullVertexBuffer(float* vertices, uint32_t size, uint32_t stride)
+    {
+        m_BufferSize = size;
+        m_BufferStride = stride;
+
+        if (vertices && size > 0) {
+            const uint8_t* src = reinterpret_cast<const uint8_t*>(vertices);
+            m_Data.assign(src, src + size);
+        }
+        NullRHIStats::Add(NullRHICounter::BytesUploaded, size);
+    }
+
+    NullVertexBuffer::~NullVertexBuffer()
+    {
+    }
+
+    NullIndexBuffer::NullIndexBuffer(uint16_t* indices, uint32_t count)
+    {
+        if (indices && count > 0) {
+            m_Indices.assign(indices, indices + count);
+        }
+        NullRHIStats::Add(NullRHICounter::BytesUploaded, (uint64_t)count * sizeof(uint16_t));
+    }
+
+    NullIndexBuffer::~NullIndexBuffer()
+    {
+    }
+
+    NullConstantBuffer::NullConstantBuffer(uint32_t bufferSize)
+    {
+        m_UUID = Unique::GetUUID();
+        // 和D3D12一样按256字节对齐，保证前端看到的大小一致
+        m_BufferSize = (bufferSize + 255) & ~255u;
+        m_Data.resize(m_BufferSize);
+    }
+
+    NullConstantBuffer::~NullConstantBuffer()
+    {
+        // 通知ViewManager该资源即将销毁
+        IGfxViewManager::Get().OnResourceDestroyed(m_UUID);
+    }
+
+    void NullConstantBuffer::SetData(void* srcData, int length)
+    {
+        if (!srcData || length <= 0 || (uint32_t)length > m_BufferSize) {
+            HZ_CORE_ERROR("[NullConstantBuffer] Invalid SetData: length {0}, buffer size {1}", length, m_BufferSize);
+            return;
+        }
+
+        memcpy(m_Data.data(), srcData, length);
+        NullRHIStats::Add(NullRHICounter::BytesUploaded, (uint64_t)length);
+        HZ_PERF_COUNTER_ADD(ConstantBufferBytes, length);
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "hzpch.h"
+#include "Runtime/Graphics/RHI/Core/Buffer.h"
+
+namespace Hazel 
+{
+    // 数据只拷贝到CPU内存，上传的字节数计入 NullRHIStats
+    class NullVertexBuffer final : public VertexBuffer
+    {
+    public:
+        NullVertexBuffer(float* vertices, uint32_t size, uint32_t stride);
+        virtual ~NullVertexBuffer();
+
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+
+        inline const std::vector<uint8_t>& GetData() const { return m_Data; }
+    private:
+        std::vector<uint8_t> m_Data;
+    };
+
+    class NullIndexBuffer final : public IndexBuffer
+    {
+    public:
+        // count 是索引个数（Mesh::LoadMesh 传入的是 indexData.size()）
+        NullIndexBuffer(uint16_t* indices, uint32_t count);
+        virtual ~NullIndexBuffer();
+
+        virtual void Bind() const override {}
+        virtual void Unbind() const override {}
+
+        virtual uint32_t GetCount() const override { return (uint32_t)m_Indices.size(); }
+        inline const std::vector<uint16_t>& GetIndices() const { return m_Indices; }
+    private:
+        std::vector<uint16_t> m_Indices;
+    };
+
+    class NullConstantBuffer final : public ConstantBuffer
+    {
+    public:
+        NullConstantBuffer(uint32_t bufferSize);
+        virtual ~NullConstantBuffer();
+
+        virtual void SetData(void* srcData, int length) override;
+        virtual void* GetNativeResource() const override { return (void*)m_Data.data(); }
+    private:
+        std::vector<uint8_t> m_Data;
+    };
+
+}
@@ -0,0 +1,155 @@
+#include "hzpch.h"
+#include "NullCommandList.h"
+#include "NullRHIStats.h"
+#include "Runtime/Graphics/RHI/Interface/IGraphicsPipeline.h"
+
+namespace Hazel 
+{
+	NullCommandList::NullCommandList(CommandListType type)
+		: CommandList() {
+		m_type = type;
+		// 原生对象不存在，用自身地址占位，保证句柄IsValid
+		m_nativeHandle.commandList = this;
+		m_nativeHandle.commandAllocator = this;
+		m_nativeHandle.isValid = true;
+		m_state = ExecutionState::Closed;
+	}
+
+	NullCommandList::NullCommandList(const CommandListHandle& handle, CommandListType type)
+		: CommandList() {
+		m_type = type;
+		m_nativeHandle = handle;
+		m_state = ExecutionState::Closed;
+	}
+
+	NullCommandList::~NullCommandList()
+	{
+	}
+
+	void NullCommandList::Reset()
+	{
+		Reset(m_currentPipeline);
+	}
+
+	void NullCommandList::Reset(Ref<IGraphicsPipeline> pipeline)
+	{
+		if (m_state == ExecutionState::Recording) {
+			HZ_CORE_ERROR("[NullCommandList] Reset called while still recording");
+		}
+
+		m_currentPipeline = pipeline;
+		m_CurrentVertexArray = nullptr;
+		m_commandCount = 0;
+		m_state = ExecutionState::Recording;
+	}
+
+	void NullCommandList::Close()
+	{
+		if (!CheckRecording("Close")) {
+			m_state = ExecutionState::Error;
+			return;
+		}
+		m_state = ExecutionState::Closed;
+	}
+
+	void NullCommandList::Execute()
+	{
+		if (m_state != ExecutionState::Closed) {
+			HZ_CORE_ERROR("[NullCommandList] Cannot execute: CommandList not closed");
+			return;
+		}
+
+		m_state = ExecutionState::Executing;
+		NullRHIStats::Add(NullRHICounter::CommandListsExecuted);
+		m_state = ExecutionState::Completed;
+	}
+
+	void NullCommandList::ClearRenderTargetView(const Ref<TextureBuffer>& buffer, const glm::vec4& color)
+	{
+		if (!CheckRecording("ClearRenderTargetView"))
+			return;
+
+		NullRHIStats::Add(NullRHICounter::RenderTargetClears);
+		m_commandCount++;
+	}
+
+	void NullCommandList::ChangeResourceState(const Ref<TextureBuffer>& texture, const TextureRenderUsage& fromFormat, const TextureRenderUsage& toFormat)
+	{
+		if (!CheckRecording("ChangeResourceState"))
+			return;
+
+		if (texture->GetTextureRenderUsage() != fromFormat) {
+			HZ_CORE_WARN("[NullCommandList] Resource barrier source state does not match the tracked state");
+		}
+		texture->SetTextureRenderUsage(toFormat);
+
+		NullRHIStats::Add(NullRHICounter::ResourceBarriers);
+		m_commandCount++;
+	}
+
+	void NullCommandList::SetVertexArray(const Ref<VertexArray>& vertexArray)
+	{
+		if (!CheckRecording("SetVertexArray"))
+			return;
+
+		NullRHIStats::Add(NullRHICounter::VertexArrayBinds);
+		if (vertexArray.get() == m_CurrentVertexArray) {
+			NullRHIStats::Add(NullRHICounter::RedundantVertexArrayBinds);
+		}
+		m_CurrentVertexArray = vertexArray.get();
+		m_commandCount++;
+	}
+
+	void NullCommandList::DrawIndexed(uint32_t indexCount, uint32_t instanceCount, uint32_t startIndex, int32_t baseVertex)
+	{
+		if (!CheckRecording("DrawIndexed"))
+			return;
+
+		NullRHIStats::Add(NullRHICounter::DrawCalls);
+		NullRHIStats::Add(NullRHICounter::IndicesSubmitted, (uint64_t)indexCount * instanceCount);
+		HZ_PERF_COUNTER_INC(DrawCalls);
+		HZ_PERF_COUNTER_ADD(Instances, instanceCount);
+		m_commandCount++;
+	}
+
+	void NullCommandList::Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t startVertex)
+	{
+		if (!CheckRecording("Draw"))
+			return;
+
+		NullRHIStats::Add(NullRHICounter::DrawCalls);
+		NullRHIStats::Add(NullRHICounter::VerticesSubmitted, (uint64_t)vertexCount * instanceCount);
+		HZ_PERF_COUNTER_INC(DrawCalls);
+		HZ_PERF_COUNTER_ADD(Instances, instanceCount);
+		m_commandCount++;
+	}
+
+	void NullCommandList::SetPipelineState(Ref<IGraphicsPipeline> pipeline)
+	{
+		if (!CheckRecording("SetPipelineState"))
+			return;
+
+		NullRHIStats::Add(NullRHICounter::PipelineStateChanges);
+		if (pipeline == m_currentPipeline) {
+			NullRHIStats::Add(NullRHICounter::RedundantPipelineStateChanges);
+		} else {
+			HZ_PERF_COUNTER_INC(PipelineSwitches);
+		}
+		m_currentPipeline = pipeline;
+		m_commandCount++;
+	}
+
+	Ref<IGraphicsPipeline> NullCommandList::GetCurrentPipeline() const
+	{
+		return m_currentPipeline;
+	}
+
+	bool NullCommandList::CheckRecording(const char* operation) const
+	{
+		if (m_state != ExecutionState::Recording) {
+			HZ_CORE_ERROR("[NullCommandList] {0} called while CommandList is not recording", operation);
+			return false;
+		}
+		return true;
+	}
+}
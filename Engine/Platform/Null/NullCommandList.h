@@ -0,0 +1,41 @@
+#pragma once
+#include "Runtime/Graphics/RHI/Core/CommandList.h"
+
+namespace Hazel 
+{
+	// 只做状态检查和计数，不生成任何GPU命令
+	class NullCommandList final : public CommandList
+	{
+	public:
+		NullCommandList(CommandListType type = CommandListType::Graphics);
+		// 由NullCommandListManager传入它分配的句柄
+		NullCommandList(const CommandListHandle& handle, CommandListType type);
+		virtual ~NullCommandList();
+
+		// CommandList接口实现
+		virtual void Reset() override;
+		virtual void Reset(Ref<IGraphicsPipeline> pipeline) override;
+		virtual void Close() override;
+		virtual void Execute() override;
+		virtual void ClearRenderTargetView(const Ref<TextureBuffer>& buffer, const glm::vec4& color) override;
+		virtual void ChangeResourceState(const Ref<TextureBuffer>& texture, 
+		                               const TextureRenderUsage& fromFormat, 
+		                               const TextureRenderUsage& toFormat) override;
+
+		// 绘制操作
+		virtual void SetVertexArray(const Ref<VertexArray>& vertexArray) override;
+		virtual void DrawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t startIndex = 0, int32_t baseVertex = 0) override;
+		virtual void Draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t startVertex = 0) override;
+
+		// 渲染管线操作
+		virtual void SetPipelineState(Ref<IGraphicsPipeline> pipeline) override;
+		virtual Ref<IGraphicsPipeline> GetCurrentPipeline() const override;
+
+	private:
+		// 录制阶段之外的调用是前端的bug，D3D12会直接报设备错误，这里提前报出来
+		bool CheckRecording(const char* operation) const;
+
+		// 只用来比较是否重复绑定，不持有
+		const VertexArray* m_CurrentVertexArray = nullptr;
+	};
+}
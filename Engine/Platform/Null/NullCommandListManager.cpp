@@ -0,0 +1,130 @@
+#include "hzpch.h"
+#include "NullCommandListManager.h"
+#include "NullCommandList.h"
+#include "NullRHIStats.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Core/Memory/Allocator/ObjectPool.h"
+
+namespace Hazel {
+
+    NullCommandListManager::NullCommandListManager() {
+    }
+
+    NullCommandListManager::~NullCommandListManager() {
+        m_ActiveCommandLists.clear();
+    }
+
+    void NullCommandListManager::Initialize() {
+        HZ_CORE_INFO("[NullCommandListManager] Initialized successfully");
+    }
+
+    Ref<CommandList> NullCommandListManager::AcquireCommandList(CommandListType type) {
+        CommandListHandle handle = AcquireHandle(type);
+        if (!handle.IsValid()) {
+            HZ_CORE_ERROR("[NullCommandListManager] Failed to acquire command list handle");
+            return nullptr;
+        }
+
+        // 和D3D12一样，包装器和控制块来自对象池
+        return CreatePooledRef<NullCommandList>(handle, type);
+    }
+
+    void NullCommandListManager::ReleaseCommandList(Ref<CommandList> commandList) {
+        if (!commandList) {
+            HZ_CORE_WARN("[NullCommandListManager] Attempting to release null command list");
+            return;
+        }
+
+        ReleaseHandle(commandList->GetNativeHandle());
+    }
+
+    CommandListHandle NullCommandListManager::AcquireHandle(CommandListType type) {
+        uint64_t id = m_NextHandleId.fetch_add(1, std::memory_order_relaxed);
+
+        CommandListHandle handle;
+        handle.commandList = reinterpret_cast<void*>(static_cast<uintptr_t>(id));
+        handle.commandAllocator = handle.commandList;
+        handle.frameId = m_CurrentFrameId;
+        handle.isValid = true;
+        HZ_PERF_COUNTER_INC(CommandListsAcquired);
+
+        std::lock_guard<std::mutex> lock(m_ActiveListsMutex);
+        m_ActiveCommandLists[id] = handle;
+        return handle;
+    }
+
+    void NullCommandListManager::ReleaseHandle(const CommandListHandle& handle) {
+        if (!handle.IsValid()) {
+            HZ_CORE_WARN("[NullCommandListManager] Attempting to release invalid handle");
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_ActiveListsMutex);
+        uint64_t id = reinterpret_cast<uint64_t>(handle.commandList);
+        if (m_ActiveCommandLists.erase(id) == 0) {
+            HZ_CORE_WARN("[NullCommandListManager] Releasing a handle that is not active (double release?)");
+        }
+    }
+
+    std::vector<Ref<CommandList>> NullCommandListManager::AcquireBatch(CommandListType type, uint32_t count) {
+        std::vector<Ref<CommandList>> result;
+        result.reserve(count);
+
+        for (uint32_t i = 0; i < count; ++i) {
+            result.push_back(AcquireCommandList(type));
+        }
+
+        return result;
+    }
+
+    void NullCommandListManager::ReleaseBatch(const std::vector<Ref<CommandList>>& commandLists) {
+        for (auto& commandList : commandLists) {
+            ReleaseCommandList(commandList);
+        }
+    }
+
+    void NullCommandListManager::BeginFrame(uint64_t frameId) {
+        m_CurrentFrameId = frameId;
+    }
+
+    void NullCommandListManager::EndFrame() {
+        NullRHIStats::EndFrame();
+    }
+
+    void NullCommandListManager::ExecuteAsync(Ref<CommandList> commandList, std::function<void()> callback) {
+        if (!commandList) {
+            HZ_CORE_ERROR("[NullCommandListManager] Cannot execute null command list");
+            return;
+        }
+
+        // 走同一个任务系统，前端的线程开销和D3D12路径一致
+        JobSystem::Run([commandList, callback]() {
+            commandList->Execute();
+            if (callback) {
+                callback();
+            }
+        });
+    }
+
+    void NullCommandListManager::WaitForCompletion(Ref<CommandList> commandList) {
+        if (!commandList) {
+            HZ_CORE_ERROR("[NullCommandListManager] Cannot wait for null command list");
+            return;
+        }
+
+        commandList->WaitForCompletion();
+    }
+
+    void NullCommandListManager::PrintStatistics() const {
+        HZ_CORE_INFO("[NullCommandListManager] Statistics:");
+        HZ_CORE_INFO("  Active command lists: {}", GetTotalActiveCount());
+        HZ_CORE_INFO("  Last frame:");
+        NullRHIStats::Print(NullRHIStats::GetLastFrame());
+    }
+
+    uint32_t NullCommandListManager::GetTotalActiveCount() const {
+        std::lock_guard<std::mutex> lock(m_ActiveListsMutex);
+        return static_cast<uint32_t>(m_ActiveCommandLists.size());
+    }
+
+} // namespace Hazel
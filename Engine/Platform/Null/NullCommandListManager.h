@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Runtime/Graphics/RHI/Interface/ICommandListManager.h"
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <mutex>
+
+namespace Hazel {
+
+    class NullCommandListManager : public ICommandListManager {
+    public:
+        NullCommandListManager();
+        virtual ~NullCommandListManager();
+        
+        // === 初始化 ===
+        void Initialize() override;
+        
+        // === 高级接口 ===
+        Ref<CommandList> AcquireCommandList(CommandListType type = CommandListType::Graphics) override;
+        void ReleaseCommandList(Ref<CommandList> commandList) override;
+        
+        // === 低级接口 ===
+        CommandListHandle AcquireHandle(CommandListType type = CommandListType::Graphics) override;
+        void ReleaseHandle(const CommandListHandle& handle) override;
+        
+        // === 批量操作 ===
+        std::vector<Ref<CommandList>> AcquireBatch(CommandListType type, uint32_t count) override;
+        void ReleaseBatch(const std::vector<Ref<CommandList>>& commandLists) override;
+        
+        // === 帧管理 ===
+        // EndFrame 同时推进 NullRHIStats 的帧计数
+        void BeginFrame(uint64_t frameId) override;
+        void EndFrame() override;
+        
+        // === 线程管理 ===
+        void RegisterWorkerThread() override {}
+        void UnregisterWorkerThread() override {}
+        
+        // === 异步执行支持 ===
+        void ExecuteAsync(Ref<CommandList> commandList, std::function<void()> callback = nullptr) override;
+        void WaitForCompletion(Ref<CommandList> commandList) override;
+        
+        // === 统计和调试 ===
+        void PrintStatistics() const override;
+        uint32_t GetTotalActiveCount() const override;
+        
+    private:
+        // 没有原生对象，句柄里的指针只是递增的ID
+        std::atomic<uint64_t> m_NextHandleId{ 1 };
+
+        std::unordered_map<uint64_t, CommandListHandle> m_ActiveCommandLists;
+        mutable std::mutex m_ActiveListsMutex;
+        
+        uint64_t m_CurrentFrameId = 0;
+    };
+
+} // namespace Hazel
@@ -0,0 +1,118 @@
+#include "hzpch.h"
+#include "NullDescriptorAllocator.h"
+#include "NullRHIStats.h"
+
+namespace Hazel {
+
+    NullDescriptorAllocator::NullDescriptorAllocator(DescriptorHeapType heapType, uint32_t maxDescriptors)
+        : m_HeapType(heapType)
+        , m_MaxDescriptors(maxDescriptors)
+        , m_CurrentOffset(0)
+    {
+    }
+
+    NullDescriptorAllocator::~NullDescriptorAllocator() {
+    }
+
+    DescriptorAllocation NullDescriptorAllocator::Allocate(uint32_t count) {
+        std::lock_guard<std::mutex> lock(m_AllocationMutex);
+        
+        if (count == 0) {
+            return DescriptorAllocation{};
+        }
+        
+        // 优先复用第一个足够大的空闲块
+        uint32_t freeBlockOffset = 0;
+        if (m_FreeBlocks.Allocate(count, freeBlockOffset)) {
+            NullRHIStats::Add(NullRHICounter::DescriptorAllocations, count);
+            HZ_PERF_COUNTER_ADD(DescriptorsAllocated, count);
+            return MakeAllocation(m_HeapType, freeBlockOffset, count);
+        }
+        
+        if (m_CurrentOffset + count <= m_MaxDescriptors) {
+            uint32_t offset = m_CurrentOffset;
+            m_CurrentOffset += count;
+            
+            NullRHIStats::Add(NullRHICounter::DescriptorAllocations, count);
+            HZ_PERF_COUNTER_ADD(DescriptorsAllocated, count);
+            return MakeAllocation(m_HeapType, offset, count);
+        }
+        
+        // 和D3D12一样报错，自动化测试里能暴露描述符泄漏
+        HZ_CORE_ERROR("NullDescriptorAllocator: Out of descriptor space");
+        return DescriptorAllocation{};
+    }
+
+    void NullDescriptorAllocator::Free(const DescriptorAllocation& allocation) {
+        if (!allocation.IsValid()) {
+            return;
+        }
+        
+        std::lock_guard<std::mutex> lock(m_AllocationMutex);
+        uint32_t offset = static_cast<uint32_t>((allocation.baseHandle.cpuHandle - GetFakeHeapBase(m_HeapType)) / s_DescriptorSize);
+        m_FreeBlocks.Free(offset, allocation.count);
+    }
+
+    void NullDescriptorAllocator::Reset() {
+        std::lock_guard<std::mutex> lock(m_AllocationMutex);
+        m_FreeBlocks.Clear();
+        m_CurrentOffset = 0;
+    }
+
+    uint64_t NullDescriptorAllocator::GetFakeHeapBase(DescriptorHeapType heapType) {
+        // 每种堆占一段互不重叠的地址，避免不同堆的句柄相等
+        return (static_cast<uint64_t>(heapType) + 1) << 40;
+    }
+
+    bool NullDescriptorAllocator::IsShaderVisible(DescriptorHeapType heapType) {
+        return heapType == DescriptorHeapType::CbvSrvUav ||
+               heapType == DescriptorHeapType::ImGuiSrvUav ||
+               heapType == DescriptorHeapType::Sampler;
+    }
+
+    DescriptorAllocation NullDescriptorAllocator::MakeAllocation(DescriptorHeapType heapType, uint32_t offset, uint32_t count) {
+        uint64_t address = GetFakeHeapBase(heapType) + static_cast<uint64_t>(offset) * s_DescriptorSize;
+
+        DescriptorAllocation allocation;
+        allocation.baseHandle.heapIndex = 0;
+        allocation.baseHandle.cpuHandle = address;
+        allocation.baseHandle.gpuHandle = IsShaderVisible(heapType) ? address : 0;
+        allocation.baseHandle.isValid = true;
+        allocation.count = count;
+        allocation.heapIndex = 0;
+        allocation.descriptorSize = s_DescriptorSize;
+        return allocation;
+    }
+
+    NullFrameDescriptorAllocator::NullFrameDescriptorAllocator(DescriptorHeapType heapType, uint32_t maxDescriptors)
+        : PerFrameDescriptorAllocator(heapType, maxDescriptors)
+    {
+        m_DescriptorSize = NullDescriptorAllocator::s_DescriptorSize;
+    }
+
+    void NullFrameDescriptorAllocator::Initialize() {
+        m_CurrentOffset = 0;
+    }
+
+    DescriptorAllocation NullFrameDescriptorAllocator::Allocate(uint32_t count) {
+        std::lock_guard<std::mutex> lock(m_AllocationMutex);
+
+        if (count == 0 || !HasSpace(count)) {
+            HZ_CORE_ERROR("NullFrameDescriptorAllocator: Out of frame descriptor space");
+            return DescriptorAllocation{};
+        }
+
+        uint32_t offset = m_CurrentOffset;
+        m_CurrentOffset += count;
+
+        NullRHIStats::Add(NullRHICounter::DescriptorAllocations, count);
+        HZ_PERF_COUNTER_ADD(DescriptorsAllocated, count);
+        return NullDescriptorAllocator::MakeAllocation(m_HeapType, s_FrameRegionStart + offset, count);
+    }
+
+    void NullFrameDescriptorAllocator::Reset() {
+        std::lock_guard<std::mutex> lock(m_AllocationMutex);
+        m_CurrentOffset = 0;
+    }
+
+} // namespace Hazel
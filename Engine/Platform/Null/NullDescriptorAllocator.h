@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Runtime/Graphics/RHI/Interface/IDescritorAllocator.h"
+#include "Runtime/Graphics/RHI/Interface/PerFrameDescriptorAllocator.h"
+#include "Runtime/Graphics/RHI/Interface/DescriptorFreeList.h"
+#include <mutex>
+
+namespace Hazel {
+
+    // 没有真正的描述符堆，句柄是按堆类型划分的假地址（非0，可以直接做偏移计算）
+    // 分配策略和D3D12DescriptorAllocator相同，描述符个数计入 NullRHIStats
+    class NullDescriptorAllocator : public IDescriptorAllocator {
+    public:
+        NullDescriptorAllocator(DescriptorHeapType heapType, uint32_t maxDescriptors = 1024);
+        virtual ~NullDescriptorAllocator();
+
+        // IDescriptorAllocator interface implementation
+        virtual DescriptorAllocation Allocate(uint32_t count = 1) override;
+        virtual void Free(const DescriptorAllocation& allocation) override;
+        virtual void Reset() override;
+        virtual DescriptorHeapType GetHeapType() const override { return m_HeapType; }
+        virtual uint32_t GetDescriptorSize() const override { return s_DescriptorSize; }
+
+        inline uint32_t GetAllocatedCount() const { return m_CurrentOffset; }
+
+        // 和D3D12 CBV/SRV/UAV描述符大小一致
+        static constexpr uint32_t s_DescriptorSize = 32;
+
+        static uint64_t GetFakeHeapBase(DescriptorHeapType heapType);
+        static bool IsShaderVisible(DescriptorHeapType heapType);
+        static DescriptorAllocation MakeAllocation(DescriptorHeapType heapType, uint32_t offset, uint32_t count);
+
+    private:
+        DescriptorHeapType m_HeapType;
+        uint32_t m_MaxDescriptors;
+        uint32_t m_CurrentOffset;
+
+        DescriptorFreeList m_FreeBlocks;
+        std::mutex m_AllocationMutex;
+    };
+
+    // 帧临时描述符，线性分配，Reset 时整体回收
+    class NullFrameDescriptorAllocator : public PerFrameDescriptorAllocator {
+    public:
+        NullFrameDescriptorAllocator(DescriptorHeapType heapType, uint32_t maxDescriptors = 1024);
+        virtual ~NullFrameDescriptorAllocator() = default;
+
+        virtual void Initialize() override;
+        virtual DescriptorAllocation Allocate(uint32_t count = 1) override;
+        virtual void Reset() override;
+        virtual void* GetHeap() const override { return nullptr; }
+        virtual bool HasSpace(uint32_t count) const override { return m_CurrentOffset + count <= m_MaxDescriptors; }
+
+    private:
+        // 帧临时描述符放在同一种堆地址段的后半部分，不和常驻分配重叠
+        static constexpr uint32_t s_FrameRegionStart = 1u << 24;
+
+        std::mutex m_AllocationMutex;
+    };
+
+} // namespace Hazel
@@ -0,0 +1,138 @@
+#include "hzpch.h"
+#include "NullGfxViewManager.h"
+
+namespace Hazel {
+
+    NullGfxViewManager::NullGfxViewManager() {
+    }
+
+    NullGfxViewManager::~NullGfxViewManager() {
+    }
+
+    void NullGfxViewManager::Initialize() {
+        // 容量和D3D12DescriptorHeapManager的堆大小保持同一量级
+        m_Allocators[DescriptorHeapType::CbvSrvUav] = std::make_unique<NullDescriptorAllocator>(DescriptorHeapType::CbvSrvUav, 4096);
+        m_Allocators[DescriptorHeapType::Sampler] = std::make_unique<NullDescriptorAllocator>(DescriptorHeapType::Sampler, 256);
+        m_Allocators[DescriptorHeapType::Rtv] = std::make_unique<NullDescriptorAllocator>(DescriptorHeapType::Rtv, 256);
+        m_Allocators[DescriptorHeapType::Dsv] = std::make_unique<NullDescriptorAllocator>(DescriptorHeapType::Dsv, 256);
+        m_Allocators[DescriptorHeapType::ImGuiSrvUav] = std::make_unique<NullDescriptorAllocator>(DescriptorHeapType::ImGuiSrvUav, 256);
+
+        m_FrameAllocators[DescriptorHeapType::CbvSrvUav] = std::make_unique<NullFrameDescriptorAllocator>(DescriptorHeapType::CbvSrvUav);
+        m_FrameAllocators[DescriptorHeapType::Sampler] = std::make_unique<NullFrameDescriptorAllocator>(DescriptorHeapType::Sampler);
+        for (auto& [type, allocator] : m_FrameAllocators) {
+            allocator->Initialize();
+        }
+
+        HZ_CORE_INFO("NullGfxViewManager initialized");
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateRenderTargetView(const Ref<TextureBuffer>& texture) {
+        return CreateCachedView(texture->GetUUID(), DescriptorType::RTV);
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateDepthStencilView(const Ref<TextureBuffer>& texture) {
+        return CreateCachedView(texture->GetUUID(), DescriptorType::DSV);
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateShaderResourceView(const Ref<TextureBuffer>& texture) {
+        return CreateCachedView(texture->GetUUID(), DescriptorType::SRV);
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateConstantBufferView(const Ref<ConstantBuffer>& buffer) {
+        return CreateCachedView(buffer->GetUUID(), DescriptorType::CBV);
+    }
+
+    DescriptorAllocation NullGfxViewManager::AllocateDescriptors(uint32_t count, DescriptorHeapType type) {
+        return GetAllocator(type).Allocate(count);
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateConsecutiveShaderResourceViews(
+        const std::vector<Ref<TextureBuffer>>& textures) {
+        if (textures.empty()) {
+            return DescriptorAllocation{};
+        }
+        return GetAllocator(DescriptorHeapType::CbvSrvUav).Allocate(static_cast<uint32_t>(textures.size()));
+    }
+
+    void NullGfxViewManager::BeginFrame() {
+        for (auto& [type, allocator] : m_FrameAllocators) {
+            allocator->Reset();
+        }
+    }
+
+    void NullGfxViewManager::EndFrame() {
+    }
+
+    PerFrameDescriptorAllocator& NullGfxViewManager::GetFrameAllocator(DescriptorHeapType type) {
+        auto it = m_FrameAllocators.find(type);
+        HZ_CORE_ASSERT(it != m_FrameAllocators.end(), "Frame allocator not found for heap type");
+        return *it->second;
+    }
+
+    void NullGfxViewManager::OnResourceDestroyed(const boost::uuids::uuid& resourceId) {
+        auto resourceIt = m_ViewCache.find(resourceId);
+        if (resourceIt == m_ViewCache.end()) {
+            return;
+        }
+
+        // 描述符还回各自的堆，长时间运行的测试里不会耗尽
+        for (auto& [type, allocation] : resourceIt->second.Views) {
+            GetAllocator(GetHeapType(type)).Free(allocation);
+        }
+        m_ViewCache.erase(resourceIt);
+    }
+
+    DescriptorAllocation NullGfxViewManager::GetCachedView(const boost::uuids::uuid& resourceId, DescriptorType type) {
+        auto resourceIt = m_ViewCache.find(resourceId);
+        if (resourceIt != m_ViewCache.end()) {
+            return resourceIt->second.Find(type);
+        }
+        return DescriptorAllocation{};
+    }
+
+    void* NullGfxViewManager::GetHeap(DescriptorHeapType type) const {
+        return &GetAllocator(type);
+    }
+
+    IDescriptorAllocator& NullGfxViewManager::GetImGuiAllocator() const {
+        return GetAllocator(DescriptorHeapType::ImGuiSrvUav);
+    }
+
+    void* NullGfxViewManager::GetImGuiHeap() const {
+        return GetHeap(DescriptorHeapType::ImGuiSrvUav);
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateImGuiSRV(const Ref<TextureBuffer>& texture, const ViewDescription* viewDesc) {
+        // 和D3D12一样不缓存
+        return GetAllocator(DescriptorHeapType::ImGuiSrvUav).Allocate(1);
+    }
+
+    DescriptorAllocation NullGfxViewManager::CreateCachedView(const boost::uuids::uuid& resourceId, DescriptorType type) {
+        DescriptorAllocation cachedView = GetCachedView(resourceId, type);
+        if (cachedView.IsValid()) {
+            return cachedView;
+        }
+
+        DescriptorAllocation newView = GetAllocator(GetHeapType(type)).Allocate(1);
+        if (newView.IsValid()) {
+            m_ViewCache[resourceId].Set(type, newView);
+        }
+        return newView;
+    }
+
+    NullDescriptorAllocator& NullGfxViewManager::GetAllocator(DescriptorHeapType type) const {
+        auto it = m_Allocators.find(type);
+        HZ_CORE_ASSERT(it != m_Allocators.end(), "Descriptor allocator not found for heap type");
+        return *it->second;
+    }
+
+    DescriptorHeapType NullGfxViewManager::GetHeapType(DescriptorType type) {
+        switch (type) {
+            case DescriptorType::RTV:     return DescriptorHeapType::Rtv;
+            case DescriptorType::DSV:     return DescriptorHeapType::Dsv;
+            case DescriptorType::Sampler: return DescriptorHeapType::Sampler;
+            default:                      return DescriptorHeapType::CbvSrvUav;
+        }
+    }
+
+}
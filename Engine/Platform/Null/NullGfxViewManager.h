@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
+#include "Runtime/Graphics/RHI/Interface/DescriptorTypes.h"
+#include "Runtime/Core/Containers/FlatHashMap.h"
+#include "NullDescriptorAllocator.h"
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+
+namespace Hazel {
+
+    class NullGfxViewManager : public IGfxViewManager {
+    public:
+        NullGfxViewManager();
+        virtual ~NullGfxViewManager();
+
+        // IGfxViewManager interface implementation
+        virtual void Initialize() override;
+        
+        // Resource view creation - 和D3D12一样按UUID缓存，只有缓存未命中才分配描述符
+        virtual DescriptorAllocation CreateRenderTargetView(const Ref<TextureBuffer>& texture) override;
+        virtual DescriptorAllocation CreateDepthStencilView(const Ref<TextureBuffer>& texture) override;
+        virtual DescriptorAllocation CreateShaderResourceView(const Ref<TextureBuffer>& texture) override;
+        virtual DescriptorAllocation CreateConstantBufferView(const Ref<ConstantBuffer>& buffer) override;
+        
+        // Consecutive descriptor allocation and creation
+        virtual DescriptorAllocation AllocateDescriptors(uint32_t count, DescriptorHeapType type) override;
+        virtual void CreateShaderResourceView(const Ref<TextureBuffer>& texture, const DescriptorAllocation& targetHandle) override {}
+        virtual void CreateConstantBufferView(const Ref<ConstantBuffer>& buffer, const DescriptorAllocation& targetHandle) override {}
+        
+        // Batch consecutive view creation
+        virtual DescriptorAllocation CreateConsecutiveShaderResourceViews(
+            const std::vector<Ref<TextureBuffer>>& textures) override;
+        
+        // Frame management
+        virtual void BeginFrame() override;
+        virtual void EndFrame() override;
+        virtual PerFrameDescriptorAllocator& GetFrameAllocator(DescriptorHeapType type) override;
+        
+        // Resource lifecycle management
+        virtual void OnResourceDestroyed(const boost::uuids::uuid& resourceId) override;
+        virtual DescriptorAllocation GetCachedView(const boost::uuids::uuid& resourceId, DescriptorType type) override;
+        virtual void GarbageCollect() override {}
+        
+        // 没有真正的堆，返回对应的分配器，只保证非空
+        virtual void* GetHeap(DescriptorHeapType type) const override;
+
+        // ImGui 专用接口
+        virtual IDescriptorAllocator& GetImGuiAllocator() const override;
+        virtual void* GetImGuiHeap() const override;
+        virtual DescriptorAllocation CreateImGuiSRV(const Ref<TextureBuffer>& texture, const ViewDescription* viewDesc = nullptr) override;
+
+    private:
+        DescriptorAllocation CreateCachedView(const boost::uuids::uuid& resourceId, DescriptorType type);
+        NullDescriptorAllocator& GetAllocator(DescriptorHeapType type) const;
+        static DescriptorHeapType GetHeapType(DescriptorType type);
+
+    private:
+        std::unordered_map<DescriptorHeapType, std::unique_ptr<NullDescriptorAllocator>> m_Allocators;
+        std::unordered_map<DescriptorHeapType, std::unique_ptr<PerFrameDescriptorAllocator>> m_FrameAllocators;
+
+        // 缓存结构和D3D12GfxViewManager相同，前端的缓存命中率在两个后端下一致
+        FlatHashMap<boost::uuids::uuid, ResourceViews, boost::hash<boost::uuids::uuid>> m_ViewCache;
+    };
+
+} 
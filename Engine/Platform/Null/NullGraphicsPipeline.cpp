@@ -0,0 +1,18 @@
+#include "hzpch.h"
+#include "NullGraphicsPipeline.h"
+#include "NullRHIStats.h"
+
+namespace Hazel {
+
+    std::atomic<uint64_t> NullGraphicsPipeline::s_NextHandleId{ 1 };
+
+    NullGraphicsPipeline::NullGraphicsPipeline(const GraphicsPipelineDesc& desc)
+        : m_Description(desc)
+    {
+        // D3D12在这里编译PSO，是最贵的一步，每次创建都要计数
+        m_Handle.id = s_NextHandleId.fetch_add(1, std::memory_order_relaxed);
+        m_Handle.isValid = true;
+        NullRHIStats::Add(NullRHICounter::PipelineCreations);
+    }
+
+} // namespace Hazel
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Runtime/Graphics/RHI/Interface/IGraphicsPipeline.h"
+#include <atomic>
+
+namespace Hazel {
+
+    class NullGraphicsPipeline : public IGraphicsPipeline {
+    public:
+        NullGraphicsPipeline(const GraphicsPipelineDesc& desc);
+        virtual ~NullGraphicsPipeline() = default;
+        
+        // IGraphicsPipeline 实现
+        virtual void Bind() const override {}
+        virtual const GraphicsPipelineDesc& GetDescription() const override { return m_Description; }
+        virtual PipelineStateHandle GetHandle() const override { return m_Handle; }
+        virtual bool IsValid() const override { return m_Handle.IsValid(); }
+        
+    private:
+        GraphicsPipelineDesc m_Description;
+        PipelineStateHandle m_Handle;
+        
+        static std::atomic<uint64_t> s_NextHandleId;
+    };
+
+} // namespace Hazel
@@ -0,0 +1,61 @@
+#include "hzpch.h"
+#include "NullPipelineStateManager.h"
+
+namespace Hazel {
+
+    NullPipelineStateManager::NullPipelineStateManager()
+    {
+    }
+
+    NullPipelineStateManager::~NullPipelineStateManager()
+    {
+        m_PipelineCache.clear();
+    }
+
+    Ref<IGraphicsPipeline> NullPipelineStateManager::CreateGraphicsPipeline(const GraphicsPipelineDesc& desc)
+    {
+        return CreateRef<NullGraphicsPipeline>(desc);
+    }
+
+    Ref<IGraphicsPipeline> NullPipelineStateManager::GetOrCreatePipeline(const GraphicsPipelineDesc& desc)
+    {
+        uint64_t hash = HashPipelineDesc(desc);
+        
+        auto it = m_PipelineCache.find(hash);
+        if (it != m_PipelineCache.end()) {
+            if (auto pipeline = it->second.lock()) {
+                return pipeline;
+            }
+            m_PipelineCache.erase(it);
+        }
+        
+        auto pipeline = CreateRef<NullGraphicsPipeline>(desc);
+        m_PipelineCache[hash] = std::weak_ptr<IGraphicsPipeline>(pipeline);
+        
+        // 失效的弱引用由 PipelineCacheSweep 分帧清理
+        return pipeline;
+    }
+
+    void NullPipelineStateManager::GarbageCollect()
+    {
+        auto it = m_PipelineCache.begin();
+        while (it != m_PipelineCache.end()) {
+            if (it->second.expired()) {
+                it = m_PipelineCache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        
+        if (m_PipelineCache.size() > MAX_CACHED_PIPELINES) {
+            HZ_CORE_WARN("Pipeline cache size exceeded limit, clearing cache");
+            m_PipelineCache.clear();
+        }
+    }
+
+    size_t NullPipelineStateManager::GetCachedPipelineCount() const
+    {
+        return m_PipelineCache.size();
+    }
+
+} // namespace Hazel
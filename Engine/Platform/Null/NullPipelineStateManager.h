@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Runtime/Graphics/RHI/Interface/IPipelineStateManager.h"
+#include "NullGraphicsPipeline.h"
+
+namespace Hazel {
+
+    // 缓存策略和D3D12PipelineStateManager相同，缓存未命中时才会产生 PipelineCreations 计数
+    class NullPipelineStateManager : public IPipelineStateManager {
+    public:
+        NullPipelineStateManager();
+        virtual ~NullPipelineStateManager();
+        
+        // IPipelineStateManager 实现
+        virtual Ref<IGraphicsPipeline> CreateGraphicsPipeline(const GraphicsPipelineDesc& desc) override;
+        virtual Ref<IGraphicsPipeline> GetOrCreatePipeline(const GraphicsPipelineDesc& desc) override;
+        virtual void GarbageCollect() override;
+        virtual size_t GetCachedPipelineCount() const override;
+        
+    private:
+        static constexpr size_t MAX_CACHED_PIPELINES = 1000;
+    };
+
+} // namespace Hazel
@@ -0,0 +1,80 @@
+#include "hzpch.h"
+#include "NullRHIStats.h"
+
+namespace Hazel {
+
+    std::atomic<uint64_t> NullRHIStats::s_Current[(size_t)NullRHICounter::Count] = {};
+    std::mutex NullRHIStats::s_SnapshotMutex;
+    NullRHIFrameStats NullRHIStats::s_LastFrame;
+    NullRHIFrameStats NullRHIStats::s_Total;
+    uint64_t NullRHIStats::s_FrameCount = 0;
+
+    const char* NullRHICounterToString(NullRHICounter counter) {
+        switch (counter) {
+            case NullRHICounter::DrawCalls:                     return "DrawCalls";
+            case NullRHICounter::IndicesSubmitted:              return "IndicesSubmitted";
+            case NullRHICounter::VerticesSubmitted:             return "VerticesSubmitted";
+            case NullRHICounter::PipelineStateChanges:          return "PipelineStateChanges";
+            case NullRHICounter::RedundantPipelineStateChanges: return "RedundantPipelineStateChanges";
+            case NullRHICounter::VertexArrayBinds:              return "VertexArrayBinds";
+            case NullRHICounter::RedundantVertexArrayBinds:     return "RedundantVertexArrayBinds";
+            case NullRHICounter::ResourceBarriers:              return "ResourceBarriers";
+            case NullRHICounter::RenderTargetClears:            return "RenderTargetClears";
+            case NullRHICounter::CommandListsExecuted:          return "CommandListsExecuted";
+            case NullRHICounter::DescriptorAllocations:         return "DescriptorAllocations";
+            case NullRHICounter::PipelineCreations:             return "PipelineCreations";
+            case NullRHICounter::BytesUploaded:                 return "BytesUploaded";
+            default:                                            return "Unknown";
+        }
+    }
+
+    void NullRHIStats::EndFrame() {
+        std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+        for (size_t i = 0; i < (size_t)NullRHICounter::Count; i++) {
+            uint64_t value = s_Current[i].exchange(0, std::memory_order_relaxed);
+            s_LastFrame.Counters[i] = value;
+            s_Total.Counters[i] += value;
+        }
+        s_FrameCount++;
+    }
+
+    void NullRHIStats::Reset() {
+        std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+        for (auto& counter : s_Current) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+        s_LastFrame = NullRHIFrameStats{};
+        s_Total = NullRHIFrameStats{};
+        s_FrameCount = 0;
+    }
+
+    NullRHIFrameStats NullRHIStats::GetCurrentFrame() {
+        NullRHIFrameStats stats;
+        for (size_t i = 0; i < (size_t)NullRHICounter::Count; i++) {
+            stats.Counters[i] = s_Current[i].load(std::memory_order_relaxed);
+        }
+        return stats;
+    }
+
+    NullRHIFrameStats NullRHIStats::GetLastFrame() {
+        std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+        return s_LastFrame;
+    }
+
+    NullRHIFrameStats NullRHIStats::GetTotal() {
+        std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+        return s_Total;
+    }
+
+    uint64_t NullRHIStats::GetFrameCount() {
+        std::lock_guard<std::mutex> lock(s_SnapshotMutex);
+        return s_FrameCount;
+    }
+
+    void NullRHIStats::Print(const NullRHIFrameStats& stats) {
+        for (size_t i = 0; i < (size_t)NullRHICounter::Count; i++) {
+            HZ_CORE_INFO("  {0}: {1}", NullRHICounterToString((NullRHICounter)i), stats.Counters[i]);
+        }
+    }
+
+} // namespace Hazel
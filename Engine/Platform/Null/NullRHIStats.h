@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace Hazel {
+
+    // Null 后端记录的计数项
+    enum class NullRHICounter : uint32_t {
+        DrawCalls = 0,
+        IndicesSubmitted,               // indexCount * instanceCount
+        VerticesSubmitted,              // 非索引绘制的 vertexCount * instanceCount
+        PipelineStateChanges,
+        RedundantPipelineStateChanges,  // 设置的管线和当前绑定的相同
+        VertexArrayBinds,
+        RedundantVertexArrayBinds,
+        ResourceBarriers,
+        RenderTargetClears,
+        CommandListsExecuted,
+        DescriptorAllocations,          // 按描述符个数计，不是调用次数
+        PipelineCreations,
+        BytesUploaded,
+        Count
+    };
+
+    const char* NullRHICounterToString(NullRHICounter counter);
+
+    struct NullRHIFrameStats {
+        uint64_t Counters[(size_t)NullRHICounter::Count] = {};
+
+        inline uint64_t Get(NullRHICounter counter) const { return Counters[(size_t)counter]; }
+    };
+
+    // Null 后端的全局计数器
+    // - 任意线程都可以 Add，只是一次 relaxed 原子加
+    // - 帧边界由 NullCommandListManager::EndFrame 推进：当前帧存为 LastFrame，累加进 Total，然后清零
+    class HAZEL_API NullRHIStats {
+    public:
+        static inline void Add(NullRHICounter counter, uint64_t value = 1) {
+            s_Current[(size_t)counter].fetch_add(value, std::memory_order_relaxed);
+        }
+
+        static void EndFrame();
+        static void Reset();
+
+        static NullRHIFrameStats GetCurrentFrame();
+        static NullRHIFrameStats GetLastFrame();
+        static NullRHIFrameStats GetTotal();
+        static uint64_t GetFrameCount();
+
+        static void Print(const NullRHIFrameStats& stats);
+
+    private:
+        static std::atomic<uint64_t> s_Current[(size_t)NullRHICounter::Count];
+
+        static std::mutex s_SnapshotMutex;
+        static NullRHIFrameStats s_LastFrame;
+        static NullRHIFrameStats s_Total;
+        static uint64_t s_FrameCount;
+    };
+
+} // namespace Hazel
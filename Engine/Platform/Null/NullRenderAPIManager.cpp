@@ -0,0 +1,15 @@
+#include "hzpch.h"
+#include "NullRenderAPIManager.h"
+#include "NullRHIStats.h"
+
+namespace Hazel {
+
+    NullRenderAPIManager::NullRenderAPIManager() {
+        NullRHIStats::Reset();
+        HZ_CORE_INFO("NullRenderAPIManager initialized, GPU work will be recorded but not submitted");
+    }
+
+    NullRenderAPIManager::~NullRenderAPIManager() {
+    }
+
+} // namespace Hazel
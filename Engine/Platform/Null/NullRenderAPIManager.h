@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Runtime/Graphics/RenderAPIManager.h"
+
+namespace Hazel {
+
+    // 不连接任何图形设备的后端，所有资源都在CPU内存里，命令只记录和计数（见 NullRHIStats）
+    // 用于没有GPU的机器上跑自动化测试、测量渲染前端的CPU开销
+    class NullRenderAPIManager final : public RenderAPIManager {
+    public:
+        NullRenderAPIManager();
+        virtual ~NullRenderAPIManager();
+    };
+
+} // namespace Hazel
@@ -0,0 +1,27 @@
+#include "hzpch.h"
+#include "NullTextureBuffer.h"
+#include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
+
+namespace Hazel 
+{
+	NullTextureBuffer::NullTextureBuffer(const TextureBufferSpecification& spec)
+		: m_Spec(spec)
+	{
+		m_UUID = Unique::GetUUID();
+		m_TextureRenderUsage = spec.textureRenderUsage;
+		m_CpuHandle = uint32_t(0);
+		m_BufferResource = uint32_t(0);
+	}
+
+	NullTextureBuffer::~NullTextureBuffer()
+	{
+		IGfxViewManager::Get().OnResourceDestroyed(m_UUID);
+	}
+
+	void NullTextureBuffer::Resize(const glm::vec2& viewportSize)
+	{
+		m_Spec.width = (uint32_t)viewportSize.x;
+		m_Spec.height = (uint32_t)viewportSize.y;
+	}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include "Runtime/Graphics/Texture/TextureBuffer.h"
+
+namespace Hazel 
+{
+	// 只记录规格和当前的使用状态，不分配像素内存
+	class NullTextureBuffer : public TextureBuffer
+	{
+	public:
+		NullTextureBuffer(const TextureBufferSpecification& spec);
+		virtual ~NullTextureBuffer();
+
+		virtual void Bind() override {};
+		virtual void Unbind() override {};
+		virtual void RebindColorAttachment(uint32_t colorAttachmentID, TextureBufferSpecification spec) override { m_Spec = spec; };
+		virtual void RebindDepthAttachment(uint32_t depthAttachmentID, TextureBufferSpecification spec) override { m_Spec = spec; };
+		virtual void RebindColorAndDepthAttachment(uint32_t colorAttachmentID, uint32_t depthAttachmentID, TextureBufferSpecification spec) override { m_Spec = spec; };
+
+		virtual void Resize(const glm::vec2& viewportSize) override;
+		virtual uint32_t GetColorAttachmentRendererID() const override { return 0; };
+		virtual uint32_t GetDepthAttachmentRendererID() const override { return 0; };
+		virtual std::any GetRendererID() const override { return 0; };
+
+		virtual const TextureBufferSpecification& GetSpecification() const override { return m_Spec; };
+
+		// 没有原生资源
+		virtual void* GetNativeResource() const override { return nullptr; }
+
+	private:
+		TextureBufferSpecification m_Spec;
+	};
+
+}
@@ -0,0 +1,24 @@
+#include "hzpch.h"
+#include "NullVertexArray.h"
+
+namespace Hazel 
+{
+	NullVertexArray::NullVertexArray()
+	{
+	}
+
+	NullVertexArray::~NullVertexArray()
+	{
+	}
+
+	void NullVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
+	{
+		m_UnnamedVertexBuffers.push_back(vertexBuffer);
+	}
+
+	void NullVertexArray::SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer)
+	{
+		m_IndexBuffer = indexBuffer;
+	}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Runtime/Graphics/RHI/Core/VertexArray.h"
+
+namespace Hazel {
+
+	class NullVertexArray final : public VertexArray
+	{
+	public:
+		NullVertexArray();
+		virtual ~NullVertexArray();
+
+		virtual void Bind() const override {}
+		virtual void Unbind() const override {}
+
+		virtual void AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer) override;
+		virtual void SetIndexBuffer(const Ref<IndexBuffer>& indexBuffer) override;
+
+		virtual const Ref<IndexBuffer>& GetIndexBuffer() const override { return m_IndexBuffer; };
+	private:
+		// 不带 VertexProperty 的旧接口，保留下来只为和D3D12VertexArray行为一致
+		std::vector<Ref<VertexBuffer>> m_UnnamedVertexBuffers;
+		Ref<IndexBuffer> m_IndexBuffer;
+	};
+}
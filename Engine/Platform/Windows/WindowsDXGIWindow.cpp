@@ -28,8 +28,8 @@ namespace Hazel
 
 	//while(msg.message != WM_QUIT)
 	//{
-		// If there are Window messages then process them.
-		if(PeekMessage( &msg, 0, 0, 0, PM_REMOVE ))
+		// Pump every pending Window message, events end up in the application's EventQueue.
+		while(PeekMessage( &msg, 0, 0, 0, PM_REMOVE ))
 		{
             TranslateMessage( &msg );
             DispatchMessage( &msg );
@@ -2,6 +2,7 @@
 #include "MaterialLibrary.h"
 #include "Runtime/Graphics/Material/Material.h"
 #include "Runtime/Graphics/Material/MaterialSerializer.h"
+#include "Runtime/Core/Threading/TimeSlicedScheduler.h"
 
 namespace Hazel 
 {
@@ -14,6 +15,7 @@ namespace Hazel
 	// ✅ 主要材质加载入口 - 智能缓存系统
 	Ref<Material> MaterialLibrary::LoadMaterial(const std::string& path)
 	{
+		HZ_MEMORY_TAG(Material);
 		// 1. 检查弱指针缓存
 		auto pathIt = m_PathCache.find(path);
 		if (pathIt != m_PathCache.end()) {
@@ -257,6 +259,12 @@ namespace Hazel
 		}
 	}
 
+	bool MaterialLibrary::CleanupExpiredEntriesStep(size_t maxBuckets)
+	{
+		return SweepBuckets(m_PathCache, m_SweepCursor, maxBuckets,
+			[](const auto& entry) { return entry.second.expired(); });
+	}
+
 	bool MaterialLibrary::IsFileModified(const std::string& path, std::filesystem::file_time_type cachedTime) const
 	{
 		try {
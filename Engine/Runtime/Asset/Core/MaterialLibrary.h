@@ -38,6 +38,8 @@ namespace Hazel
 		void ClearCache();
 		void ClearPathCache();  // 只清理路径缓存
 		void ClearNamedMaterials();  // 只清理命名材质
+		// 分步清理失效的路径缓存，每次最多检查 maxBuckets 个桶，扫完一遍返回 true（后台任务用）
+		bool CleanupExpiredEntriesStep(size_t maxBuckets);
 		size_t GetCacheSize() const;
 		size_t GetPathCacheSize() const;
 		bool IsCached(const std::string& path) const;
@@ -65,6 +67,7 @@ namespace Hazel
 				: material(mat), lastModified(modified), lastAccess(std::chrono::steady_clock::now()) {}
 		};
 		std::unordered_map<std::string, SmartCacheEntry> m_SmartCache;
+		size_t m_SweepCursor = 0;
 		
 		// 内部辅助方法
 		void CleanupExpiredEntries();
@@ -2,7 +2,19 @@
 #include "Application.h"
 
 #include "Runtime/Core/Log/Log.h"
-#include "Glfw/glfw3.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Core/Threading/InitGraph.h"
+#include "Runtime/Core/Memory/Allocator/FrameArena.h"
+#include "Runtime/Core/Memory/MemoryTracker.h"
+#include "Runtime/Debug/PerfCounters.h"
+#include "Runtime/Graphics/RHI/Interface/PerFrameCommandListAllocator.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#include "Platform/Null/NullRenderAPIManager.h"
+#include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
+#include "Runtime/Graphics/RHI/Interface/IPipelineStateManager.h"
+#include "Runtime/Graphics/RHI/Interface/IGfxViewManager.h"
+#include "Runtime/Asset/Core/MaterialLibrary.h"
 
 namespace Hazel{
 
@@ -13,29 +25,154 @@ namespace Hazel{
 	
 	Application* Application::s_Instance = nullptr;
 
-	Application::Application(std::string title) : m_title(title)
+	Application::Application(std::string title)
+		: Application(ApplicationSpecification{ title })
+	{
+	}
+
+	Application::Application(const ApplicationSpecification& specification)
+		: m_title(specification.Name), m_Specification(specification)
 	{
 		HZ_CORE_ASSERT(!s_Instance, "Application already exists");
+#ifndef HZ_PLATFORM_WINDOWS
+		// no window / GPU backend on this platform
+		m_Specification.Headless = true;
+#endif
 		s_Instance = this;
-		WindowProps props;
-		props.Title = title;
-		m_Window = Scope<Window>(Window::Create(props));
-		m_Window->SetEventCallback(BIND_EVENT_FN(OnEvent));
-		
-		// ��ʼ��RenderAPI, ��ʵ������е����� 
-		// ����ôд�ɣ�����ط�����Ƚϼ򵥣�����Ҫ�ڱ�ĵط��ܼ�ȡ��devices��
-		//m_RenderAPIManager = Ref<RenderAPIManager>(RenderAPIManager::Create());
-		RenderAPIManager::Register<D3D12RenderAPIManager>();
-		RenderAPIManager::getInstance();
-		//GfxViewManager::getInstance()->Init();
-
-		m_Window->SetBackGroundColor();
-		m_ImGuiLayer = new ImGuiLayer();
-		PushOverlay(m_ImGuiLayer);
+		m_StartupBegin = Clock::Now();
+		m_BackgroundTasks.SetBudgetMs(m_Specification.BackgroundTaskBudgetMs);
+		m_FrameTimer.SetTargetFrameRate((float)m_Specification.TargetFrameRate);
+		// shared worker pool for asset loading / culling / command recording
+		JobSystem::Initialize();
+
+		m_EventHandlers.Bind<&Application::OnWindowClose>(this);
+		m_EventHandlers.Bind<&Application::OnWindowResize>(this);
+		m_EventHandlers.Bind<&Application::OnMouseButtonPressed>(this);
+		m_EventHandlers.Bind<&Application::OnAppActiveStateChange>(this);
+
+		// window / device / ImGui must be created on the main thread, independent CPU setup runs alongside
+		InitGraph startup("Application");
+
+		startup.Add("FrameArena", []()
+		{
+			// per-frame scratch memory is recycled on the same cadence as the command list allocators
+			FrameArenaConfig arenaConfig;
+			arenaConfig.FramesInFlight = PerFrameCommandListAllocator::Config().framesInFlight;
+			FrameArena::Get().Initialize(arenaConfig);
+		});
+
+		startup.Add("Window", [this]()
+		{
+			WindowProps props;
+			props.Title = m_title;
+			if (m_Specification.Headless)
+				m_Window = Scope<Window>(new HeadlessWindow(props));
+			else
+				m_Window = Scope<Window>(Window::Create(props));
+			// OS callbacks only record events, they are dispatched once per frame in Run()
+			m_Window->SetEventCallback(BIND_EVENT_FN(QueueEvent));
+		}, {}, InitThread::Main);
+
+		startup.Add("RenderAPI", [this]()
+		{
+			// headless: layers only run CPU side work, RHI calls go to the Null backend and nothing is presented
+			if (m_Specification.Headless)
+			{
+#ifdef HZ_RHI_STATIC_DISPATCH
+				HZ_CORE_ASSERT(s_BackendAPI == RenderAPI::API::Null, "Headless mode needs the Null backend in a static dispatch build (--rhi-static=null)");
+#endif
+				RenderAPI::SetAPI(RenderAPI::API::Null);
+				RenderAPIManager::Register<NullRenderAPIManager>();
+				RenderAPIManager::getInstance();
+				return;
+			}
+#ifdef HZ_PLATFORM_WINDOWS
+			// ��ʼ��RenderAPI, ��ʵ������е����� 
+			// ����ôд�ɣ�����ط�����Ƚϼ򵥣�����Ҫ�ڱ�ĵط��ܼ�ȡ��devices��
+			//m_RenderAPIManager = Ref<RenderAPIManager>(RenderAPIManager::Create());
+			RenderAPIManager::Register<D3D12RenderAPIManager>();
+			RenderAPIManager::getInstance();
+			//GfxViewManager::getInstance()->Init();
+#endif
+		}, { "Window" }, InitThread::Main);
+
+		startup.Add("ImGui", [this]()
+		{
+			if (m_Specification.Headless)
+				return;
+#ifdef HZ_PLATFORM_WINDOWS
+			m_Window->SetBackGroundColor();
+			m_ImGuiLayer = new ImGuiLayer();
+			PushOverlay(m_ImGuiLayer);
+#endif
+		}, { "RenderAPI" }, InitThread::Main);
+
+		if (!startup.Run())
+		{
+			// window / RHI may be missing, nothing after this point is safe to run
+			HZ_CORE_ERROR("Application: startup failed, see the init report below");
+			startup.LogReport();
+			m_StartupFailed = true;
+			m_Running = false;
+			m_ExitCode = 1;
+			return;
+		}
+		startup.LogReport();
+
+		RegisterEngineBackgroundTasks();
+	}
+
+	void Application::RegisterEngineBackgroundTasks()
+	{
+		// expired weak references in the caches are swept a few buckets at a time; GetOrCreatePipeline
+		// no longer runs a full GarbageCollect scan when the cache grows past a threshold
+		BackgroundTaskDesc pipelineSweep;
+		pipelineSweep.Name = "PipelineCacheSweep";
+		pipelineSweep.IntervalMs = 1000.0;
+		pipelineSweep.Step = [](const TimeSlice& slice)
+		{
+			IPipelineStateManager& manager = IPipelineStateManager::Get();
+			do
+			{
+				if (manager.CollectExpiredStep(64))
+					return SliceResult::Done;
+			} while (slice.HasTime());
+			return SliceResult::Continue;
+		};
+		m_BackgroundTasks.Register(pipelineSweep);
+
+		BackgroundTaskDesc materialSweep;
+		materialSweep.Name = "MaterialCacheSweep";
+		materialSweep.Priority = BackgroundPriority::Low;
+		materialSweep.IntervalMs = 2000.0;
+		materialSweep.Step = [](const TimeSlice& slice)
+		{
+			MaterialLibrary& library = MaterialLibrary::Get();
+			do
+			{
+				if (library.CleanupExpiredEntriesStep(64))
+					return SliceResult::Done;
+			} while (slice.HasTime());
+			return SliceResult::Continue;
+		};
+		m_BackgroundTasks.Register(materialSweep);
+
+		BackgroundTaskDesc viewGC;
+		viewGC.Name = "GfxViewGarbageCollect";
+		viewGC.Priority = BackgroundPriority::Low;
+		viewGC.IntervalMs = 1000.0;
+		viewGC.Step = [](const TimeSlice&)
+		{
+			IGfxViewManager::Get().GarbageCollect();
+			return SliceResult::Done;
+		};
+		m_BackgroundTasks.Register(viewGC);
 	}
 
 	Application::~Application()
 	{
+		JobSystem::Shutdown();
+		FrameArena::Get().Shutdown();
 	}
 
 	void Application::PushLayer(Layer* layer)
@@ -59,11 +196,7 @@ namespace Hazel{
 	void Application::OnEvent(Event& e)
 	{
 		
-		EventDispatcher dispatcher(e);
-		dispatcher.Dispatch<WindowCloseEvent>(BIND_EVENT_FN(OnWindowClose));
-		dispatcher.Dispatch<WindowResizeEvent>(BIND_EVENT_FN(OnWindowResize));
-		dispatcher.Dispatch<MouseButtonPressedEvent>(BIND_EVENT_FN(OnMouseButtonPressed));
-		dispatcher.Dispatch<AppActiveEvent>(BIND_EVENT_FN(OnAppActiveStateChange));
+		m_EventHandlers.Dispatch(e);
 		//HZ_CORE_INFO("{0}", e);
 
 		for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); )
@@ -74,30 +207,111 @@ namespace Hazel{
 		}
 	}
 	
+	void Application::QueueEvent(Event& e)
+	{
+		m_EventQueue.Push(e);
+	}
+
 	void Application::Run()
 	{
+		if (m_StartupFailed)
+			return;
+		const Clock::TimePoint runStart = Clock::Now();
+		uint64_t framesRun = 0;
+		uint64_t reportedViolations = 0;
+
+		// headless runs always keep every frame for the summary, the editor only the HUD history
+		const bool recordCounters = m_Specification.Headless || !m_Specification.PerfCountersOutputPath.empty();
+		if (recordCounters)
+			PerfCounters::BeginRecording(m_Specification.MaxFrames);
+		if (m_Specification.SteadyStateGuardWarmupFrames && !MemoryTracker::IsEnabled())
+			HZ_CORE_WARN("SteadyStateGuard requested but memory tracking is off in this build (premake --memory-tracking)");
 
-		while (true) 
+		while (m_Running) 
 		{
+			Timestep timestep = m_FrameTimer.BeginFrame();
+			FrameArena::Get().BeginFrame(m_FrameTimer.GetStats().FrameIndex);
+			MemoryTracker::BeginFrame();
+			if (m_Specification.SteadyStateGuardWarmupFrames && framesRun == m_Specification.SteadyStateGuardWarmupFrames)
+				MemoryTracker::SetSteadyStateGuard(true);
 			m_Window->OnUpdate();
+			m_EventQueue.Drain([this](Event& e) { OnEvent(e); });
 			//m_RenderAPIManager->OnUpdate();
-			//float time = (float)glfwGetTime();		// platform gettime();
-			//Timestep timestep = time - m_LastFrameTime;
-			//m_LastFrameTime = time;
 
 			if (!m_Minimized) 
 			{
+				// fixed step simulation first, layers read the interpolation alpha in OnUpdate
+				uint32_t fixedSteps = m_FrameTimer.ConsumeFixedSteps();
+				Timestep fixedTimestep = m_FrameTimer.GetFixedTimestep();
+				for (uint32_t step = 0; step < fixedSteps; step++)
+				{
+					for (Layer* layer : m_LayerStack)
+						layer->OnFixedUpdate(fixedTimestep);
+				}
+
+				for (Layer* layer : m_LayerStack)
+					layer->OnUpdate(timestep);
+			}
+			else
+			{
+				m_FrameTimer.ResetAccumulator();
+			}
+#ifdef HZ_PLATFORM_WINDOWS
+			if (m_ImGuiLayer)
+			{
+				// ÿһ���������ImGui�㣬����Ⱦ��
+				m_ImGuiLayer->Begin();
 				for (Layer* layer : m_LayerStack)
-					layer->OnUpdate(0.01f);
+					layer->OnImGuiRender();
+				m_ImGuiLayer->End();
 			}
-			// ÿһ���������ImGui�㣬����Ⱦ��
-			m_ImGuiLayer->Begin();
-			for (Layer* layer : m_LayerStack)
-				layer->OnImGuiRender();
-			m_ImGuiLayer->End();
+#endif
+
+			// last in the frame, counted in the cpu frame time
+			m_BackgroundTasks.RunFrame(m_FrameTimer.GetStats().FrameIndex);
 
 			//m_Window->OnUpdate();
+			m_FrameTimer.EndFrame();
+			if (framesRun == 0)
+			{
+				m_TimeToFirstFrameMs = Clock::ElapsedSeconds(m_StartupBegin, Clock::Now()) * 1000.0;
+				HZ_CORE_INFO("Startup: time to first frame {0:.1f} ms", m_TimeToFirstFrameMs);
+			}
+			PerfCounters::EndFrame(m_FrameTimer.GetStats().FrameIndex, m_FrameTimer.GetStats().CpuFrameMs);
+			HZ_PROFILE_FRAME_MARK();
+
+			uint64_t violations = MemoryTracker::GetGuardViolationCount();
+			if (violations != reportedViolations)
+			{
+				HZ_CORE_ERROR_RATE_LIMITED(1, "Memory: {0} tagged allocations in steady state (frame {1})", violations - reportedViolations, framesRun);
+				reportedViolations = violations;
+			}
+
+			// frame / time budget, used by headless benchmark and CI runs
+			framesRun++;
+			if (m_Specification.MaxFrames && framesRun >= m_Specification.MaxFrames)
+				m_Running = false;
+			if (m_Specification.MaxRunSeconds > 0.0 && Clock::ElapsedSeconds(runStart, Clock::Now()) >= m_Specification.MaxRunSeconds)
+				m_Running = false;
 		};
+
+		MemoryTracker::SetSteadyStateGuard(false);
+		if (MemoryTracker::GetGuardViolationCount() > 0)
+			m_ExitCode = 1;
+		if (m_Specification.Headless)
+		{
+			MemoryTracker::LogReport();
+			m_BackgroundTasks.LogReport();
+		}
+
+		if (recordCounters)
+		{
+			PerfCounters::EndRecording();
+			if (m_Specification.Headless)
+				PerfCounters::LogSummary();
+			if (!m_Specification.PerfCountersOutputPath.empty())
+				PerfCounters::WriteRecording(m_Specification.PerfCountersOutputPath);
+		}
 	}
 
 	bool Application::OnWindowClose(WindowCloseEvent& e) 
@@ -3,6 +3,8 @@
 #include "Runtime/Core/Core.h"
 #include "Runtime/Core/Events/Event.h"
 #include "Runtime/Core/Events/ApplicationEvent.h"
+#include "Runtime/Core/Events/EventQueue.h"
+#include "Runtime/Core/Events/EventDispatchTable.h"
 
 #include "Runtime/Core/Window/Window.h"
 #include "Runtime/Graphics/RenderAPIManager.h"
@@ -11,20 +13,51 @@
 #include "ImGui/ImGuiLayer.h"
 
 #include "Runtime/Core/Time/Timestep.h"
+#include "Runtime/Core/Time/FrameTimer.h"
+#include "Runtime/Core/Threading/TimeSlicedScheduler.h"
 
 
 namespace Hazel 
 {
 
+	struct ApplicationSpecification
+	{
+		std::string Name = "Hazel Engine";
+		// no OS window, no render API and no ImGui layer; the layer stack still runs every frame.
+		// Used for benchmarks and CI perf runs, and the only mode supported on Linux.
+		bool Headless = false;
+		// Run() returns after this many frames / seconds, 0 = until Close()
+		uint64_t MaxFrames = 0;
+		double MaxRunSeconds = 0.0;
+		// after this many warmup frames any heap allocation inside a tagged scope (HZ_MEMORY_TAG)
+		// counts as a violation and the run exits with a non-zero code, 0 = off
+		uint64_t SteadyStateGuardWarmupFrames = 0;
+		// per frame hot path counters (PerfCounters) are written here when Run() returns,
+		// ".json" for JSON, anything else CSV; empty = don't write
+		std::string PerfCountersOutputPath;
+		// main thread time per frame for time sliced background work (cache sweeps ...)
+		double BackgroundTaskBudgetMs = 1.0;
+		// FrameTimer sleeps out the rest of each frame to hold this rate, 0 = unpaced
+		double TargetFrameRate = 0.0;
+	};
+
 	class HAZEL_API Application
 	{
 	public:
 		Application(std::string title);
+		Application(const ApplicationSpecification& specification);
 		virtual ~Application();
 
 		void Run();
+		// process exit code, non-zero when startup failed or the steady-state memory guard tripped
+		inline int GetExitCode() const { return m_ExitCode; }
+		// the startup graph failed: no window / RHI, Run() returns immediately and derived
+		// applications must not push layers that use them
+		inline bool HasStartupFailed() const { return m_StartupFailed; }
 	
 		void OnEvent(Event& e);
+		// thread safe, buffered until the next frame's event stage
+		void QueueEvent(Event& e);
 
 		void PushLayer(Layer* layer);
 		void PushOverlay(Layer* layer);
@@ -32,7 +65,10 @@ namespace Hazel
 
 		inline static Application& Get() { return *s_Instance; }
 		inline void SetApplicationRunning(const bool& run) { m_Running = run; }
+		// nullptr in headless mode
 		inline ImGuiLayer* GetImGuiLayer() { return m_ImGuiLayer; }
+		inline bool IsHeadless() const { return m_Specification.Headless; }
+		inline const ApplicationSpecification& GetSpecification() const { return m_Specification; }
 		inline void SetApplicationMinimized(const bool& isMinimized) { m_Minimized = isMinimized; }
 		inline void SetApplicationMaximized(const bool& isMaximized) { m_Maximized = isMaximized; }
 		inline int GetWindowWidth() { return m_WindowWidth; }
@@ -41,22 +77,39 @@ namespace Hazel
 		inline void SetWindowHeight(const int& windowHeight) { m_WindowHeight = windowHeight; }
 
 		inline Window& GetWindow() { return *m_Window; }
+		// frame timing: delta / fixed step / interpolation alpha / cpu frame stats
+		inline FrameTimer& GetFrameTimer() { return m_FrameTimer; }
+		inline EventQueue& GetEventQueue() { return m_EventQueue; }
+		// resumable low priority work, run on the main thread at the end of every frame within a budget
+		inline TimeSlicedScheduler& GetBackgroundTasks() { return m_BackgroundTasks; }
+		inline const FrameStats& GetFrameStats() const { return m_FrameTimer.GetStats(); }
+		// from the start of the constructor to the end of the first frame, 0 until then
+		inline double GetTimeToFirstFrameMs() const { return m_TimeToFirstFrameMs; }
 		std::string m_title;
 	private:
 		bool OnWindowClose(WindowCloseEvent& e);
 		bool OnWindowResize(WindowResizeEvent& e);
 		bool OnAppActiveStateChange(AppActiveEvent& e);
 		bool OnMouseButtonPressed(MouseButtonPressedEvent& e);
+		void RegisterEngineBackgroundTasks();
 	private:
+		ApplicationSpecification m_Specification;
 		Scope<Window> m_Window;
-		ImGuiLayer* m_ImGuiLayer;
+		ImGuiLayer* m_ImGuiLayer = nullptr;
 		bool m_Running = true;
 		bool m_Minimized = false;
 		bool m_Maximized = true;
 		LayerStack m_LayerStack;
-		float m_LastFrameTime = 0.0f;
+		FrameTimer m_FrameTimer;
+		EventQueue m_EventQueue;
+		EventDispatchTable m_EventHandlers;
+		TimeSlicedScheduler m_BackgroundTasks;
 		int m_WindowWidth = 0;
 		int m_WindowHeight = 0;
+		int m_ExitCode = 0;
+		bool m_StartupFailed = false;
+		Clock::TimePoint m_StartupBegin;
+		double m_TimeToFirstFrameMs = 0.0;
 	private:
 		static Application* s_Instance;
 
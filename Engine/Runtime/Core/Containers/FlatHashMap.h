@@ -0,0 +1,566 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Hazel {
+
+	namespace Detail {
+
+		// std::hash 对整数/指针通常是恒等映射，直接取低位会在 2 的幂大小的表里大量冲突，这里再混一次
+		inline uint64_t MixHash(uint64_t h)
+		{
+			h ^= h >> 33;
+			h *= 0xff51afd7ed558ccdull;
+			h ^= h >> 33;
+			h *= 0xc4ceb9fe1a85ec53ull;
+			h ^= h >> 33;
+			return h;
+		}
+
+		// 按 8 字节一块做乘法混合，不足 8 字节的尾部用重叠读取，避免逐字节循环和变长 memcpy
+		inline uint64_t HashBytes(const void* data, size_t size)
+		{
+			const unsigned char* bytes = static_cast<const unsigned char*>(data);
+			uint64_t h = 0x9E3779B97F4A7C15ull ^ (size * 0xff51afd7ed558ccdull);
+			uint64_t word = 0;
+			if (size >= 8)
+			{
+				for (; size > 8; bytes += 8, size -= 8)
+				{
+					std::memcpy(&word, bytes, 8);
+					h = (h ^ word) * 0xbf58476d1ce4e5b9ull;
+					h ^= h >> 31;
+				}
+				// 最后 8 字节，可能和上一块重叠
+				std::memcpy(&word, bytes + size - 8, 8);
+			}
+			else if (size >= 4)
+			{
+				uint32_t low, high;
+				std::memcpy(&low, bytes, 4);
+				std::memcpy(&high, bytes + size - 4, 4);
+				word = ((uint64_t)high << 32) | low;
+			}
+			else if (size > 0)
+			{
+				word = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[size >> 1] << 8) | bytes[size - 1];
+			}
+			h = (h ^ word) * 0xbf58476d1ce4e5b9ull;
+			return h ^ (h >> 31);
+		}
+
+		struct MapKeyOf
+		{
+			template<typename Pair>
+			static const auto& Get(const Pair& value) { return value.first; }
+		};
+
+		struct SetKeyOf
+		{
+			template<typename Key>
+			static const Key& Get(const Key& value) { return value; }
+		};
+
+		// 开放寻址哈希表（线性探测），FlatHashMap / FlatHashSet 共用
+		// - 每个槽位一个控制字节：空 / 哈希值的低 7 位，探测时先比控制字节，命中才比较键
+		// - 元素和控制字节各自连续存放，查找只在一两条缓存行里走，不像 std::unordered_map 每个节点单独分配
+		// - 删除时把后面同一簇的元素往前挪（backward shift），不留删除标记，频繁增删也不会让探测链变长
+		// - 负载超过 3/4 时扩容；插入、删除、扩容都会让迭代器、指针、引用失效
+		template<typename Key, typename Value, typename KeyOf, typename Hash, typename KeyEqual>
+		class FlatHashTable
+		{
+		protected:
+			static constexpr int8_t s_Empty = -128;
+			static constexpr size_t s_MinCapacity = 8;
+		public:
+			using key_type = Key;
+			using value_type = Value;
+			using size_type = size_t;
+			using hasher = Hash;
+			using key_equal = KeyEqual;
+
+			template<bool IsConst>
+			class Iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = Value;
+				using difference_type = std::ptrdiff_t;
+				using pointer = std::conditional_t<IsConst, const Value*, Value*>;
+				using reference = std::conditional_t<IsConst, const Value&, Value&>;
+
+				Iterator() = default;
+				Iterator(const int8_t* control, pointer slot, const int8_t* controlEnd)
+					: m_Control(control), m_Slot(slot), m_ControlEnd(controlEnd)
+				{
+					SkipEmpty();
+				}
+				// iterator -> const_iterator
+				template<bool OtherConst, typename = std::enable_if_t<IsConst && !OtherConst>>
+				Iterator(const Iterator<OtherConst>& other)
+					: m_Control(other.m_Control), m_Slot(other.m_Slot), m_ControlEnd(other.m_ControlEnd) {}
+
+				reference operator*() const { return *m_Slot; }
+				pointer operator->() const { return m_Slot; }
+
+				Iterator& operator++()
+				{
+					++m_Control;
+					++m_Slot;
+					SkipEmpty();
+					return *this;
+				}
+
+				Iterator operator++(int)
+				{
+					Iterator result = *this;
+					++*this;
+					return result;
+				}
+
+				friend bool operator==(const Iterator& a, const Iterator& b) { return a.m_Control == b.m_Control; }
+				friend bool operator!=(const Iterator& a, const Iterator& b) { return a.m_Control != b.m_Control; }
+			private:
+				void SkipEmpty()
+				{
+					while (m_Control != m_ControlEnd && *m_Control < 0)
+					{
+						++m_Control;
+						++m_Slot;
+					}
+				}
+			private:
+				const int8_t* m_Control = nullptr;
+				pointer m_Slot = nullptr;
+				const int8_t* m_ControlEnd = nullptr;
+
+				template<bool> friend class Iterator;
+				friend class FlatHashTable;
+			};
+
+			using iterator = Iterator<false>;
+			using const_iterator = Iterator<true>;
+		public:
+			FlatHashTable() = default;
+
+			explicit FlatHashTable(size_t capacity)
+			{
+				reserve(capacity);
+			}
+
+			FlatHashTable(const FlatHashTable& other)
+			{
+				CopyFrom(other);
+			}
+
+			FlatHashTable(FlatHashTable&& other) noexcept
+			{
+				Swap(other);
+			}
+
+			FlatHashTable& operator=(const FlatHashTable& other)
+			{
+				if (this != &other)
+				{
+					Release();
+					CopyFrom(other);
+				}
+				return *this;
+			}
+
+			FlatHashTable& operator=(FlatHashTable&& other) noexcept
+			{
+				if (this != &other)
+				{
+					Release();
+					Swap(other);
+				}
+				return *this;
+			}
+
+			~FlatHashTable()
+			{
+				Release();
+			}
+
+			iterator begin() { return iterator(m_Control, m_Slots, m_Control + m_Capacity); }
+			iterator end() { return iterator(m_Control + m_Capacity, m_Slots + m_Capacity, m_Control + m_Capacity); }
+			const_iterator begin() const { return const_iterator(m_Control, m_Slots, m_Control + m_Capacity); }
+			const_iterator end() const { return const_iterator(m_Control + m_Capacity, m_Slots + m_Capacity, m_Control + m_Capacity); }
+			const_iterator cbegin() const { return begin(); }
+			const_iterator cend() const { return end(); }
+
+			bool empty() const { return m_Size == 0; }
+			size_t size() const { return m_Size; }
+			size_t capacity() const { return m_Capacity; }
+
+			void clear()
+			{
+				if (m_Size == 0)
+					return;
+				for (size_t i = 0; i < m_Capacity; i++)
+				{
+					if (m_Control[i] >= 0)
+						m_Slots[i].~Value();
+				}
+				std::memset(m_Control, s_Empty, m_Capacity);
+				m_Size = 0;
+			}
+
+			// 保证放下 count 个元素不再扩容
+			void reserve(size_t count)
+			{
+				size_t required = s_MinCapacity;
+				while (MaxLoad(required) < count)
+					required <<= 1;
+				if (required > m_Capacity)
+					Rehash(required);
+			}
+
+			iterator find(const Key& key)
+			{
+				size_t index = FindIndex(key);
+				return index == s_NotFound ? end() : MakeIterator(index);
+			}
+
+			const_iterator find(const Key& key) const
+			{
+				size_t index = FindIndex(key);
+				return index == s_NotFound ? end() : const_iterator(m_Control + index, m_Slots + index, m_Control + m_Capacity);
+			}
+
+			bool contains(const Key& key) const { return FindIndex(key) != s_NotFound; }
+			size_t count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+			size_t erase(const Key& key)
+			{
+				size_t index = FindIndex(key);
+				if (index == s_NotFound)
+					return 0;
+				EraseAt(index);
+				return 1;
+			}
+
+			// 删除会把后面的元素挪到当前位置，所以不返回下一个迭代器；遍历中删除用 erase_if
+			void erase(const_iterator it)
+			{
+				EraseAt((size_t)(it.m_Control - m_Control));
+			}
+
+			void erase(iterator it)
+			{
+				erase(const_iterator(it));
+			}
+
+			// 删除所有满足 pred(value) 的元素，返回删除个数
+			template<typename Predicate>
+			size_t erase_if(Predicate pred)
+			{
+				if (m_Size == 0)
+					return 0;
+				// 从一个空槽之后开始绕一圈：元素只会在同一簇内往前挪，这样每个元素恰好检查一次
+				size_t mask = m_Capacity - 1;
+				size_t start = 0;
+				while (m_Control[start] != s_Empty)
+					start++;
+				size_t erased = 0;
+				size_t index = (start + 1) & mask;
+				for (size_t visited = 1; visited < m_Capacity; )
+				{
+					if (m_Control[index] != s_Empty && pred(static_cast<const Value&>(m_Slots[index])))
+					{
+						// 后面的元素可能挪到 index，原地再看一次
+						EraseAt(index);
+						erased++;
+						continue;
+					}
+					index = (index + 1) & mask;
+					visited++;
+				}
+				return erased;
+			}
+
+			void swap(FlatHashTable& other) noexcept { Swap(other); }
+		protected:
+			static constexpr size_t s_NotFound = ~size_t(0);
+
+			iterator MakeIterator(size_t index)
+			{
+				return iterator(m_Control + index, m_Slots + index, m_Control + m_Capacity);
+			}
+
+			size_t HashOf(const Key& key) const
+			{
+				return (size_t)MixHash((uint64_t)Hash{}(key));
+			}
+
+			static int8_t ControlOf(size_t hash) { return (int8_t)(hash & 0x7F); }
+			static size_t MaxLoad(size_t capacity) { return capacity - capacity / 4; }
+
+			size_t FindIndex(const Key& key) const
+			{
+				if (m_Size == 0)
+					return s_NotFound;
+				size_t hash = HashOf(key);
+				int8_t control = ControlOf(hash);
+				size_t mask = m_Capacity - 1;
+				for (size_t index = (hash >> 7) & mask;; index = (index + 1) & mask)
+				{
+					int8_t current = m_Control[index];
+					if (current == s_Empty)
+						return s_NotFound;
+					if (current == control && KeyEqual{}(KeyOf::Get(m_Slots[index]), key))
+						return index;
+				}
+			}
+
+			// 已存在返回 {下标, false}，否则在探测路径上的第一个空槽构造新元素
+			// 先查找再扩容：key 已存在时不会让之前拿到的引用 / 迭代器失效
+			template<typename... Args>
+			std::pair<size_t, bool> EmplaceKey(const Key& key, Args&&... args)
+			{
+				size_t hash = HashOf(key);
+				int8_t control = ControlOf(hash);
+				size_t index = 0;
+				if (m_Capacity > 0)
+				{
+					size_t mask = m_Capacity - 1;
+					for (index = (hash >> 7) & mask; m_Control[index] != s_Empty; index = (index + 1) & mask)
+					{
+						if (m_Control[index] == control && KeyEqual{}(KeyOf::Get(m_Slots[index]), key))
+							return { index, false };
+					}
+				}
+
+				// 确实要插入时才扩容，扩容后重新找空槽
+				if (m_Size + 1 > MaxLoad(m_Capacity))
+				{
+					Rehash(m_Capacity == 0 ? s_MinCapacity : m_Capacity * 2);
+					size_t mask = m_Capacity - 1;
+					for (index = (hash >> 7) & mask; m_Control[index] != s_Empty; index = (index + 1) & mask) {}
+				}
+
+				new (&m_Slots[index]) Value(std::forward<Args>(args)...);
+				m_Control[index] = control;
+				m_Size++;
+				return { index, true };
+			}
+
+			void EraseAt(size_t index)
+			{
+				m_Slots[index].~Value();
+				// 把同一簇里后面的元素往前挪，只要它的理想位置不在空洞之后
+				size_t mask = m_Capacity - 1;
+				size_t hole = index;
+				for (size_t next = (hole + 1) & mask; m_Control[next] != s_Empty; next = (next + 1) & mask)
+				{
+					size_t home = (HashOf(KeyOf::Get(m_Slots[next])) >> 7) & mask;
+					if (((next - home) & mask) < ((next - hole) & mask))
+						continue;
+					new (&m_Slots[hole]) Value(std::move(m_Slots[next]));
+					m_Slots[next].~Value();
+					m_Control[hole] = m_Control[next];
+					hole = next;
+				}
+				m_Control[hole] = s_Empty;
+				m_Size--;
+			}
+		private:
+
+			void Rehash(size_t newCapacity)
+			{
+				int8_t* oldControl = m_Control;
+				Value* oldSlots = m_Slots;
+				size_t oldCapacity = m_Capacity;
+
+				m_Control = new int8_t[newCapacity];
+				std::memset(m_Control, s_Empty, newCapacity);
+				m_Slots = std::allocator<Value>().allocate(newCapacity);
+				m_Capacity = newCapacity;
+
+				size_t mask = newCapacity - 1;
+				for (size_t i = 0; i < oldCapacity; i++)
+				{
+					if (oldControl[i] < 0)
+						continue;
+					size_t hash = HashOf(KeyOf::Get(oldSlots[i]));
+					size_t index = (hash >> 7) & mask;
+					while (m_Control[index] != s_Empty)
+						index = (index + 1) & mask;
+					new (&m_Slots[index]) Value(std::move(oldSlots[i]));
+					m_Control[index] = ControlOf(hash);
+					oldSlots[i].~Value();
+				}
+
+				if (oldCapacity)
+				{
+					std::allocator<Value>().deallocate(oldSlots, oldCapacity);
+					delete[] oldControl;
+				}
+			}
+
+			void CopyFrom(const FlatHashTable& other)
+			{
+				if (other.m_Capacity == 0)
+					return;
+				m_Control = new int8_t[other.m_Capacity];
+				m_Slots = std::allocator<Value>().allocate(other.m_Capacity);
+				m_Capacity = other.m_Capacity;
+				std::memcpy(m_Control, other.m_Control, m_Capacity);
+				for (size_t i = 0; i < m_Capacity; i++)
+				{
+					if (m_Control[i] >= 0)
+						new (&m_Slots[i]) Value(other.m_Slots[i]);
+				}
+				m_Size = other.m_Size;
+			}
+
+			void Release()
+			{
+				if (m_Capacity == 0)
+					return;
+				for (size_t i = 0; i < m_Capacity; i++)
+				{
+					if (m_Control[i] >= 0)
+						m_Slots[i].~Value();
+				}
+				std::allocator<Value>().deallocate(m_Slots, m_Capacity);
+				delete[] m_Control;
+				m_Control = nullptr;
+				m_Slots = nullptr;
+				m_Capacity = 0;
+				m_Size = 0;
+			}
+
+			void Swap(FlatHashTable& other) noexcept
+			{
+				std::swap(m_Control, other.m_Control);
+				std::swap(m_Slots, other.m_Slots);
+				std::swap(m_Capacity, other.m_Capacity);
+				std::swap(m_Size, other.m_Size);
+			}
+		private:
+			int8_t* m_Control = nullptr;
+			Value* m_Slots = nullptr;
+			size_t m_Capacity = 0;
+			size_t m_Size = 0;
+		};
+
+	}
+
+	// FlatHashMap / FlatHashSet 的默认哈希：字符串走 HashBytes，其余类型用 std::hash
+	template<typename Key>
+	struct FlatHash : std::hash<Key> {};
+
+	template<>
+	struct FlatHash<std::string>
+	{
+		size_t operator()(const std::string& value) const { return (size_t)Detail::HashBytes(value.data(), value.size()); }
+	};
+
+	template<>
+	struct FlatHash<std::string_view>
+	{
+		size_t operator()(std::string_view value) const { return (size_t)Detail::HashBytes(value.data(), value.size()); }
+	};
+
+	// 开放寻址哈希表，接口和 std::unordered_map 常用部分一致，可以直接替换
+	// 注意：插入/扩容后之前拿到的迭代器、指针、引用都会失效，需要稳定地址的场合继续用 std::unordered_map
+	template<typename Key, typename T, typename Hash = FlatHash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class FlatHashMap : public Detail::FlatHashTable<Key, std::pair<Key, T>, Detail::MapKeyOf, Hash, KeyEqual>
+	{
+		using Base = Detail::FlatHashTable<Key, std::pair<Key, T>, Detail::MapKeyOf, Hash, KeyEqual>;
+	public:
+		using mapped_type = T;
+		using typename Base::iterator;
+		using typename Base::const_iterator;
+
+		using Base::Base;
+
+		template<typename... Args>
+		std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+		{
+			auto [index, inserted] = this->EmplaceKey(key, std::piecewise_construct,
+				std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { this->MakeIterator(index), inserted };
+		}
+
+		template<typename... Args>
+		std::pair<iterator, bool> emplace(const Key& key, Args&&... args)
+		{
+			return try_emplace(key, std::forward<Args>(args)...);
+		}
+
+		std::pair<iterator, bool> insert(const std::pair<Key, T>& value)
+		{
+			return try_emplace(value.first, value.second);
+		}
+
+		template<typename M>
+		std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value)
+		{
+			auto result = try_emplace(key, std::forward<M>(value));
+			if (!result.second)
+				result.first->second = std::forward<M>(value);
+			return result;
+		}
+
+		T& operator[](const Key& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		T& at(const Key& key)
+		{
+			size_t index = this->FindIndex(key);
+			if (index == Base::s_NotFound)
+				throw std::out_of_range("FlatHashMap::at: key not found");
+			return this->MakeIterator(index)->second;
+		}
+
+		const T& at(const Key& key) const
+		{
+			auto it = this->find(key);
+			if (it == this->end())
+				throw std::out_of_range("FlatHashMap::at: key not found");
+			return it->second;
+		}
+	};
+
+	// 开放寻址哈希集合，接口同 std::unordered_set 常用部分
+	template<typename Key, typename Hash = FlatHash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class FlatHashSet : public Detail::FlatHashTable<Key, Key, Detail::SetKeyOf, Hash, KeyEqual>
+	{
+		using Base = Detail::FlatHashTable<Key, Key, Detail::SetKeyOf, Hash, KeyEqual>;
+	public:
+		using typename Base::iterator;
+		using typename Base::const_iterator;
+
+		using Base::Base;
+
+		std::pair<iterator, bool> insert(const Key& key)
+		{
+			auto [index, inserted] = this->EmplaceKey(key, key);
+			return { this->MakeIterator(index), inserted };
+		}
+
+		std::pair<iterator, bool> insert(Key&& key)
+		{
+			auto [index, inserted] = this->EmplaceKey(key, std::move(key));
+			return { this->MakeIterator(index), inserted };
+		}
+	};
+
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Hazel {
+
+	// 有界无锁多生产者多消费者队列（Vyukov 环形队列）
+	// - 每个槽位带一个序号，生产者/消费者各自 CAS 推进位置，不加锁
+	// - 容量固定（向上取整到 2 的幂），满了 TryPush 返回 false，由调用方决定怎么退化
+	// - 元素只在 Push 成功时移动进来，失败时参数保持不变
+	template<typename T>
+	class MPMCQueue
+	{
+	public:
+		static constexpr size_t s_CacheLineSize = 64;
+	public:
+		explicit MPMCQueue(size_t capacity)
+		{
+			size_t size = 2;
+			while (size < capacity)
+				size <<= 1;
+
+			m_Mask = size - 1;
+			m_Cells = std::unique_ptr<Cell[]>(new Cell[size]);
+			for (size_t i = 0; i < size; i++)
+				m_Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		~MPMCQueue()
+		{
+			T value;
+			while (TryPop(value)) {}
+		}
+
+		MPMCQueue(const MPMCQueue&) = delete;
+		MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+		bool TryPush(T&& value)
+		{
+			Cell* cell;
+			size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &m_Cells[pos & m_Mask];
+				size_t seq = cell->Sequence.load(std::memory_order_acquire);
+				intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+				if (diff == 0)
+				{
+					if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					// 槽位还没被消费，队列满
+					return false;
+				}
+				else
+				{
+					pos = m_EnqueuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			new (cell->Storage) T(std::move(value));
+			cell->Sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool TryPop(T& out)
+		{
+			Cell* cell;
+			size_t pos = m_DequeuePos.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				cell = &m_Cells[pos & m_Mask];
+				size_t seq = cell->Sequence.load(std::memory_order_acquire);
+				intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+				if (diff == 0)
+				{
+					if (m_DequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+						break;
+				}
+				else if (diff < 0)
+				{
+					// 槽位还没写入，队列空
+					return false;
+				}
+				else
+				{
+					pos = m_DequeuePos.load(std::memory_order_relaxed);
+				}
+			}
+
+			T* value = std::launder(reinterpret_cast<T*>(cell->Storage));
+			out = std::move(*value);
+			value->~T();
+			cell->Sequence.store(pos + m_Mask + 1, std::memory_order_release);
+			return true;
+		}
+
+		inline size_t GetCapacity() const { return m_Mask + 1; }
+
+		// 并发下只是近似值
+		size_t GetSizeApprox() const
+		{
+			size_t enqueue = m_EnqueuePos.load(std::memory_order_relaxed);
+			size_t dequeue = m_DequeuePos.load(std::memory_order_relaxed);
+			return enqueue > dequeue ? enqueue - dequeue : 0;
+		}
+	private:
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			alignas(T) unsigned char Storage[sizeof(T)];
+		};
+	private:
+		std::unique_ptr<Cell[]> m_Cells;
+		size_t m_Mask = 0;
+
+		// 生产者和消费者的位置各占一条缓存行，避免互相伪共享
+		alignas(s_CacheLineSize) std::atomic<size_t> m_EnqueuePos{ 0 };
+		alignas(s_CacheLineSize) std::atomic<size_t> m_DequeuePos{ 0 };
+	};
+
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace Hazel {
+
+	// 有界无锁单生产者单消费者环形队列
+	// - 只能有一个线程 TryPush、一个线程 TryPop；多对多用 MPMCQueue
+	// - 两端各自缓存对方的位置，只有缓存显示满/空时才去读对方的原子变量，减少缓存行来回
+	// - 容量向上取整到 2 的幂
+	template<typename T>
+	class SPSCQueue
+	{
+	public:
+		static constexpr size_t s_CacheLineSize = 64;
+	public:
+		explicit SPSCQueue(size_t capacity)
+		{
+			size_t size = 2;
+			while (size < capacity)
+				size <<= 1;
+
+			m_Mask = size - 1;
+			m_Cells = std::unique_ptr<Cell[]>(new Cell[size]);
+		}
+
+		~SPSCQueue()
+		{
+			T value;
+			while (TryPop(value)) {}
+		}
+
+		SPSCQueue(const SPSCQueue&) = delete;
+		SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+		bool TryPush(T&& value)
+		{
+			size_t tail = m_Tail.load(std::memory_order_relaxed);
+			if (tail - m_CachedHead > m_Mask)
+			{
+				m_CachedHead = m_Head.load(std::memory_order_acquire);
+				if (tail - m_CachedHead > m_Mask)
+					return false;
+			}
+
+			new (m_Cells[tail & m_Mask].Storage) T(std::move(value));
+			m_Tail.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+
+		bool TryPush(const T& value)
+		{
+			T copy(value);
+			return TryPush(std::move(copy));
+		}
+
+		bool TryPop(T& out)
+		{
+			size_t head = m_Head.load(std::memory_order_relaxed);
+			if (head == m_CachedTail)
+			{
+				m_CachedTail = m_Tail.load(std::memory_order_acquire);
+				if (head == m_CachedTail)
+					return false;
+			}
+
+			T* value = std::launder(reinterpret_cast<T*>(m_Cells[head & m_Mask].Storage));
+			out = std::move(*value);
+			value->~T();
+			m_Head.store(head + 1, std::memory_order_release);
+			return true;
+		}
+
+		inline size_t GetCapacity() const { return m_Mask + 1; }
+
+		// 并发下只是近似值
+		size_t GetSizeApprox() const
+		{
+			size_t tail = m_Tail.load(std::memory_order_relaxed);
+			size_t head = m_Head.load(std::memory_order_relaxed);
+			return tail > head ? tail - head : 0;
+		}
+	private:
+		struct Cell
+		{
+			alignas(T) unsigned char Storage[sizeof(T)];
+		};
+	private:
+		std::unique_ptr<Cell[]> m_Cells;
+		size_t m_Mask = 0;
+
+		// 生产者端：自己的写位置 + 缓存的读位置
+		alignas(s_CacheLineSize) std::atomic<size_t> m_Tail{ 0 };
+		size_t m_CachedHead = 0;
+		// 消费者端：自己的读位置 + 缓存的写位置
+		alignas(s_CacheLineSize) std::atomic<size_t> m_Head{ 0 };
+		size_t m_CachedTail = 0;
+	};
+
+}
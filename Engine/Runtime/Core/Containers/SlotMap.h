@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Hazel {
+
+	// SlotMap 返回的句柄，Index 指向槽位，Generation 用来识别槽位被复用后的旧句柄
+	struct SlotMapHandle
+	{
+		static constexpr uint32_t s_InvalidIndex = 0xFFFFFFFFu;
+
+		uint32_t Index = s_InvalidIndex;
+		uint32_t Generation = 0;
+
+		bool IsValid() const { return Index != s_InvalidIndex; }
+		uint64_t ToU64() const { return ((uint64_t)Generation << 32) | Index; }
+		static SlotMapHandle FromU64(uint64_t value) { return { (uint32_t)value, (uint32_t)(value >> 32) }; }
+
+		friend bool operator==(const SlotMapHandle& a, const SlotMapHandle& b) { return a.Index == b.Index && a.Generation == b.Generation; }
+		friend bool operator!=(const SlotMapHandle& a, const SlotMapHandle& b) { return !(a == b); }
+	};
+
+	// 带代数的句柄表
+	// - 元素紧密存放在一个数组里，遍历就是线性扫描；删除时把最后一个元素挪到空位
+	// - 句柄经过一层槽位间接寻址，元素被挪动后句柄依然有效；删除后槽位代数加一，旧句柄 Get 返回 nullptr
+	// - 空闲槽位串成链表复用，插入删除都是 O(1)
+	template<typename T>
+	class SlotMap
+	{
+	public:
+		SlotMap() = default;
+
+		void Reserve(size_t count)
+		{
+			m_Values.reserve(count);
+			m_ValueToSlot.reserve(count);
+			m_Slots.reserve(count);
+		}
+
+		template<typename... Args>
+		SlotMapHandle Emplace(Args&&... args)
+		{
+			uint32_t slotIndex;
+			if (m_FreeHead != SlotMapHandle::s_InvalidIndex)
+			{
+				slotIndex = m_FreeHead;
+				m_FreeHead = m_Slots[slotIndex].Target;
+			}
+			else
+			{
+				slotIndex = (uint32_t)m_Slots.size();
+				m_Slots.push_back({});
+			}
+
+			Slot& slot = m_Slots[slotIndex];
+			slot.Target = (uint32_t)m_Values.size();
+			m_Values.emplace_back(std::forward<Args>(args)...);
+			m_ValueToSlot.push_back(slotIndex);
+			return { slotIndex, slot.Generation };
+		}
+
+		SlotMapHandle Insert(const T& value) { return Emplace(value); }
+		SlotMapHandle Insert(T&& value) { return Emplace(std::move(value)); }
+
+		bool Remove(SlotMapHandle handle)
+		{
+			if (!Contains(handle))
+				return false;
+
+			Slot& slot = m_Slots[handle.Index];
+			uint32_t valueIndex = slot.Target;
+			uint32_t lastIndex = (uint32_t)m_Values.size() - 1;
+			if (valueIndex != lastIndex)
+			{
+				m_Values[valueIndex] = std::move(m_Values[lastIndex]);
+				m_ValueToSlot[valueIndex] = m_ValueToSlot[lastIndex];
+				m_Slots[m_ValueToSlot[valueIndex]].Target = valueIndex;
+			}
+			m_Values.pop_back();
+			m_ValueToSlot.pop_back();
+
+			slot.Generation++;
+			slot.Target = m_FreeHead;
+			m_FreeHead = handle.Index;
+			return true;
+		}
+
+		bool Contains(SlotMapHandle handle) const
+		{
+			return handle.Index < m_Slots.size() && m_Slots[handle.Index].Generation == handle.Generation
+				&& IsLive(handle.Index);
+		}
+
+		// 旧句柄或无效句柄返回 nullptr，指针在下一次 Emplace/Remove 前有效
+		T* Get(SlotMapHandle handle)
+		{
+			return Contains(handle) ? &m_Values[m_Slots[handle.Index].Target] : nullptr;
+		}
+
+		const T* Get(SlotMapHandle handle) const
+		{
+			return Contains(handle) ? &m_Values[m_Slots[handle.Index].Target] : nullptr;
+		}
+
+		// 紧密数组中第 index 个元素对应的句柄，遍历时需要句柄用这个
+		SlotMapHandle GetHandle(size_t index) const
+		{
+			uint32_t slotIndex = m_ValueToSlot[index];
+			return { slotIndex, m_Slots[slotIndex].Generation };
+		}
+
+		void Clear()
+		{
+			for (uint32_t slotIndex : m_ValueToSlot)
+			{
+				Slot& slot = m_Slots[slotIndex];
+				slot.Generation++;
+				slot.Target = m_FreeHead;
+				m_FreeHead = slotIndex;
+			}
+			m_Values.clear();
+			m_ValueToSlot.clear();
+		}
+
+		size_t GetSize() const { return m_Values.size(); }
+		bool IsEmpty() const { return m_Values.empty(); }
+
+		// 紧密数组，顺序随删除变化
+		T* GetData() { return m_Values.data(); }
+		const T* GetData() const { return m_Values.data(); }
+		typename std::vector<T>::iterator begin() { return m_Values.begin(); }
+		typename std::vector<T>::iterator end() { return m_Values.end(); }
+		typename std::vector<T>::const_iterator begin() const { return m_Values.begin(); }
+		typename std::vector<T>::const_iterator end() const { return m_Values.end(); }
+	private:
+		struct Slot
+		{
+			// 活动槽位：元素在紧密数组中的下标；空闲槽位：下一个空闲槽位
+			uint32_t Target = SlotMapHandle::s_InvalidIndex;
+			uint32_t Generation = 0;
+		};
+
+		bool IsLive(uint32_t slotIndex) const
+		{
+			uint32_t target = m_Slots[slotIndex].Target;
+			return target < m_ValueToSlot.size() && m_ValueToSlot[target] == slotIndex;
+		}
+	private:
+		std::vector<T> m_Values;
+		std::vector<uint32_t> m_ValueToSlot;
+		std::vector<Slot> m_Slots;
+		uint32_t m_FreeHead = SlotMapHandle::s_InvalidIndex;
+	};
+
+}
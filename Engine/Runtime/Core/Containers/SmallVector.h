@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Hazel {
+
+	// 前 N 个元素放在对象内部，超过才上堆，接口和 std::vector 常用部分一致
+	// - 适合"通常只有几个、偶尔很多"的场合（每个资源的视图、每个节点的子节点、空闲块表）
+	// - 元素在内联存储里时移动 SmallVector 会逐个移动元素，迭代器随之失效
+	template<typename T, size_t N>
+	class SmallVector
+	{
+		static_assert(N > 0, "SmallVector needs at least one inline element, use std::vector otherwise");
+	public:
+		using value_type = T;
+		using size_type = size_t;
+		using iterator = T*;
+		using const_iterator = const T*;
+		using reference = T&;
+		using const_reference = const T&;
+	public:
+		SmallVector() = default;
+
+		SmallVector(std::initializer_list<T> values)
+		{
+			reserve(values.size());
+			for (const T& value : values)
+				new (m_Data + m_Size++) T(value);
+		}
+
+		SmallVector(const SmallVector& other)
+		{
+			reserve(other.m_Size);
+			std::uninitialized_copy(other.begin(), other.end(), m_Data);
+			m_Size = other.m_Size;
+		}
+
+		SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			MoveFrom(std::move(other));
+		}
+
+		SmallVector& operator=(const SmallVector& other)
+		{
+			if (this != &other)
+			{
+				clear();
+				reserve(other.m_Size);
+				std::uninitialized_copy(other.begin(), other.end(), m_Data);
+				m_Size = other.m_Size;
+			}
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+		{
+			if (this != &other)
+			{
+				clear();
+				ReleaseHeap();
+				MoveFrom(std::move(other));
+			}
+			return *this;
+		}
+
+		~SmallVector()
+		{
+			clear();
+			ReleaseHeap();
+		}
+
+		iterator begin() { return m_Data; }
+		iterator end() { return m_Data + m_Size; }
+		const_iterator begin() const { return m_Data; }
+		const_iterator end() const { return m_Data + m_Size; }
+
+		T* data() { return m_Data; }
+		const T* data() const { return m_Data; }
+
+		bool empty() const { return m_Size == 0; }
+		size_t size() const { return m_Size; }
+		size_t capacity() const { return m_Capacity; }
+		// 元素还在对象内部，没有上堆
+		bool is_inline() const { return m_Data == InlineData(); }
+
+		T& operator[](size_t index) { return m_Data[index]; }
+		const T& operator[](size_t index) const { return m_Data[index]; }
+		T& front() { return m_Data[0]; }
+		const T& front() const { return m_Data[0]; }
+		T& back() { return m_Data[m_Size - 1]; }
+		const T& back() const { return m_Data[m_Size - 1]; }
+
+		void reserve(size_t capacity)
+		{
+			if (capacity > m_Capacity)
+				Reallocate(capacity);
+		}
+
+		void push_back(const T& value)
+		{
+			emplace_back(value);
+		}
+
+		void push_back(T&& value)
+		{
+			emplace_back(std::move(value));
+		}
+
+		template<typename... Args>
+		T& emplace_back(Args&&... args)
+		{
+			if (m_Size == m_Capacity)
+			{
+				// 先构造再搬家，参数可能引用的是自己的元素
+				T value(std::forward<Args>(args)...);
+				Reallocate(m_Capacity * 2);
+				return *new (m_Data + m_Size++) T(std::move(value));
+			}
+			return *new (m_Data + m_Size++) T(std::forward<Args>(args)...);
+		}
+
+		void pop_back()
+		{
+			m_Data[--m_Size].~T();
+		}
+
+		iterator insert(const_iterator position, const T& value)
+		{
+			size_t index = (size_t)(position - m_Data);
+			T copy(value);
+			emplace_back(std::move(copy));
+			std::rotate(m_Data + index, m_Data + m_Size - 1, m_Data + m_Size);
+			return m_Data + index;
+		}
+
+		iterator erase(const_iterator position)
+		{
+			size_t index = (size_t)(position - m_Data);
+			std::move(m_Data + index + 1, m_Data + m_Size, m_Data + index);
+			pop_back();
+			return m_Data + index;
+		}
+
+		// 不保序删除，把最后一个元素挪过来
+		void erase_unordered(size_t index)
+		{
+			if (index != m_Size - 1)
+				m_Data[index] = std::move(m_Data[m_Size - 1]);
+			pop_back();
+		}
+
+		void resize(size_t size)
+		{
+			reserve(size);
+			while (m_Size < size)
+				new (m_Data + m_Size++) T();
+			while (m_Size > size)
+				pop_back();
+		}
+
+		void resize(size_t size, const T& value)
+		{
+			reserve(size);
+			while (m_Size < size)
+				new (m_Data + m_Size++) T(value);
+			while (m_Size > size)
+				pop_back();
+		}
+
+		void clear()
+		{
+			std::destroy(m_Data, m_Data + m_Size);
+			m_Size = 0;
+		}
+	private:
+		T* InlineData() { return std::launder(reinterpret_cast<T*>(m_Inline)); }
+		const T* InlineData() const { return std::launder(reinterpret_cast<const T*>(m_Inline)); }
+
+		void Reallocate(size_t capacity)
+		{
+			T* data = std::allocator<T>().allocate(capacity);
+			std::uninitialized_move(m_Data, m_Data + m_Size, data);
+			std::destroy(m_Data, m_Data + m_Size);
+			ReleaseHeap();
+			m_Data = data;
+			m_Capacity = capacity;
+		}
+
+		void ReleaseHeap()
+		{
+			if (!is_inline())
+				std::allocator<T>().deallocate(m_Data, m_Capacity);
+			m_Data = InlineData();
+			m_Capacity = N;
+		}
+
+		// 调用前自己必须是空的内联状态
+		void MoveFrom(SmallVector&& other)
+		{
+			if (other.is_inline())
+			{
+				std::uninitialized_move(other.begin(), other.end(), m_Data);
+				m_Size = other.m_Size;
+				other.clear();
+			}
+			else
+			{
+				// 堆上的直接接管
+				m_Data = other.m_Data;
+				m_Size = other.m_Size;
+				m_Capacity = other.m_Capacity;
+				other.m_Data = other.InlineData();
+				other.m_Size = 0;
+				other.m_Capacity = N;
+			}
+		}
+	private:
+		T* m_Data = InlineData();
+		size_t m_Size = 0;
+		size_t m_Capacity = N;
+		alignas(T) unsigned char m_Inline[sizeof(T) * N];
+	};
+
+}
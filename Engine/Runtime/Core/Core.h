@@ -2,6 +2,14 @@
 
 #include <memory>
 
+#if !defined(HZ_PLATFORM_WINDOWS) && !defined(HZ_PLATFORM_LINUX)
+	#if defined(_WIN32)
+		#define HZ_PLATFORM_WINDOWS
+	#elif defined(__linux__)
+		#define HZ_PLATFORM_LINUX
+	#endif
+#endif
+
 #ifdef HZ_PLATFORM_WINDOWS
 #if HZ_DYNAMIC_LINK
 	#ifdef HZ_BUILD_DLL
@@ -12,8 +20,14 @@
 #else
 	#define HAZEL_API
 #endif
+	#define HZ_DEBUGBREAK() __debugbreak()
+#elif defined(HZ_PLATFORM_LINUX)
+	// Linux only runs headless (no window / GPU backend), used for benchmarks and CI perf runs
+	#include <csignal>
+	#define HAZEL_API
+	#define HZ_DEBUGBREAK() raise(SIGTRAP)
 #else
-	#error Hazel only support for  Windows!
+	#error Hazel only support for Windows and Linux (headless)!
 #endif // HZ_PLATFORM_WINDOWS
 
 #ifdef HZ_DEBUG
@@ -21,8 +35,8 @@
 #endif
 
 #ifdef HZ_ENABLE_ASSERTS
-#define HZ_ASSERT(x, ...) { if(!(x)) { HZ_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
-#define HZ_CORE_ASSERT(x, ...) { if(!(x)) { HZ_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); __debugbreak(); } }
+#define HZ_ASSERT(x, ...) { if(!(x)) { HZ_ERROR("Assertion Failed: {0}", __VA_ARGS__); HZ_DEBUGBREAK(); } }
+#define HZ_CORE_ASSERT(x, ...) { if(!(x)) { HZ_CORE_ERROR("Assertion Failed: {0}", __VA_ARGS__); HZ_DEBUGBREAK(); } }
 #else
 #define HZ_ASSERT(x, ...)
 #define HZ_CORE_ASSERT(x, ...)
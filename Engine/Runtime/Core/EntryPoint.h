@@ -1,11 +1,12 @@
 #pragma once
 
-#ifdef HZ_PLATFORM_WINDOWS
+#if defined(HZ_PLATFORM_WINDOWS) || defined(HZ_PLATFORM_LINUX)
 
 extern Hazel::Application* Hazel::CreateApplication();
 int main(int argc, char ** argv)
 {
 	Hazel::Log::Init();
+	HZ_PROFILE_THREAD("Main Thread");
 	HZ_PROFILE_BEGIN_SESSION("Startup", "HazelProfile-Startup.json");
 	auto app = Hazel::CreateApplication();
 	HZ_PROFILE_END_SESSION();
@@ -13,10 +14,14 @@ int main(int argc, char ** argv)
 	HZ_PROFILE_BEGIN_SESSION("Runtime", "HazelProfile-Runtime.json");
 	app->Run();
 	HZ_PROFILE_END_SESSION();
+	int exitCode = app->GetExitCode();
 
 	HZ_PROFILE_BEGIN_SESSION("Startup", "HazelProfile-Shutdown.json");
 	delete app;
 	HZ_PROFILE_END_SESSION();
+
+	Hazel::Log::Shutdown();
+	return exitCode;
 }
 
 #endif // 
@@ -6,11 +6,9 @@
 
 namespace Hazel {
 
-	// Events in Hazel are currently blocking, meaning when an event occurs it
-	// immediately gets dispatched and must be dealt with right then an there.
-	// For the future, a better strategy might be to buffer events in an event
-	// bus and process them during the "event" part of the update stage.
-	// eventbus ��ûʵ��
+	// Window callbacks no longer dispatch events immediately: they are pushed
+	// into the EventQueue (EventQueue.h), coalesced, and processed during the
+	// "event" part of the update stage in Application::Run.
 
 	// ������EventType���ֱ��ڲ�ͬ��event����ȥ���崦��
 	enum class EventType
@@ -37,7 +35,7 @@ namespace Hazel {
 //		GetStaticType ��Ҫ�ǽ���type�Ƚϵ�ʱ���ÿ��Typeֱ���õģ� ����KeyPressedEvent�����Լ���һ��
 // 	   �ྲ̬EventType��
 //		GetEventType ���Ǹ�ÿ�������eventȥʹ�õģ�(m_Event.GetEventType() == T::GetStaticType())
-#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::##type; }\
+#define EVENT_CLASS_TYPE(type) static EventType GetStaticType() { return EventType::type; }\
 								virtual EventType GetEventType() const override { return GetStaticType(); }\
 								virtual const char* GetName() const override { return #type; }
 
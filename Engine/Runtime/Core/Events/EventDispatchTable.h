@@ -0,0 +1,115 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Events/Event.h"
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+#include <vector>
+
+namespace Hazel {
+
+	constexpr size_t EventTypeCount = (size_t)EventType::MouseScrolled + 1;
+
+	// Type indexed event handler table.
+	// Handlers are registered once (OnAttach / constructor) with a compile time member
+	// function pointer, Dispatch is an array lookup plus a direct call through a
+	// generated thunk: no std::function, no std::bind, no allocation per event.
+	//
+	//	m_EventHandlers.Bind<&Application::OnWindowResize>(this);
+	//	...
+	//	m_EventHandlers.Dispatch(e);
+	class HAZEL_API EventDispatchTable
+	{
+	public:
+		using HandlerFn = bool(*)(void* instance, Event& e);
+
+		struct Handler
+		{
+			void* Instance = nullptr;
+			HandlerFn Fn = nullptr;
+		};
+	public:
+		// bool C::Method(T& e), T must be a concrete event type with GetStaticType()
+		template<auto Method, typename C>
+		void Bind(C* instance)
+		{
+			using Traits = MethodTraits<decltype(Method)>;
+			static_assert(std::is_base_of_v<typename Traits::ClassType, C>, "instance does not match the handler class");
+			using T = typename Traits::EventT;
+
+			auto& handlers = m_Handlers[(size_t)T::GetStaticType()];
+			handlers.push_back({ static_cast<typename Traits::ClassType*>(instance), &MemberThunk<Method, typename Traits::ClassType, T> });
+		}
+
+		// bool Fn(T& e)
+		template<typename T, bool(*Fn)(T&)>
+		void Bind()
+		{
+			m_Handlers[(size_t)T::GetStaticType()].push_back({ nullptr, &FreeThunk<T, Fn> });
+		}
+
+		// remove every handler registered for this instance (OnDetach)
+		void Unbind(void* instance)
+		{
+			for (auto& handlers : m_Handlers)
+			{
+				handlers.erase(std::remove_if(handlers.begin(), handlers.end(),
+					[instance](const Handler& h) { return h.Instance == instance; }), handlers.end());
+			}
+		}
+
+		void Clear()
+		{
+			for (auto& handlers : m_Handlers)
+				handlers.clear();
+		}
+
+		// same semantics as EventDispatcher: a handler returning true marks the event handled,
+		// the remaining handlers for this type are skipped
+		inline bool Dispatch(Event& e) const
+		{
+			const size_t index = (size_t)e.GetEventType();
+			if (index >= EventTypeCount)
+				return false;
+
+			for (const Handler& handler : m_Handlers[index])
+			{
+				if (handler.Fn(handler.Instance, e))
+				{
+					e.Handled = true;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		inline bool HasHandlers(EventType type) const { return !m_Handlers[(size_t)type].empty(); }
+	private:
+		template<typename M>
+		struct MethodTraits;
+
+		template<typename C, typename T>
+		struct MethodTraits<bool(C::*)(T&)>
+		{
+			using ClassType = C;
+			using EventT = T;
+		};
+
+		template<auto Method, typename C, typename T>
+		static bool MemberThunk(void* instance, Event& e)
+		{
+			return (static_cast<C*>(instance)->*Method)(static_cast<T&>(e));
+		}
+
+		template<typename T, bool(*Fn)(T&)>
+		static bool FreeThunk(void*, Event& e)
+		{
+			return Fn(static_cast<T&>(e));
+		}
+	private:
+		std::array<std::vector<Handler>, EventTypeCount> m_Handlers;
+	};
+
+}
@@ -0,0 +1,121 @@
+#include "hzpch.h"
+#include "EventQueue.h"
+
+namespace Hazel {
+
+	EventQueue::EventQueue(size_t initialCapacity)
+	{
+		m_Pending.reserve(initialCapacity);
+		m_Processing.reserve(initialCapacity);
+	}
+
+	bool EventQueue::Encode(const Event& e, QueuedEvent& out)
+	{
+		out.Type = e.GetEventType();
+		switch (out.Type)
+		{
+		case EventType::WindowClose:
+		case EventType::AppTick:
+		case EventType::AppUpdate:
+		case EventType::AppRender:
+			return true;
+		case EventType::WindowResize:
+		{
+			const auto& resize = static_cast<const WindowResizeEvent&>(e);
+			out.Resize = { resize.GetWidth(), resize.GetHeight(), resize.IsWindowMinimized() != 0, resize.IsWindowMaximized() != 0 };
+			return true;
+		}
+		case EventType::AppActive:
+			out.Active = static_cast<const AppActiveEvent&>(e).GetAppActiveState() != 0;
+			return true;
+		case EventType::KeyPressed:
+		{
+			const auto& key = static_cast<const KeyPressedEvent&>(e);
+			out.Key = { key.GetKeyCode(), key.GetRepeatCount() };
+			return true;
+		}
+		case EventType::KeyReleased:
+		case EventType::KeyTyped:
+			out.Key = { static_cast<const KeyEvent&>(e).GetKeyCode(), 0 };
+			return true;
+		case EventType::MouseButtonPressed:
+		case EventType::MouseButtonReleased:
+			out.Button = static_cast<const MouseButtonEvent&>(e).GetMouseButton();
+			return true;
+		case EventType::MouseMoved:
+		{
+			const auto& moved = static_cast<const MouseMovedEvent&>(e);
+			out.Mouse = { moved.GetX(), moved.GetY() };
+			return true;
+		}
+		case EventType::MouseScrolled:
+		{
+			const auto& scrolled = static_cast<const MouseScrolledEvent&>(e);
+			out.Mouse = { scrolled.GetXOffset(), scrolled.GetYOffset() };
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+
+	void EventQueue::Push(const Event& e)
+	{
+		QueuedEvent queued;
+		if (!Encode(e, queued))
+		{
+			HZ_CORE_WARN("EventQueue: unsupported event {0}, dropped", e.GetName());
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_Stats.Pushed++;
+
+		if (!m_Pending.empty())
+		{
+			QueuedEvent& last = m_Pending.back();
+			if (last.Type == queued.Type)
+			{
+				if (queued.Type == EventType::MouseMoved)
+				{
+					last.Mouse = queued.Mouse;
+					m_Stats.Coalesced++;
+					return;
+				}
+				if (queued.Type == EventType::MouseScrolled)
+				{
+					last.Mouse.X += queued.Mouse.X;
+					last.Mouse.Y += queued.Mouse.Y;
+					m_Stats.Coalesced++;
+					return;
+				}
+			}
+		}
+
+		if (queued.Type == EventType::WindowResize)
+		{
+			// only the final size matters, tombstone the older one so ordering with other events is kept
+			if (m_LastResizeIndex != s_InvalidIndex)
+			{
+				m_Pending[m_LastResizeIndex].Type = EventType::None;
+				m_Stats.Coalesced++;
+			}
+			m_LastResizeIndex = m_Pending.size();
+		}
+
+		m_Pending.push_back(queued);
+	}
+
+	size_t EventQueue::GetPendingCount() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Pending.size();
+	}
+
+	EventQueue::Statistics EventQueue::GetStatistics() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		return m_Stats;
+	}
+
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Events/Event.h"
+#include "Runtime/Core/Events/ApplicationEvent.h"
+#include "Runtime/Core/Events/KeyEvent.h"
+#include "Runtime/Core/Events/MouseEvent.h"
+
+#include <mutex>
+#include <vector>
+
+namespace Hazel {
+
+	// Buffered event bus.
+	// Window/OS callbacks (any thread) push events here instead of walking the LayerStack,
+	// the Application drains the queue once per frame on the main thread.
+	// High frequency events are coalesced on push:
+	//  - consecutive MouseMoved keep only the latest position
+	//  - consecutive MouseScrolled accumulate their offsets
+	//  - WindowResize keeps only the latest size (older pending one is dropped)
+	class HAZEL_API EventQueue
+	{
+	public:
+		struct Statistics
+		{
+			uint64_t Pushed = 0;
+			uint64_t Coalesced = 0;
+			uint64_t Dispatched = 0;
+		};
+	public:
+		EventQueue(size_t initialCapacity = 256);
+
+		// thread safe, the event is copied into a compact record
+		void Push(const Event& e);
+
+		// main thread only, calls func(Event&) for every pending event in push order
+		template<typename Func>
+		void Drain(Func&& func)
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_Mutex);
+				m_Processing.swap(m_Pending);
+				m_LastResizeIndex = s_InvalidIndex;
+				m_Stats.Dispatched += m_Processing.size();
+			}
+
+			for (const QueuedEvent& queued : m_Processing)
+			{
+				if (queued.Type == EventType::None)
+					continue;
+				Dispatch(queued, func);
+			}
+
+			// keep the capacity, no allocation next frame
+			m_Processing.clear();
+		}
+
+		size_t GetPendingCount() const;
+		Statistics GetStatistics() const;
+	private:
+		// plain data copy of an event, big enough for every concrete event type
+		struct ResizeData { unsigned int Width, Height; bool Minimized, Maximized; };
+		struct PointerData { float X, Y; };
+		struct KeyData { int KeyCode, RepeatCount; };
+
+		struct QueuedEvent
+		{
+			EventType Type = EventType::None;
+			union
+			{
+				ResizeData Resize;
+				PointerData Mouse;
+				KeyData Key;
+				int Button;
+				bool Active;
+			};
+		};
+
+		static constexpr size_t s_InvalidIndex = (size_t)-1;
+
+		template<typename Func>
+		static void Dispatch(const QueuedEvent& q, Func& func)
+		{
+			switch (q.Type)
+			{
+			case EventType::WindowClose:         { WindowCloseEvent e; func(e); break; }
+			case EventType::WindowResize:        { WindowResizeEvent e(q.Resize.Width, q.Resize.Height, q.Resize.Minimized, q.Resize.Maximized); func(e); break; }
+			case EventType::AppTick:             { AppTickEvent e; func(e); break; }
+			case EventType::AppUpdate:           { AppUpdateEvent e; func(e); break; }
+			case EventType::AppRender:           { AppRenderEvent e; func(e); break; }
+			case EventType::AppActive:           { AppActiveEvent e(!q.Active); func(e); break; }
+			case EventType::KeyPressed:          { KeyPressedEvent e(q.Key.KeyCode, q.Key.RepeatCount); func(e); break; }
+			case EventType::KeyReleased:         { KeyReleasedEvent e(q.Key.KeyCode); func(e); break; }
+			case EventType::KeyTyped:            { KeyTypedEvent e(q.Key.KeyCode); func(e); break; }
+			case EventType::MouseButtonPressed:  { MouseButtonPressedEvent e(q.Button); func(e); break; }
+			case EventType::MouseButtonReleased: { MouseButtonReleasedEvent e(q.Button); func(e); break; }
+			case EventType::MouseMoved:          { MouseMovedEvent e(q.Mouse.X, q.Mouse.Y); func(e); break; }
+			case EventType::MouseScrolled:       { MouseScrolledEvent e(q.Mouse.X, q.Mouse.Y); func(e); break; }
+			default: break;
+			}
+		}
+
+		static bool Encode(const Event& e, QueuedEvent& out);
+	private:
+		mutable std::mutex m_Mutex;
+		std::vector<QueuedEvent> m_Pending;
+		std::vector<QueuedEvent> m_Processing;
+		size_t m_LastResizeIndex = s_InvalidIndex;
+		Statistics m_Stats;
+	};
+
+}
@@ -2,6 +2,7 @@
 
 #include "Runtime/Core/Core.h"
 #include "Runtime/Core/Events/Event.h"
+#include "Runtime/Core/Events/EventDispatchTable.h"
 #include "Runtime/Core/Time/Timestep.h"
 namespace Hazel {
 
@@ -17,13 +18,17 @@ namespace Hazel {
 		virtual void OnDetach() {}
 
 		virtual void OnUpdate(Timestep ts) {}
+		// called 0..n times per frame with a constant timestep, before OnUpdate
+		virtual void OnFixedUpdate(Timestep fixedTs) {}
 		virtual void OnImGuiRender() {}
-		virtual void OnEvent(Event& event) {}
+		// default path: handlers bound into m_EventHandlers (usually in OnAttach)
+		virtual void OnEvent(Event& event) { m_EventHandlers.Dispatch(event); }
 
 
 		inline const std::string& GetName() const { return m_DebugName; }
 	protected:
 		std::string m_DebugName;
+		EventDispatchTable m_EventHandlers;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,260 @@
+#include "hzpch.h"
+#include "Log.h"
+
+#include "Runtime/Core/Containers/MPMCQueue.h"
+#include "spdlog/sinks/stdout_color_sinks.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <thread>
+
+namespace Hazel {
+
+	Ref<spdlog::logger> Log::s_CoreLogger;
+	Ref<spdlog::logger> Log::s_ClientLogger;
+
+	namespace {
+
+		constexpr size_t s_QueueCapacity = 8192;
+		// 空闲时最长睡多久再检查一次，正常情况下由生产者唤醒
+		constexpr auto s_IdleWait = std::chrono::milliseconds(50);
+
+		struct LogWorker
+		{
+			MPMCQueue<LogMessage> Queue{ s_QueueCapacity };
+			std::thread Thread;
+			std::atomic<bool> Running{ false };
+
+			std::mutex WakeMutex;
+			std::condition_variable WakeCondition;
+			// 后台线程准备睡眠时置位，生产者只在它为 true 时才去加锁 notify
+			std::atomic<bool> Sleeping{ false };
+
+			std::atomic<uint64_t> Enqueued{ 0 };
+			std::atomic<uint64_t> Processed{ 0 };
+		};
+
+		// 故意不析构：静态析构阶段仍可能有日志
+		LogWorker& GetWorker()
+		{
+			static LogWorker* worker = new LogWorker();
+			return *worker;
+		}
+
+		void WakeWorker(LogWorker& worker)
+		{
+			// 和 WorkerLoop 里的 fence 配对：要么这里看到 Sleeping，要么后台线程看到新消息
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (worker.Sleeping.load(std::memory_order_seq_cst))
+			{
+				std::lock_guard<std::mutex> lock(worker.WakeMutex);
+				worker.WakeCondition.notify_one();
+			}
+		}
+
+		void WorkerLoop()
+		{
+			HZ_PROFILE_THREAD("Log Worker");
+
+			LogWorker& worker = GetWorker();
+			LogMessage message;
+			for (;;)
+			{
+				if (worker.Queue.TryPop(message))
+				{
+					message.Write();
+					message.Reset();
+					worker.Processed.fetch_add(1, std::memory_order_release);
+					continue;
+				}
+
+				if (!worker.Running.load(std::memory_order_acquire))
+					break;
+
+				std::unique_lock<std::mutex> lock(worker.WakeMutex);
+				worker.Sleeping.store(true, std::memory_order_seq_cst);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				// 置位后再看一次队列，和 WakeWorker 配合保证不会错过唤醒
+				if (worker.Queue.GetSizeApprox() == 0 && worker.Running.load(std::memory_order_acquire))
+					worker.WakeCondition.wait_for(lock, s_IdleWait);
+				worker.Sleeping.store(false, std::memory_order_relaxed);
+			}
+		}
+
+	}
+
+	// ---------------- LogMessage ----------------
+
+	LogMessage::LogMessage(LogMessage&& other) noexcept
+		: m_Logger(other.m_Logger), m_Level(other.m_Level), m_Ops(other.m_Ops)
+	{
+		if (m_Ops)
+		{
+			m_Ops->Relocate(m_Storage, other.m_Storage);
+			other.m_Ops = nullptr;
+		}
+	}
+
+	LogMessage& LogMessage::operator=(LogMessage&& other) noexcept
+	{
+		if (this == &other)
+			return *this;
+
+		Reset();
+		m_Logger = other.m_Logger;
+		m_Level = other.m_Level;
+		m_Ops = other.m_Ops;
+		if (m_Ops)
+		{
+			m_Ops->Relocate(m_Storage, other.m_Storage);
+			other.m_Ops = nullptr;
+		}
+		return *this;
+	}
+
+	LogMessage::~LogMessage()
+	{
+		Reset();
+	}
+
+	void LogMessage::Write() const
+	{
+		if (!m_Ops || !m_Logger)
+			return;
+		m_Logger->log(m_Level, "{}", m_Ops->Format(m_Storage));
+	}
+
+	void LogMessage::Reset()
+	{
+		if (m_Ops)
+		{
+			m_Ops->Destroy(m_Storage);
+			m_Ops = nullptr;
+		}
+	}
+
+	// ---------------- Log ----------------
+
+	void Log::Init()
+	{
+		if (s_CoreLogger)
+			return;
+
+		spdlog::set_pattern("%^[%T] %n: %v%$");
+
+		s_CoreLogger = spdlog::stdout_color_mt("HAZEL");
+		s_CoreLogger->set_level(spdlog::level::trace);
+
+		s_ClientLogger = spdlog::stdout_color_mt("APP");
+		s_ClientLogger->set_level(spdlog::level::trace);
+
+		LogWorker& worker = GetWorker();
+		worker.Running.store(true, std::memory_order_release);
+		worker.Thread = std::thread(WorkerLoop);
+
+		// 正常退出路径会显式调用 Shutdown，这里兜底 exit() 提前退出的情况
+		std::atexit(Log::Shutdown);
+	}
+
+	void Log::Shutdown()
+	{
+		LogWorker& worker = GetWorker();
+		if (!worker.Running.exchange(false, std::memory_order_acq_rel))
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(worker.WakeMutex);
+			worker.WakeCondition.notify_one();
+		}
+		if (worker.Thread.joinable())
+			worker.Thread.join();
+
+		// 停止期间其他线程刚好入队的消息
+		LogMessage message;
+		while (worker.Queue.TryPop(message))
+		{
+			message.Write();
+			message.Reset();
+			worker.Processed.fetch_add(1, std::memory_order_release);
+		}
+
+		if (s_CoreLogger)
+			s_CoreLogger->flush();
+		if (s_ClientLogger)
+			s_ClientLogger->flush();
+	}
+
+	void Log::Flush()
+	{
+		LogWorker& worker = GetWorker();
+		if (!worker.Running.load(std::memory_order_acquire))
+			return;
+
+		uint64_t target = worker.Enqueued.load(std::memory_order_acquire);
+		while (worker.Processed.load(std::memory_order_acquire) < target)
+		{
+			if (!worker.Running.load(std::memory_order_acquire))
+				break;
+			WakeWorker(worker);
+			std::this_thread::yield();
+		}
+	}
+
+	void Log::SetLevel(spdlog::level::level_enum level)
+	{
+		if (s_CoreLogger)
+			s_CoreLogger->set_level(level);
+		if (s_ClientLogger)
+			s_ClientLogger->set_level(level);
+	}
+
+	bool Log::IsAsync()
+	{
+		return GetWorker().Running.load(std::memory_order_relaxed);
+	}
+
+	void Log::Enqueue(LogMessage&& message)
+	{
+		LogWorker& worker = GetWorker();
+		if (!worker.Queue.TryPush(std::move(message)))
+		{
+			// 队列满：等后台线程追上再入队，还是放不进去就同步写
+			Flush();
+			if (!worker.Running.load(std::memory_order_acquire) || !worker.Queue.TryPush(std::move(message)))
+			{
+				message.Write();
+				return;
+			}
+		}
+
+		worker.Enqueued.fetch_add(1, std::memory_order_release);
+		WakeWorker(worker);
+	}
+
+	// ---------------- LogRateLimiter ----------------
+
+	bool LogRateLimiter::TryAcquire(uint32_t& suppressed)
+	{
+		int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+
+		int64_t windowStart = m_WindowStart.load(std::memory_order_relaxed);
+		if (now - windowStart >= 1000)
+		{
+			// 只有一个线程能开启新窗口，由它负责报告上个窗口丢弃的条数
+			if (m_WindowStart.compare_exchange_strong(windowStart, now, std::memory_order_relaxed))
+			{
+				m_Count.store(0, std::memory_order_relaxed);
+				suppressed = m_Suppressed.exchange(0, std::memory_order_relaxed);
+			}
+		}
+
+		if (m_Count.fetch_add(1, std::memory_order_relaxed) < m_MaxPerSecond)
+			return true;
+
+		m_Suppressed.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+}
@@ -0,0 +1,271 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "spdlog/spdlog.h"
+#include "spdlog/fmt/ostr.h"
+
+// 编译期日志等级，低于 HZ_LOG_ACTIVE_LEVEL 的宏展开为空，参数不会求值
+// 数值和 spdlog::level 一致
+#define HZ_LOG_LEVEL_TRACE		0
+#define HZ_LOG_LEVEL_DEBUG		1
+#define HZ_LOG_LEVEL_INFO		2
+#define HZ_LOG_LEVEL_WARN		3
+#define HZ_LOG_LEVEL_ERROR		4
+#define HZ_LOG_LEVEL_CRITICAL	5
+#define HZ_LOG_LEVEL_OFF		6
+
+#ifndef HZ_LOG_ACTIVE_LEVEL
+	#if defined(HZ_DIST)
+		#define HZ_LOG_ACTIVE_LEVEL HZ_LOG_LEVEL_WARN
+	#elif defined(HZ_RELEASE)
+		#define HZ_LOG_ACTIVE_LEVEL HZ_LOG_LEVEL_INFO
+	#else
+		#define HZ_LOG_ACTIVE_LEVEL HZ_LOG_LEVEL_TRACE
+	#endif
+#endif
+
+namespace Hazel {
+
+	namespace LogDetail {
+
+		// 参数的捕获方式：消息要跨线程在后台格式化，不能保留指向调用方栈上的指针
+		// - 字符串指针 / 字符数组 / string_view 拷贝成 std::string
+		// - 其余按值保存
+		template<typename T, typename D = std::decay_t<T>>
+		using CapturedArg = std::conditional_t<
+			std::is_same_v<D, const char*> || std::is_same_v<D, char*> || std::is_same_v<D, std::string_view>,
+			std::string, D>;
+
+		// 格式串：字符串字面量直接保存指针，其余拷贝
+		template<typename T>
+		using CapturedFormat = std::conditional_t<
+			std::is_array_v<std::remove_reference_t<T>> && std::is_const_v<std::remove_reference_t<T>>,
+			const char*, std::string>;
+
+		template<typename FormatT, typename ... Args>
+		std::string FormatToString(const FormatT& format, const Args& ... args)
+		{
+			return fmt::vformat(fmt::string_view(format), fmt::make_format_args(args...));
+		}
+
+	}
+
+	// 一条待写出的日志，参数保存在内联缓冲里，入队不需要分配堆内存
+	// 参数太大（或不能拷贝）时在调用线程上格式化，只保存结果字符串
+	class HAZEL_API LogMessage
+	{
+	public:
+		static constexpr size_t s_InlineSize = 192;
+	public:
+		LogMessage() = default;
+
+		template<typename FormatT, typename ... Args>
+		LogMessage(spdlog::logger* logger, spdlog::level::level_enum level, FormatT&& format, Args&& ... args)
+			: m_Logger(logger), m_Level(level)
+		{
+			using Payload = ArgsPayload<LogDetail::CapturedFormat<FormatT>, LogDetail::CapturedArg<Args>...>;
+			if constexpr (sizeof(Payload) <= s_InlineSize && alignof(Payload) <= alignof(std::max_align_t)
+				&& std::is_nothrow_move_constructible_v<Payload>)
+			{
+				new (m_Storage) Payload{ std::forward<FormatT>(format), { std::forward<Args>(args)... } };
+				m_Ops = &s_PayloadOps<Payload>;
+			}
+			else
+			{
+				new (m_Storage) TextPayload{ LogDetail::FormatToString(format, args...) };
+				m_Ops = &s_PayloadOps<TextPayload>;
+			}
+		}
+
+		LogMessage(LogMessage&& other) noexcept;
+		LogMessage& operator=(LogMessage&& other) noexcept;
+		~LogMessage();
+
+		LogMessage(const LogMessage&) = delete;
+		LogMessage& operator=(const LogMessage&) = delete;
+
+		// 在后台线程格式化并交给 spdlog 的 sink
+		void Write() const;
+		void Reset();
+	private:
+		template<typename F, typename ... Ts>
+		struct ArgsPayload
+		{
+			F Format;
+			std::tuple<Ts...> Arguments;
+
+			std::string ToString() const
+			{
+				return std::apply([this](const auto& ... args) { return LogDetail::FormatToString(Format, args...); }, Arguments);
+			}
+		};
+
+		struct TextPayload
+		{
+			std::string Text;
+
+			inline const std::string& ToString() const { return Text; }
+		};
+
+		struct PayloadOps
+		{
+			std::string(*Format)(const void* payload);
+			void(*Relocate)(void* dst, void* src);
+			void(*Destroy)(void* payload);
+		};
+
+		template<typename P>
+		static constexpr PayloadOps s_PayloadOps = {
+			[](const void* payload) -> std::string { return static_cast<const P*>(payload)->ToString(); },
+			[](void* dst, void* src) { P* from = static_cast<P*>(src); new (dst) P(std::move(*from)); from->~P(); },
+			[](void* payload) { static_cast<P*>(payload)->~P(); }
+		};
+	private:
+		spdlog::logger* m_Logger = nullptr;
+		spdlog::level::level_enum m_Level = spdlog::level::off;
+		const PayloadOps* m_Ops = nullptr;
+		alignas(std::max_align_t) unsigned char m_Storage[s_InlineSize];
+	};
+
+	// 异步日志
+	// - 宏先做编译期等级裁剪，再做运行时 should_log 判断，都不通过时不捕获参数
+	// - 通过的消息进无锁队列，格式化和 sink 都在后台线程做
+	// - error 及以上等级先 Flush 再同步写出，保证断言/崩溃前的日志不丢
+	// - 队列满时等后台线程清空后同步写出，不丢消息
+	class HAZEL_API Log
+	{
+	public:
+		static void Init();
+		// 停止后台线程并写出剩余消息，之后的日志同步写出
+		static void Shutdown();
+		// 阻塞到调用前入队的消息全部写出
+		static void Flush();
+
+		static void SetLevel(spdlog::level::level_enum level);
+
+		inline static Ref<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
+		inline static Ref<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
+
+		template<typename FormatT, typename ... Args>
+		static void Submit(spdlog::logger* logger, spdlog::level::level_enum level, FormatT&& format, Args&& ... args)
+		{
+			if (!logger || !logger->should_log(level))
+				return;
+
+			if (level >= spdlog::level::err || !IsAsync())
+			{
+				Flush();
+				logger->log(level, "{}", LogDetail::FormatToString(format, args...));
+				return;
+			}
+
+			Enqueue(LogMessage(logger, level, std::forward<FormatT>(format), std::forward<Args>(args)...));
+		}
+
+		static bool IsAsync();
+	private:
+		static void Enqueue(LogMessage&& message);
+	private:
+		static Ref<spdlog::logger> s_CoreLogger;
+		static Ref<spdlog::logger> s_ClientLogger;
+	};
+
+	// 按调用点限流，每秒最多放行 maxPerSecond 条，被丢弃的条数在下一个窗口第一次放行时报告
+	// 一般不直接用，见 HZ_CORE_*_RATE_LIMITED
+	class HAZEL_API LogRateLimiter
+	{
+	public:
+		explicit LogRateLimiter(uint32_t maxPerSecond)
+			: m_MaxPerSecond(maxPerSecond > 0 ? maxPerSecond : 1)
+		{
+		}
+
+		// 返回 false 表示这条应当丢弃；suppressed 返回上个窗口被丢弃的条数
+		bool TryAcquire(uint32_t& suppressed);
+	private:
+		uint32_t m_MaxPerSecond;
+		std::atomic<int64_t> m_WindowStart{ INT64_MIN / 2 };
+		std::atomic<uint32_t> m_Count{ 0 };
+		std::atomic<uint32_t> m_Suppressed{ 0 };
+	};
+
+}
+
+#define HZ_LOG_SUBMIT(logger, level, ...) ::Hazel::Log::Submit(logger.get(), level, __VA_ARGS__)
+
+#define HZ_LOG_RATE_LIMITED(logger, level, maxPerSecond, ...) \
+	do { \
+		static ::Hazel::LogRateLimiter hzLogRateLimiter(maxPerSecond); \
+		uint32_t hzLogSuppressed = 0; \
+		if (hzLogRateLimiter.TryAcquire(hzLogSuppressed)) \
+		{ \
+			if (hzLogSuppressed > 0) \
+				HZ_LOG_SUBMIT(logger, level, "({0} similar messages suppressed)", hzLogSuppressed); \
+			HZ_LOG_SUBMIT(logger, level, __VA_ARGS__); \
+		} \
+	} while (0)
+
+#define HZ_LOG_DISABLED(...) (void)0
+
+#if HZ_LOG_ACTIVE_LEVEL <= HZ_LOG_LEVEL_TRACE
+	#define HZ_CORE_TRACE(...)							HZ_LOG_SUBMIT(::Hazel::Log::GetCoreLogger(), spdlog::level::trace, __VA_ARGS__)
+	#define HZ_TRACE(...)								HZ_LOG_SUBMIT(::Hazel::Log::GetClientLogger(), spdlog::level::trace, __VA_ARGS__)
+	#define HZ_CORE_TRACE_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_RATE_LIMITED(::Hazel::Log::GetCoreLogger(), spdlog::level::trace, maxPerSecond, __VA_ARGS__)
+#else
+	#define HZ_CORE_TRACE(...)							HZ_LOG_DISABLED()
+	#define HZ_TRACE(...)								HZ_LOG_DISABLED()
+	#define HZ_CORE_TRACE_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_DISABLED()
+#endif
+
+#if HZ_LOG_ACTIVE_LEVEL <= HZ_LOG_LEVEL_INFO
+	#define HZ_CORE_INFO(...)							HZ_LOG_SUBMIT(::Hazel::Log::GetCoreLogger(), spdlog::level::info, __VA_ARGS__)
+	#define HZ_INFO(...)								HZ_LOG_SUBMIT(::Hazel::Log::GetClientLogger(), spdlog::level::info, __VA_ARGS__)
+	#define HZ_CORE_INFO_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_RATE_LIMITED(::Hazel::Log::GetCoreLogger(), spdlog::level::info, maxPerSecond, __VA_ARGS__)
+#else
+	#define HZ_CORE_INFO(...)							HZ_LOG_DISABLED()
+	#define HZ_INFO(...)								HZ_LOG_DISABLED()
+	#define HZ_CORE_INFO_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_DISABLED()
+#endif
+
+#if HZ_LOG_ACTIVE_LEVEL <= HZ_LOG_LEVEL_WARN
+	#define HZ_CORE_WARN(...)							HZ_LOG_SUBMIT(::Hazel::Log::GetCoreLogger(), spdlog::level::warn, __VA_ARGS__)
+	#define HZ_WARN(...)								HZ_LOG_SUBMIT(::Hazel::Log::GetClientLogger(), spdlog::level::warn, __VA_ARGS__)
+	#define HZ_CORE_WARN_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_RATE_LIMITED(::Hazel::Log::GetCoreLogger(), spdlog::level::warn, maxPerSecond, __VA_ARGS__)
+#else
+	#define HZ_CORE_WARN(...)							HZ_LOG_DISABLED()
+	#define HZ_WARN(...)								HZ_LOG_DISABLED()
+	#define HZ_CORE_WARN_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_DISABLED()
+#endif
+
+#if HZ_LOG_ACTIVE_LEVEL <= HZ_LOG_LEVEL_ERROR
+	#define HZ_CORE_ERROR(...)							HZ_LOG_SUBMIT(::Hazel::Log::GetCoreLogger(), spdlog::level::err, __VA_ARGS__)
+	#define HZ_ERROR(...)								HZ_LOG_SUBMIT(::Hazel::Log::GetClientLogger(), spdlog::level::err, __VA_ARGS__)
+	#define HZ_CORE_ERROR_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_RATE_LIMITED(::Hazel::Log::GetCoreLogger(), spdlog::level::err, maxPerSecond, __VA_ARGS__)
+#else
+	#define HZ_CORE_ERROR(...)							HZ_LOG_DISABLED()
+	#define HZ_ERROR(...)								HZ_LOG_DISABLED()
+	#define HZ_CORE_ERROR_RATE_LIMITED(maxPerSecond, ...)	HZ_LOG_DISABLED()
+#endif
+
+#if HZ_LOG_ACTIVE_LEVEL <= HZ_LOG_LEVEL_CRITICAL
+	#define HZ_CORE_CRITICAL(...)						HZ_LOG_SUBMIT(::Hazel::Log::GetCoreLogger(), spdlog::level::critical, __VA_ARGS__)
+	#define HZ_CRITICAL(...)							HZ_LOG_SUBMIT(::Hazel::Log::GetClientLogger(), spdlog::level::critical, __VA_ARGS__)
+#else
+	#define HZ_CORE_CRITICAL(...)						HZ_LOG_DISABLED()
+	#define HZ_CRITICAL(...)							HZ_LOG_DISABLED()
+#endif
+
+// 兼容旧名字
+#define HZ_CORE_FATAL(...)	HZ_CORE_CRITICAL(__VA_ARGS__)
+#define HZ_FATAL(...)		HZ_CRITICAL(__VA_ARGS__)
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Hazel {
+
+	struct BoundingSphere
+	{
+		glm::vec3 Center = { 0.0f, 0.0f, 0.0f };
+		float Radius = 0.0f;
+
+		// 变换到世界空间；非等比缩放时取最大轴，结果是保守的
+		BoundingSphere Transformed(const glm::mat4& transform) const
+		{
+			BoundingSphere result;
+			result.Center = glm::vec3(transform * glm::vec4(Center, 1.0f));
+			float scaleX = glm::dot(glm::vec3(transform[0]), glm::vec3(transform[0]));
+			float scaleY = glm::dot(glm::vec3(transform[1]), glm::vec3(transform[1]));
+			float scaleZ = glm::dot(glm::vec3(transform[2]), glm::vec3(transform[2]));
+			result.Radius = Radius * std::sqrt(std::max(scaleX, std::max(scaleY, scaleZ)));
+			return result;
+		}
+	};
+
+	// 轴对齐包围盒
+	struct AABB
+	{
+		glm::vec3 Min = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 Max = { 0.0f, 0.0f, 0.0f };
+
+		glm::vec3 GetCenter() const { return (Min + Max) * 0.5f; }
+		glm::vec3 GetExtents() const { return (Max - Min) * 0.5f; }
+
+		// 变换后重新求轴对齐包围盒：中心直接变换，半长乘以矩阵 3x3 部分的绝对值
+		AABB Transformed(const glm::mat4& transform) const
+		{
+			glm::vec3 center = glm::vec3(transform * glm::vec4(GetCenter(), 1.0f));
+			glm::vec3 extents = GetExtents();
+			glm::vec3 worldExtents = glm::abs(glm::vec3(transform[0])) * extents.x
+				+ glm::abs(glm::vec3(transform[1])) * extents.y
+				+ glm::abs(glm::vec3(transform[2])) * extents.z;
+
+			AABB result;
+			result.Min = center - worldExtents;
+			result.Max = center + worldExtents;
+			return result;
+		}
+	};
+
+	// 视锥的 6 个平面（xyz 为朝内的法线，w 为距离），从 ViewProjection 矩阵提取
+	// 裁剪空间 z 按 [0, 1]（D3D 约定）
+	struct Frustum
+	{
+		glm::vec4 Planes[6];
+
+		Frustum() = default;
+		explicit Frustum(const glm::mat4& viewProjection)
+		{
+			// glm 按列存储，取行
+			glm::vec4 row0(viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0]);
+			glm::vec4 row1(viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1]);
+			glm::vec4 row2(viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2]);
+			glm::vec4 row3(viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3]);
+
+			Planes[0] = row3 + row0;	// left
+			Planes[1] = row3 - row0;	// right
+			Planes[2] = row3 + row1;	// bottom
+			Planes[3] = row3 - row1;	// top
+			Planes[4] = row2;			// near
+			Planes[5] = row3 - row2;	// far
+
+			for (glm::vec4& plane : Planes)
+				plane /= glm::length(glm::vec3(plane));
+		}
+
+		bool Intersects(const BoundingSphere& sphere) const
+		{
+			for (const glm::vec4& plane : Planes)
+			{
+				if (glm::dot(glm::vec3(plane), sphere.Center) + plane.w < -sphere.Radius)
+					return false;
+			}
+			return true;
+		}
+
+		// 盒子在法线方向上的投影半径，完全在某个平面外侧才剔除
+		bool Intersects(const AABB& box) const
+		{
+			glm::vec3 center = box.GetCenter();
+			glm::vec3 extents = box.GetExtents();
+			for (const glm::vec4& plane : Planes)
+			{
+				glm::vec3 normal(plane);
+				float radius = glm::dot(glm::abs(normal), extents);
+				if (glm::dot(normal, center) + plane.w < -radius)
+					return false;
+			}
+			return true;
+		}
+	};
+
+}
@@ -0,0 +1,547 @@
+#include "hzpch.h"
+#include "SimdMath.h"
+
+#include <cmath>
+#include <type_traits>
+
+// HZ_SIMD_SCALAR 强制走标量实现，用来对比结果或排查指令集相关的问题
+#if !defined(HZ_SIMD_SCALAR)
+	#if defined(__AVX2__)
+		#define HZ_SIMD_AVX2 1
+	#endif
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		#define HZ_SIMD_SSE2 1
+		#include <immintrin.h>
+	#elif defined(__aarch64__) || defined(_M_ARM64)
+		#define HZ_SIMD_NEON 1
+		#include <arm_neon.h>
+	#endif
+#endif
+
+namespace Hazel {
+
+	static_assert(sizeof(TransformTRS) == sizeof(float) * 9, "TransformTRS must be 9 tightly packed floats");
+	static_assert(sizeof(BoundingSphere) == sizeof(float) * 4, "BoundingSphere must be 4 tightly packed floats");
+	static_assert(sizeof(AABB) == sizeof(float) * 6, "AABB must be 6 tightly packed floats");
+	static_assert(sizeof(glm::mat4) == sizeof(float) * 16, "glm::mat4 must be 16 tightly packed floats");
+
+	// 每种指令集一个 Ops，内核写成模板，同一份代码按 Width 个元素一组处理
+	// 只用乘法和加法，不用 FMA：各指令集和标量的结果逐位一致，运算顺序也和 glm 一致
+	struct ScalarOps
+	{
+		using Vec = float;
+		using Mask = bool;
+		static constexpr size_t Width = 1;
+
+		static inline Vec Splat(float x) { return x; }
+		static inline Vec Load(const float* p) { return *p; }
+		static inline void Store(float* p, Vec v) { *p = v; }
+		static inline Vec Add(Vec a, Vec b) { return a + b; }
+		static inline Vec Sub(Vec a, Vec b) { return a - b; }
+		static inline Vec Mul(Vec a, Vec b) { return a * b; }
+		static inline Vec Abs(Vec a) { return std::fabs(a); }
+		static inline Vec Max(Vec a, Vec b) { return a > b ? a : b; }
+		static inline Vec Sqrt(Vec a) { return std::sqrt(a); }
+		static inline Vec Round(Vec a) { return std::nearbyint(a); }
+		static inline Mask Less(Vec a, Vec b) { return a < b; }
+		static inline Mask Equal(Vec a, Vec b) { return a == b; }
+		static inline Mask Or(Mask a, Mask b) { return a || b; }
+		static inline Vec Select(Mask m, Vec a, Vec b) { return m ? a : b; }
+		static inline uint32_t Bits(Mask m) { return m ? 1u : 0u; }
+	};
+
+#if defined(HZ_SIMD_SSE2)
+	struct SseOps
+	{
+		using Vec = __m128;
+		using Mask = __m128;
+		static constexpr size_t Width = 4;
+
+		static inline Vec Splat(float x) { return _mm_set1_ps(x); }
+		static inline Vec Load(const float* p) { return _mm_loadu_ps(p); }
+		static inline void Store(float* p, Vec v) { _mm_storeu_ps(p, v); }
+		static inline Vec Add(Vec a, Vec b) { return _mm_add_ps(a, b); }
+		static inline Vec Sub(Vec a, Vec b) { return _mm_sub_ps(a, b); }
+		static inline Vec Mul(Vec a, Vec b) { return _mm_mul_ps(a, b); }
+		static inline Vec Abs(Vec a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+		static inline Vec Max(Vec a, Vec b) { return _mm_max_ps(a, b); }
+		static inline Vec Sqrt(Vec a) { return _mm_sqrt_ps(a); }
+		// 默认舍入模式是就近取偶，和 nearbyint 一致
+		static inline Vec Round(Vec a) { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+		static inline Mask Less(Vec a, Vec b) { return _mm_cmplt_ps(a, b); }
+		static inline Mask Equal(Vec a, Vec b) { return _mm_cmpeq_ps(a, b); }
+		static inline Mask Or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+		static inline Vec Select(Mask m, Vec a, Vec b) { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+		static inline uint32_t Bits(Mask m) { return (uint32_t)_mm_movemask_ps(m); }
+	};
+#endif
+
+#if defined(HZ_SIMD_AVX2)
+	struct AvxOps
+	{
+		using Vec = __m256;
+		using Mask = __m256;
+		static constexpr size_t Width = 8;
+
+		static inline Vec Splat(float x) { return _mm256_set1_ps(x); }
+		static inline Vec Load(const float* p) { return _mm256_loadu_ps(p); }
+		static inline void Store(float* p, Vec v) { _mm256_storeu_ps(p, v); }
+		static inline Vec Add(Vec a, Vec b) { return _mm256_add_ps(a, b); }
+		static inline Vec Sub(Vec a, Vec b) { return _mm256_sub_ps(a, b); }
+		static inline Vec Mul(Vec a, Vec b) { return _mm256_mul_ps(a, b); }
+		static inline Vec Abs(Vec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+		static inline Vec Max(Vec a, Vec b) { return _mm256_max_ps(a, b); }
+		static inline Vec Sqrt(Vec a) { return _mm256_sqrt_ps(a); }
+		static inline Vec Round(Vec a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+		static inline Mask Less(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+		static inline Mask Equal(Vec a, Vec b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+		static inline Mask Or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+		static inline Vec Select(Mask m, Vec a, Vec b) { return _mm256_blendv_ps(b, a, m); }
+		static inline uint32_t Bits(Mask m) { return (uint32_t)_mm256_movemask_ps(m); }
+	};
+#endif
+
+#if defined(HZ_SIMD_NEON)
+	struct NeonOps
+	{
+		using Vec = float32x4_t;
+		using Mask = uint32x4_t;
+		static constexpr size_t Width = 4;
+
+		static inline Vec Splat(float x) { return vdupq_n_f32(x); }
+		static inline Vec Load(const float* p) { return vld1q_f32(p); }
+		static inline void Store(float* p, Vec v) { vst1q_f32(p, v); }
+		static inline Vec Add(Vec a, Vec b) { return vaddq_f32(a, b); }
+		static inline Vec Sub(Vec a, Vec b) { return vsubq_f32(a, b); }
+		static inline Vec Mul(Vec a, Vec b) { return vmulq_f32(a, b); }
+		static inline Vec Abs(Vec a) { return vabsq_f32(a); }
+		static inline Vec Max(Vec a, Vec b) { return vmaxq_f32(a, b); }
+		static inline Vec Sqrt(Vec a) { return vsqrtq_f32(a); }
+		static inline Vec Round(Vec a) { return vrndnq_f32(a); }
+		static inline Mask Less(Vec a, Vec b) { return vcltq_f32(a, b); }
+		static inline Mask Equal(Vec a, Vec b) { return vceqq_f32(a, b); }
+		static inline Mask Or(Mask a, Mask b) { return vorrq_u32(a, b); }
+		static inline Vec Select(Mask m, Vec a, Vec b) { return vbslq_f32(m, a, b); }
+		static inline uint32_t Bits(Mask m)
+		{
+			static const int32_t s_Shifts[4] = { 0, 1, 2, 3 };
+			return vaddvq_u32(vshlq_u32(vshrq_n_u32(m, 31), vld1q_s32(s_Shifts)));
+		}
+	};
+#endif
+
+	// 批量内核用最宽的指令集，单个矩阵的运算用 4 宽
+#if defined(HZ_SIMD_AVX2)
+	using WideOps = AvxOps;
+#elif defined(HZ_SIMD_SSE2)
+	using WideOps = SseOps;
+#elif defined(HZ_SIMD_NEON)
+	using WideOps = NeonOps;
+#else
+	using WideOps = ScalarOps;
+#endif
+
+#if defined(HZ_SIMD_SSE2)
+	using Vec4Ops = SseOps;
+#elif defined(HZ_SIMD_NEON)
+	using Vec4Ops = NeonOps;
+#endif
+
+	// 同时求 sin / cos：按 pi/2 缩减到 [-pi/4, pi/4]（Cody-Waite 三段常数），
+	// 多项式为 Cephes 的 sinf/cosf 系数，再按象限交换、取反，误差约 1e-7
+	template<typename S>
+	static inline void SinCos(typename S::Vec x, typename S::Vec& outSin, typename S::Vec& outCos)
+	{
+		using Vec = typename S::Vec;
+		using Mask = typename S::Mask;
+
+		Vec quadrant = S::Round(S::Mul(x, S::Splat(0.63661977236758134f)));
+		Vec r = S::Sub(x, S::Mul(quadrant, S::Splat(1.5703125f)));
+		r = S::Sub(r, S::Mul(quadrant, S::Splat(4.837512969970703125e-4f)));
+		r = S::Sub(r, S::Mul(quadrant, S::Splat(7.54978995489188216e-8f)));
+		Vec r2 = S::Mul(r, r);
+
+		Vec sinPoly = S::Add(S::Splat(8.3321608736e-3f), S::Mul(r2, S::Splat(-1.9515295891e-4f)));
+		sinPoly = S::Add(S::Splat(-1.6666654611e-1f), S::Mul(r2, sinPoly));
+		Vec sinR = S::Add(r, S::Mul(S::Mul(r, r2), sinPoly));
+
+		Vec cosPoly = S::Add(S::Splat(-1.388731625493765e-3f), S::Mul(r2, S::Splat(2.443315711809948e-5f)));
+		cosPoly = S::Add(S::Splat(4.166664568298827e-2f), S::Mul(r2, cosPoly));
+		Vec cosR = S::Add(S::Sub(S::Splat(1.0f), S::Mul(S::Splat(0.5f), r2)), S::Mul(S::Mul(r2, r2), cosPoly));
+
+		// quadrant mod 4，floor(q / 4) = round(q / 4 - 0.375)，q 是整数所以不会落在 .5 上
+		Vec quadrantMod = S::Sub(quadrant, S::Mul(S::Splat(4.0f), S::Round(S::Sub(S::Mul(quadrant, S::Splat(0.25f)), S::Splat(0.375f)))));
+		Mask is1 = S::Equal(quadrantMod, S::Splat(1.0f));
+		Mask is2 = S::Equal(quadrantMod, S::Splat(2.0f));
+		Mask is3 = S::Equal(quadrantMod, S::Splat(3.0f));
+
+		Mask swap = S::Or(is1, is3);
+		Vec sinValue = S::Select(swap, cosR, sinR);
+		Vec cosValue = S::Select(swap, sinR, cosR);
+		Vec zero = S::Splat(0.0f);
+		outSin = S::Select(S::Or(is2, is3), S::Sub(zero, sinValue), sinValue);
+		outCos = S::Select(S::Or(is1, is2), S::Sub(zero, cosValue), cosValue);
+	}
+
+	// 把 Width 个矩阵的前三行（每列 xyz）转置成 lanes[列 * 3 + 行][lane]
+	template<size_t W>
+	static inline void GatherAffine(const glm::mat4* transforms, float (&lanes)[12][W])
+	{
+		for (size_t lane = 0; lane < W; lane++)
+		{
+			const float* m = &transforms[lane][0][0];
+			for (size_t col = 0; col < 4; col++)
+			{
+				lanes[col * 3 + 0][lane] = m[col * 4 + 0];
+				lanes[col * 3 + 1][lane] = m[col * 4 + 1];
+				lanes[col * 3 + 2][lane] = m[col * 4 + 2];
+			}
+		}
+	}
+
+	// 每个内核处理 count 中能凑满整组的部分，返回处理了多少个，剩下的交给 ScalarOps 版本
+
+	template<typename S>
+	static size_t ComposeTRSBlock(const TransformTRS* input, glm::mat4* out, size_t count)
+	{
+		using Vec = typename S::Vec;
+		constexpr size_t W = S::Width;
+		constexpr float degToRad = 0.01745329251994329576923690768489f;
+
+		size_t i = 0;
+		for (; i + W <= count; i += W)
+		{
+			alignas(32) float lanes[9][W];
+			for (size_t lane = 0; lane < W; lane++)
+			{
+				const float* src = &input[i + lane].Translation.x;
+				for (size_t k = 0; k < 9; k++)
+					lanes[k][lane] = src[k];
+			}
+
+			Vec sx, cx, sy, cy, sz, cz;
+			SinCos<S>(S::Mul(S::Load(lanes[3]), S::Splat(degToRad)), sx, cx);
+			SinCos<S>(S::Mul(S::Load(lanes[4]), S::Splat(degToRad)), sy, cy);
+			SinCos<S>(S::Mul(S::Load(lanes[5]), S::Splat(degToRad)), sz, cz);
+			Vec scaleX = S::Load(lanes[6]);
+			Vec scaleY = S::Load(lanes[7]);
+			Vec scaleZ = S::Load(lanes[8]);
+
+			// Rx * Ry * Rz 展开后的 3x3（按列），每列再乘对应的缩放
+			Vec sxsy = S::Mul(sx, sy);
+			Vec cxsy = S::Mul(cx, sy);
+			alignas(32) float result[9][W];
+			S::Store(result[0], S::Mul(S::Mul(cy, cz), scaleX));
+			S::Store(result[1], S::Mul(S::Add(S::Mul(cx, sz), S::Mul(sxsy, cz)), scaleX));
+			S::Store(result[2], S::Mul(S::Sub(S::Mul(sx, sz), S::Mul(cxsy, cz)), scaleX));
+			S::Store(result[3], S::Mul(S::Sub(S::Splat(0.0f), S::Mul(cy, sz)), scaleY));
+			S::Store(result[4], S::Mul(S::Sub(S::Mul(cx, cz), S::Mul(sxsy, sz)), scaleY));
+			S::Store(result[5], S::Mul(S::Add(S::Mul(sx, cz), S::Mul(cxsy, sz)), scaleY));
+			S::Store(result[6], S::Mul(sy, scaleZ));
+			S::Store(result[7], S::Mul(S::Sub(S::Splat(0.0f), S::Mul(sx, cy)), scaleZ));
+			S::Store(result[8], S::Mul(S::Mul(cx, cy), scaleZ));
+
+			for (size_t lane = 0; lane < W; lane++)
+			{
+				float* dst = &out[i + lane][0][0];
+				dst[0] = result[0][lane]; dst[1] = result[1][lane]; dst[2] = result[2][lane]; dst[3] = 0.0f;
+				dst[4] = result[3][lane]; dst[5] = result[4][lane]; dst[6] = result[5][lane]; dst[7] = 0.0f;
+				dst[8] = result[6][lane]; dst[9] = result[7][lane]; dst[10] = result[8][lane]; dst[11] = 0.0f;
+				dst[12] = lanes[0][lane]; dst[13] = lanes[1][lane]; dst[14] = lanes[2][lane]; dst[15] = 1.0f;
+			}
+		}
+		return i;
+	}
+
+	template<typename S>
+	static size_t TransformSpheresBlock(const glm::mat4* transforms, const BoundingSphere* local, const SphereSoA& out, size_t count)
+	{
+		using Vec = typename S::Vec;
+		constexpr size_t W = S::Width;
+
+		size_t i = 0;
+		for (; i + W <= count; i += W)
+		{
+			alignas(32) float m[12][W];
+			alignas(32) float sphere[4][W];
+			GatherAffine<W>(transforms + i, m);
+			for (size_t lane = 0; lane < W; lane++)
+			{
+				const float* src = &local[i + lane].Center.x;
+				sphere[0][lane] = src[0];
+				sphere[1][lane] = src[1];
+				sphere[2][lane] = src[2];
+				sphere[3][lane] = src[3];
+			}
+
+			Vec x = S::Load(sphere[0]);
+			Vec y = S::Load(sphere[1]);
+			Vec z = S::Load(sphere[2]);
+			for (size_t row = 0; row < 3; row++)
+			{
+				// 和 glm 的 mat4 * vec4 同样的加法顺序：(c0 * x + c1 * y) + (c2 * z + c3)
+				Vec center = S::Add(S::Add(S::Mul(S::Load(m[row]), x), S::Mul(S::Load(m[3 + row]), y)),
+					S::Add(S::Mul(S::Load(m[6 + row]), z), S::Load(m[9 + row])));
+				float* dst = row == 0 ? out.CenterX : (row == 1 ? out.CenterY : out.CenterZ);
+				S::Store(dst + i, center);
+			}
+
+			Vec maxScaleSq = S::Splat(0.0f);
+			for (size_t col = 0; col < 3; col++)
+			{
+				Vec mx = S::Load(m[col * 3 + 0]);
+				Vec my = S::Load(m[col * 3 + 1]);
+				Vec mz = S::Load(m[col * 3 + 2]);
+				Vec lengthSq = S::Add(S::Add(S::Mul(mx, mx), S::Mul(my, my)), S::Mul(mz, mz));
+				maxScaleSq = S::Max(maxScaleSq, lengthSq);
+			}
+			S::Store(out.Radius + i, S::Mul(S::Load(sphere[3]), S::Sqrt(maxScaleSq)));
+		}
+		return i;
+	}
+
+	// OutputT 为 AABB（AoS）或 BoxSoA
+	template<typename S, typename OutputT>
+	static size_t TransformAABBsBlock(const glm::mat4* transforms, const AABB* local, OutputT out, size_t count)
+	{
+		using Vec = typename S::Vec;
+		constexpr size_t W = S::Width;
+
+		size_t i = 0;
+		for (; i + W <= count; i += W)
+		{
+			alignas(32) float m[12][W];
+			alignas(32) float box[6][W];
+			GatherAffine<W>(transforms + i, m);
+			for (size_t lane = 0; lane < W; lane++)
+			{
+				const AABB& src = local[i + lane];
+				glm::vec3 center = src.GetCenter();
+				glm::vec3 extents = src.GetExtents();
+				box[0][lane] = center.x; box[1][lane] = center.y; box[2][lane] = center.z;
+				box[3][lane] = extents.x; box[4][lane] = extents.y; box[5][lane] = extents.z;
+			}
+
+			Vec cx = S::Load(box[0]), cy = S::Load(box[1]), cz = S::Load(box[2]);
+			Vec ex = S::Load(box[3]), ey = S::Load(box[4]), ez = S::Load(box[5]);
+			alignas(32) float result[6][W];
+			for (size_t row = 0; row < 3; row++)
+			{
+				Vec m0 = S::Load(m[row]);
+				Vec m1 = S::Load(m[3 + row]);
+				Vec m2 = S::Load(m[6 + row]);
+				Vec center = S::Add(S::Add(S::Mul(m0, cx), S::Mul(m1, cy)), S::Add(S::Mul(m2, cz), S::Load(m[9 + row])));
+				Vec extent = S::Add(S::Add(S::Mul(S::Abs(m0), ex), S::Mul(S::Abs(m1), ey)), S::Mul(S::Abs(m2), ez));
+				S::Store(result[row], center);
+				S::Store(result[3 + row], extent);
+			}
+
+			if constexpr (std::is_same_v<OutputT, BoxSoA>)
+			{
+				float* dst[6] = { out.CenterX, out.CenterY, out.CenterZ, out.ExtentX, out.ExtentY, out.ExtentZ };
+				for (size_t k = 0; k < 6; k++)
+					S::Store(dst[k] + i, S::Load(result[k]));
+			}
+			else
+			{
+				for (size_t lane = 0; lane < W; lane++)
+				{
+					glm::vec3 center(result[0][lane], result[1][lane], result[2][lane]);
+					glm::vec3 extents(result[3][lane], result[4][lane], result[5][lane]);
+					out[i + lane].Min = center - extents;
+					out[i + lane].Max = center + extents;
+				}
+			}
+		}
+		return i;
+	}
+
+	template<typename S>
+	struct FrustumPlanes
+	{
+		typename S::Vec Normal[6][3];
+		typename S::Vec Distance[6];
+
+		explicit FrustumPlanes(const Frustum& frustum)
+		{
+			for (size_t p = 0; p < 6; p++)
+			{
+				Normal[p][0] = S::Splat(frustum.Planes[p].x);
+				Normal[p][1] = S::Splat(frustum.Planes[p].y);
+				Normal[p][2] = S::Splat(frustum.Planes[p].z);
+				Distance[p] = S::Splat(frustum.Planes[p].w);
+			}
+		}
+	};
+
+	// 把一组的可见结果追加到 outVisible，不分支：每个 lane 都写，只有可见的才前移
+	static inline size_t AppendVisible(uint32_t outsideBits, size_t width, size_t base, uint32_t* outVisible, size_t visibleCount)
+	{
+		for (size_t lane = 0; lane < width; lane++)
+		{
+			outVisible[visibleCount] = (uint32_t)(base + lane);
+			visibleCount += ((outsideBits >> lane) & 1u) ^ 1u;
+		}
+		return visibleCount;
+	}
+
+	template<typename S>
+	static size_t CullSpheresBlock(const Frustum& frustum, const SphereSoA& spheres, size_t begin, size_t count, uint32_t* outVisible, size_t& visibleCount)
+	{
+		using Vec = typename S::Vec;
+		using Mask = typename S::Mask;
+		constexpr size_t W = S::Width;
+		FrustumPlanes<S> planes(frustum);
+		Vec zero = S::Splat(0.0f);
+
+		size_t i = begin;
+		for (; i + W <= count; i += W)
+		{
+			Vec x = S::Load(spheres.CenterX + i);
+			Vec y = S::Load(spheres.CenterY + i);
+			Vec z = S::Load(spheres.CenterZ + i);
+			Vec negRadius = S::Sub(zero, S::Load(spheres.Radius + i));
+
+			Mask outside = S::Less(zero, zero);
+			for (size_t p = 0; p < 6; p++)
+			{
+				Vec distance = S::Add(S::Mul(planes.Normal[p][0], x), S::Mul(planes.Normal[p][1], y));
+				distance = S::Add(S::Add(distance, S::Mul(planes.Normal[p][2], z)), planes.Distance[p]);
+				outside = S::Or(outside, S::Less(distance, negRadius));
+			}
+			visibleCount = AppendVisible(S::Bits(outside), W, i, outVisible, visibleCount);
+		}
+		return i;
+	}
+
+	template<typename S>
+	static size_t CullBoxesBlock(const Frustum& frustum, const BoxSoA& boxes, size_t begin, size_t count, uint32_t* outVisible, size_t& visibleCount)
+	{
+		using Vec = typename S::Vec;
+		using Mask = typename S::Mask;
+		constexpr size_t W = S::Width;
+		FrustumPlanes<S> planes(frustum);
+		Vec zero = S::Splat(0.0f);
+
+		size_t i = begin;
+		for (; i + W <= count; i += W)
+		{
+			Vec x = S::Load(boxes.CenterX + i);
+			Vec y = S::Load(boxes.CenterY + i);
+			Vec z = S::Load(boxes.CenterZ + i);
+			Vec ex = S::Load(boxes.ExtentX + i);
+			Vec ey = S::Load(boxes.ExtentY + i);
+			Vec ez = S::Load(boxes.ExtentZ + i);
+
+			Mask outside = S::Less(zero, zero);
+			for (size_t p = 0; p < 6; p++)
+			{
+				Vec radius = S::Add(S::Mul(S::Abs(planes.Normal[p][0]), ex), S::Mul(S::Abs(planes.Normal[p][1]), ey));
+				radius = S::Add(radius, S::Mul(S::Abs(planes.Normal[p][2]), ez));
+				Vec distance = S::Add(S::Mul(planes.Normal[p][0], x), S::Mul(planes.Normal[p][1], y));
+				distance = S::Add(S::Add(distance, S::Mul(planes.Normal[p][2], z)), planes.Distance[p]);
+				outside = S::Or(outside, S::Less(distance, S::Sub(zero, radius)));
+			}
+			visibleCount = AppendVisible(S::Bits(outside), W, i, outVisible, visibleCount);
+		}
+		return i;
+	}
+
+	static inline void MultiplyMatrix(const float* a, const float* b, float* out)
+	{
+#if defined(HZ_SIMD_SSE2) || defined(HZ_SIMD_NEON)
+		using S = Vec4Ops;
+		S::Vec a0 = S::Load(a), a1 = S::Load(a + 4), a2 = S::Load(a + 8), a3 = S::Load(a + 12);
+		for (size_t col = 0; col < 4; col++)
+		{
+			const float* bc = b + col * 4;
+			S::Vec r = S::Add(S::Add(S::Add(S::Mul(a0, S::Splat(bc[0])), S::Mul(a1, S::Splat(bc[1]))),
+				S::Mul(a2, S::Splat(bc[2]))), S::Mul(a3, S::Splat(bc[3])));
+			S::Store(out + col * 4, r);
+		}
+#else
+		float result[16];
+		for (size_t col = 0; col < 4; col++)
+		{
+			for (size_t row = 0; row < 4; row++)
+			{
+				result[col * 4 + row] = a[row] * b[col * 4] + a[4 + row] * b[col * 4 + 1]
+					+ a[8 + row] * b[col * 4 + 2] + a[12 + row] * b[col * 4 + 3];
+			}
+		}
+		for (size_t k = 0; k < 16; k++)
+			out[k] = result[k];
+#endif
+	}
+
+	const char* SimdMath::GetInstructionSet()
+	{
+#if defined(HZ_SIMD_AVX2)
+		return "AVX2";
+#elif defined(HZ_SIMD_SSE2)
+		return "SSE2";
+#elif defined(HZ_SIMD_NEON)
+		return "NEON";
+#else
+		return "Scalar";
+#endif
+	}
+
+	void SimdMath::ComposeTRS(const TransformTRS* input, glm::mat4* out, size_t count)
+	{
+		size_t done = ComposeTRSBlock<WideOps>(input, out, count);
+		ComposeTRSBlock<ScalarOps>(input + done, out + done, count - done);
+	}
+
+	void SimdMath::MultiplyMatrices(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count)
+	{
+		for (size_t i = 0; i < count; i++)
+			MultiplyMatrix(&a[i][0][0], &b[i][0][0], &out[i][0][0]);
+	}
+
+	void SimdMath::MultiplyMatrices(const glm::mat4& a, const glm::mat4* b, glm::mat4* out, size_t count)
+	{
+		// out 可能就是 a 所在的数组，先拷一份
+		const glm::mat4 parent = a;
+		for (size_t i = 0; i < count; i++)
+			MultiplyMatrix(&parent[0][0], &b[i][0][0], &out[i][0][0]);
+	}
+
+	void SimdMath::TransformAABBs(const glm::mat4* transforms, const AABB* local, AABB* out, size_t count)
+	{
+		size_t done = TransformAABBsBlock<WideOps>(transforms, local, out, count);
+		TransformAABBsBlock<ScalarOps>(transforms + done, local + done, out + done, count - done);
+	}
+
+	void SimdMath::TransformAABBs(const glm::mat4* transforms, const AABB* local, const BoxSoA& out, size_t count)
+	{
+		size_t done = TransformAABBsBlock<WideOps>(transforms, local, out, count);
+		BoxSoA tail = { out.CenterX + done, out.CenterY + done, out.CenterZ + done,
+			out.ExtentX + done, out.ExtentY + done, out.ExtentZ + done };
+		TransformAABBsBlock<ScalarOps>(transforms + done, local + done, tail, count - done);
+	}
+
+	void SimdMath::TransformSpheres(const glm::mat4* transforms, const BoundingSphere* local, const SphereSoA& out, size_t count)
+	{
+		size_t done = TransformSpheresBlock<WideOps>(transforms, local, out, count);
+		SphereSoA tail = { out.CenterX + done, out.CenterY + done, out.CenterZ + done, out.Radius + done };
+		TransformSpheresBlock<ScalarOps>(transforms + done, local + done, tail, count - done);
+	}
+
+	size_t SimdMath::CullSpheres(const Frustum& frustum, const SphereSoA& spheres, size_t count, uint32_t* outVisible)
+	{
+		size_t visibleCount = 0;
+		size_t done = CullSpheresBlock<WideOps>(frustum, spheres, 0, count, outVisible, visibleCount);
+		CullSpheresBlock<ScalarOps>(frustum, spheres, done, count, outVisible, visibleCount);
+		return visibleCount;
+	}
+
+	size_t SimdMath::CullBoxes(const Frustum& frustum, const BoxSoA& boxes, size_t count, uint32_t* outVisible)
+	{
+		size_t visibleCount = 0;
+		size_t done = CullBoxesBlock<WideOps>(frustum, boxes, 0, count, outVisible, visibleCount);
+		CullBoxesBlock<ScalarOps>(frustum, boxes, done, count, outVisible, visibleCount);
+		return visibleCount;
+	}
+
+}
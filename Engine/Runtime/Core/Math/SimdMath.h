@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Math/Bounds.h"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Hazel {
+
+	// 批量数学运算，一次处理一整个数组
+	// - 编译期选择指令集：AVX2（需要 /arch:AVX2 或 -mavx2）> SSE2 > NEON > 标量，不满一组的尾部走标量
+	// - 输入输出直接用 glm 类型，结果和对应的 glm 写法在浮点误差内一致
+	// - 剔除相关的数据用 SoA 布局（每个分量一个数组），指针由调用方提供，一般从 FrameArena 分配
+
+	// 和 TransformComponent 的三个字段布局相同，Rotation 为欧拉角（度）
+	struct TransformTRS
+	{
+		glm::vec3 Translation = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 Rotation = { 0.0f, 0.0f, 0.0f };
+		glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
+	};
+
+	// 包围球数组，SoA
+	struct SphereSoA
+	{
+		float* CenterX = nullptr;
+		float* CenterY = nullptr;
+		float* CenterZ = nullptr;
+		float* Radius = nullptr;
+	};
+
+	// 包围盒数组，SoA，中心 + 半长
+	struct BoxSoA
+	{
+		float* CenterX = nullptr;
+		float* CenterY = nullptr;
+		float* CenterZ = nullptr;
+		float* ExtentX = nullptr;
+		float* ExtentY = nullptr;
+		float* ExtentZ = nullptr;
+	};
+
+	class HAZEL_API SimdMath
+	{
+	public:
+		// 当前编译使用的指令集："AVX2" / "SSE2" / "NEON" / "Scalar"
+		static const char* GetInstructionSet();
+
+		// out[i] = T * Rx * Ry * Rz * S，与 TransformComponent::GetTransform 一致
+		static void ComposeTRS(const TransformTRS* input, glm::mat4* out, size_t count);
+
+		// out[i] = a[i] * b[i]
+		static void MultiplyMatrices(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count);
+		// out[i] = a * b[i]（父节点乘一组子节点）
+		static void MultiplyMatrices(const glm::mat4& a, const glm::mat4* b, glm::mat4* out, size_t count);
+
+		// 与 AABB::Transformed 一致（中心变换，半长乘矩阵绝对值）
+		static void TransformAABBs(const glm::mat4* transforms, const AABB* local, AABB* out, size_t count);
+		static void TransformAABBs(const glm::mat4* transforms, const AABB* local, const BoxSoA& out, size_t count);
+
+		// 与 BoundingSphere::Transformed 一致
+		static void TransformSpheres(const glm::mat4* transforms, const BoundingSphere* local, const SphereSoA& out, size_t count);
+
+		// 视锥测试，与 Frustum::Intersects 结果一致
+		// 可见的下标按升序写入 outVisible（容量至少 count），返回可见数量
+		static size_t CullSpheres(const Frustum& frustum, const SphereSoA& spheres, size_t count, uint32_t* outVisible);
+		static size_t CullBoxes(const Frustum& frustum, const BoxSoA& boxes, size_t count, uint32_t* outVisible);
+	};
+
+}
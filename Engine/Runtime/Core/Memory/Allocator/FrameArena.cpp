@@ -0,0 +1,176 @@
+#include "hzpch.h"
+#include "FrameArena.h"
+
+namespace Hazel {
+
+	namespace {
+
+		// 线程本地的分配游标，只对应当前帧槽
+		struct ThreadCursor
+		{
+			uint32_t Slot = ~0u;
+			uint64_t Generation = ~0ull;
+			uint8_t* Current = nullptr;
+			uint8_t* End = nullptr;
+		};
+
+		thread_local ThreadCursor t_Cursor;
+
+		inline uint8_t* AlignForward(uint8_t* ptr, size_t alignment)
+		{
+			uintptr_t value = reinterpret_cast<uintptr_t>(ptr);
+			return reinterpret_cast<uint8_t*>((value + alignment - 1) & ~(uintptr_t)(alignment - 1));
+		}
+
+	}
+
+	FrameArena& FrameArena::Get()
+	{
+		static FrameArena instance;
+		return instance;
+	}
+
+	FrameArena::~FrameArena()
+	{
+		Shutdown();
+	}
+
+	void FrameArena::Initialize(const FrameArenaConfig& config)
+	{
+		HZ_CORE_ASSERT(!m_Initialized, "FrameArena already initialized");
+		HZ_CORE_ASSERT(config.FramesInFlight > 0 && config.FramesInFlight <= s_MaxFramesInFlight, "FrameArena: invalid frames in flight");
+
+		m_Config = config;
+		if (m_Config.FramesInFlight == 0 || m_Config.FramesInFlight > s_MaxFramesInFlight)
+			m_Config.FramesInFlight = s_MaxFramesInFlight;
+		m_Initialized = true;
+	}
+
+	void FrameArena::Shutdown()
+	{
+		for (FrameSlot& slot : m_Slots)
+			ReleaseSlot(slot);
+
+		std::lock_guard<std::mutex> lock(m_FreeMutex);
+		for (Block& block : m_FreeBlocks)
+			delete[] block.Data;
+		m_FreeBlocks.clear();
+		m_BlocksAllocated = 0;
+		m_Initialized = false;
+	}
+
+	void FrameArena::BeginFrame(uint64_t frameIndex)
+	{
+		uint32_t slotIndex = (uint32_t)(frameIndex % m_Config.FramesInFlight);
+
+		// 这个槽上一次使用是 FramesInFlight 帧之前，GPU/其他线程已经不会再访问
+		ReleaseSlot(m_Slots[slotIndex]);
+
+		m_FrameIndex.store(frameIndex, std::memory_order_release);
+		m_CurrentSlot.store(slotIndex, std::memory_order_release);
+	}
+
+	void* FrameArena::Allocate(size_t size, size_t alignment)
+	{
+		if (size == 0)
+			size = 1;
+
+		uint32_t slotIndex = m_CurrentSlot.load(std::memory_order_acquire);
+		FrameSlot& slot = m_Slots[slotIndex];
+		uint64_t generation = slot.Generation.load(std::memory_order_acquire);
+
+		ThreadCursor& cursor = t_Cursor;
+		if (cursor.Slot != slotIndex || cursor.Generation != generation)
+		{
+			cursor.Slot = slotIndex;
+			cursor.Generation = generation;
+			cursor.Current = nullptr;
+			cursor.End = nullptr;
+		}
+
+		if (cursor.Current)
+		{
+			uint8_t* aligned = AlignForward(cursor.Current, alignment);
+			if (aligned + size <= cursor.End)
+			{
+				cursor.Current = aligned + size;
+				slot.BytesAllocated.fetch_add(size, std::memory_order_relaxed);
+				return aligned;
+			}
+		}
+
+		Block block = AcquireBlock(slot, size + alignment);
+		uint8_t* aligned = AlignForward(block.Data, alignment);
+		slot.BytesAllocated.fetch_add(size, std::memory_order_relaxed);
+
+		// 超大块单独使用，不替换当前块
+		if (!block.Oversized)
+		{
+			cursor.Current = aligned + size;
+			cursor.End = block.Data + block.Size;
+		}
+		return aligned;
+	}
+
+	FrameArena::Block FrameArena::AcquireBlock(FrameSlot& slot, size_t minSize)
+	{
+		Block block;
+		if (minSize > m_Config.BlockSize / 2)
+		{
+			block.Data = new uint8_t[minSize];
+			block.Size = minSize;
+			block.Oversized = true;
+			std::lock_guard<std::mutex> lock(m_FreeMutex);
+			m_BlocksAllocated++;
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(m_FreeMutex);
+			if (!m_FreeBlocks.empty())
+			{
+				block = m_FreeBlocks.back();
+				m_FreeBlocks.pop_back();
+			}
+			else
+			{
+				block.Data = new uint8_t[m_Config.BlockSize];
+				block.Size = m_Config.BlockSize;
+				m_BlocksAllocated++;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(slot.Mutex);
+		slot.UsedBlocks.push_back(block);
+		return block;
+	}
+
+	void FrameArena::ReleaseSlot(FrameSlot& slot)
+	{
+		slot.Generation.fetch_add(1, std::memory_order_acq_rel);
+		slot.BytesAllocated.store(0, std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> slotLock(slot.Mutex);
+		std::lock_guard<std::mutex> freeLock(m_FreeMutex);
+		for (Block& block : slot.UsedBlocks)
+		{
+			if (block.Oversized)
+				delete[] block.Data;
+			else
+				m_FreeBlocks.push_back(block);
+		}
+		slot.UsedBlocks.clear();
+	}
+
+	FrameArena::Statistics FrameArena::GetStatistics() const
+	{
+		Statistics stats;
+		{
+			std::lock_guard<std::mutex> lock(m_FreeMutex);
+			stats.BlocksAllocated = m_BlocksAllocated;
+			stats.BlocksFree = m_FreeBlocks.size();
+		}
+		stats.BytesThisFrame = m_Slots[m_CurrentSlot.load(std::memory_order_acquire)].BytesAllocated.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+}
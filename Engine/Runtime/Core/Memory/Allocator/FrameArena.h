@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Hazel {
+
+	struct FrameArenaConfig
+	{
+		// 每个线程每次从全局池拿一整块，块内线性分配
+		size_t BlockSize = 256 * 1024;
+		// 第N帧分配的内存在第N+FramesInFlight帧开始时回收（和PerFrameCommandListAllocator保持一致）
+		uint32_t FramesInFlight = 3;
+	};
+
+	// 帧线性分配器
+	// - 每个线程有自己的当前块，分配只是移动指针，不加锁
+	// - 块用完才去全局空闲链表拿新块（加锁，很少发生）
+	// - 不支持单独释放，整帧的块在 FramesInFlight 帧之后一起回收
+	// 只用于生命周期不超过 FramesInFlight 帧的临时数据
+	class HAZEL_API FrameArena
+	{
+	public:
+		static constexpr uint32_t s_MaxFramesInFlight = 8;
+	public:
+		static FrameArena& Get();
+
+		void Initialize(const FrameArenaConfig& config);
+		void Shutdown();
+
+		// 主线程每帧开始调用，回收 frameIndex - FramesInFlight 帧的内存
+		void BeginFrame(uint64_t frameIndex);
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		T* AllocateArray(size_t count)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		inline uint64_t GetFrameIndex() const { return m_FrameIndex.load(std::memory_order_acquire); }
+		inline uint32_t GetFramesInFlight() const { return m_Config.FramesInFlight; }
+
+		struct Statistics
+		{
+			size_t BlocksAllocated = 0;		// 向系统申请过的块（含超大块）
+			size_t BlocksFree = 0;
+			size_t BytesThisFrame = 0;
+		};
+		Statistics GetStatistics() const;
+	private:
+		FrameArena() = default;
+		~FrameArena();
+
+		struct Block
+		{
+			uint8_t* Data = nullptr;
+			size_t Size = 0;
+			bool Oversized = false;
+		};
+
+		struct FrameSlot
+		{
+			// 每次回收 +1，线程本地缓存的块在代数不一致时作废
+			std::atomic<uint64_t> Generation{ 0 };
+			std::mutex Mutex;
+			std::vector<Block> UsedBlocks;
+			std::atomic<size_t> BytesAllocated{ 0 };
+		};
+
+		Block AcquireBlock(FrameSlot& slot, size_t minSize);
+		void ReleaseSlot(FrameSlot& slot);
+	private:
+		FrameArenaConfig m_Config;
+		bool m_Initialized = false;
+
+		std::atomic<uint64_t> m_FrameIndex{ 0 };
+		std::atomic<uint32_t> m_CurrentSlot{ 0 };
+		FrameSlot m_Slots[s_MaxFramesInFlight];
+
+		mutable std::mutex m_FreeMutex;
+		std::vector<Block> m_FreeBlocks;
+		size_t m_BlocksAllocated = 0;
+	};
+
+	// STL 分配器适配，deallocate 为空操作
+	//	FrameVector<D3D12_CPU_DESCRIPTOR_HANDLE> handles(count);
+	template<typename T>
+	class FrameAllocator
+	{
+	public:
+		using value_type = T;
+
+		FrameAllocator() noexcept = default;
+		template<typename U>
+		FrameAllocator(const FrameAllocator<U>&) noexcept {}
+
+		T* allocate(size_t count)
+		{
+			return static_cast<T*>(FrameArena::Get().Allocate(sizeof(T) * count, alignof(T)));
+		}
+
+		void deallocate(T*, size_t) noexcept {}
+
+		template<typename U>
+		bool operator==(const FrameAllocator<U>&) const noexcept { return true; }
+		template<typename U>
+		bool operator!=(const FrameAllocator<U>&) const noexcept { return false; }
+	};
+
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+}
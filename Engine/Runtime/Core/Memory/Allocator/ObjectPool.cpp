@@ -0,0 +1,225 @@
+#include "hzpch.h"
+#include "ObjectPool.h"
+
+namespace Hazel {
+
+	namespace {
+
+		// 池注册表，线程退出时用来判断缓存的块还能不能还回去
+		// 索引不复用，池析构后对应槽位置空
+		struct PoolRegistry
+		{
+			std::mutex Mutex;
+			FixedBlockPool* Pools[FixedBlockPool::s_MaxCachedPools] = {};
+			uint32_t NextIndex = 0;
+		};
+
+		PoolRegistry& GetRegistry()
+		{
+			// 故意不析构：静态析构阶段仍可能有线程退出或对象归还
+			static PoolRegistry* registry = new PoolRegistry();
+			return *registry;
+		}
+
+		constexpr uint32_t s_InvalidCacheIndex = ~0u;
+		constexpr size_t s_SizeClassCount = FixedBlockPool::s_MaxSizeClassBytes / FixedBlockPool::s_SizeClassGranularity;
+
+		inline size_t AlignUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1) & ~(alignment - 1);
+		}
+
+	}
+
+	// 线程本地的空闲链表缓存，按池的注册索引存放
+	struct PoolThreadCacheTable
+	{
+		struct Cache
+		{
+			FixedBlockPool::FreeNode* Head = nullptr;
+			uint32_t Count = 0;
+		};
+		Cache Caches[FixedBlockPool::s_MaxCachedPools];
+
+		~PoolThreadCacheTable()
+		{
+			// 线程退出，把缓存的块还给仍然存活的池
+			PoolRegistry& registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			for (uint32_t i = 0; i < FixedBlockPool::s_MaxCachedPools; i++)
+			{
+				Cache& cache = Caches[i];
+				FixedBlockPool* pool = registry.Pools[i];
+				if (!cache.Head || !pool)
+					continue;
+
+				FixedBlockPool::FreeNode* tail = cache.Head;
+				while (tail->Next)
+					tail = tail->Next;
+				pool->PushBatch(cache.Head, tail, cache.Count);
+				cache.Head = nullptr;
+				cache.Count = 0;
+			}
+		}
+	};
+
+	static thread_local PoolThreadCacheTable t_PoolCaches;
+
+	FixedBlockPool::FixedBlockPool(size_t blockSize, size_t blockAlignment, uint32_t blocksPerChunk)
+		: m_BlockAlignment(blockAlignment < alignof(FreeNode) ? alignof(FreeNode) : blockAlignment),
+		m_BlocksPerChunk(blocksPerChunk > 0 ? blocksPerChunk : 1),
+		m_CacheIndex(s_InvalidCacheIndex)
+	{
+		HZ_CORE_ASSERT((m_BlockAlignment & (m_BlockAlignment - 1)) == 0, "FixedBlockPool: alignment must be a power of two");
+		m_BlockSize = AlignUp(blockSize < sizeof(FreeNode) ? sizeof(FreeNode) : blockSize, m_BlockAlignment);
+
+		PoolRegistry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		if (registry.NextIndex < s_MaxCachedPools)
+		{
+			m_CacheIndex = registry.NextIndex++;
+			registry.Pools[m_CacheIndex] = this;
+		}
+	}
+
+	FixedBlockPool::~FixedBlockPool()
+	{
+		if (m_CacheIndex != s_InvalidCacheIndex)
+		{
+			PoolRegistry& registry = GetRegistry();
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			registry.Pools[m_CacheIndex] = nullptr;
+
+			// 其他线程的缓存在它们退出时发现池已注销会直接丢弃，这里只清当前线程
+			t_PoolCaches.Caches[m_CacheIndex] = {};
+		}
+
+		for (void* chunk : m_Chunks)
+			::operator delete(chunk, std::align_val_t(m_BlockAlignment));
+		m_Chunks.clear();
+	}
+
+	void* FixedBlockPool::Allocate()
+	{
+		if (m_CacheIndex == s_InvalidCacheIndex)
+		{
+			uint32_t count = 0;
+			return PopBatch(1, count);
+		}
+
+		PoolThreadCacheTable::Cache& cache = t_PoolCaches.Caches[m_CacheIndex];
+		if (!cache.Head)
+			cache.Head = PopBatch(s_CacheBatchSize, cache.Count);
+
+		FreeNode* node = cache.Head;
+		cache.Head = node->Next;
+		cache.Count--;
+		return node;
+	}
+
+	void FixedBlockPool::Free(void* block)
+	{
+		if (!block)
+			return;
+
+		FreeNode* node = static_cast<FreeNode*>(block);
+		if (m_CacheIndex == s_InvalidCacheIndex)
+		{
+			node->Next = nullptr;
+			PushBatch(node, node, 1);
+			return;
+		}
+
+		PoolThreadCacheTable::Cache& cache = t_PoolCaches.Caches[m_CacheIndex];
+		node->Next = cache.Head;
+		cache.Head = node;
+		cache.Count++;
+
+		// 只在另一个线程一直释放（生产者/消费者）时才会走到这里
+		if (cache.Count >= s_CacheBatchSize * 2)
+		{
+			FreeNode* head = cache.Head;
+			FreeNode* tail = head;
+			for (uint32_t i = 1; i < s_CacheBatchSize; i++)
+				tail = tail->Next;
+
+			cache.Head = tail->Next;
+			cache.Count -= s_CacheBatchSize;
+			tail->Next = nullptr;
+			PushBatch(head, tail, s_CacheBatchSize);
+		}
+	}
+
+	FixedBlockPool::FreeNode* FixedBlockPool::PopBatch(uint32_t maxCount, uint32_t& outCount)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (!m_GlobalFree)
+			AllocateChunk();
+
+		FreeNode* head = m_GlobalFree;
+		FreeNode* tail = head;
+		uint32_t count = 1;
+		while (count < maxCount && tail->Next)
+		{
+			tail = tail->Next;
+			count++;
+		}
+
+		m_GlobalFree = tail->Next;
+		m_GlobalFreeCount -= count;
+		tail->Next = nullptr;
+		outCount = count;
+		return head;
+	}
+
+	void FixedBlockPool::PushBatch(FreeNode* head, FreeNode* tail, uint32_t count)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		tail->Next = m_GlobalFree;
+		m_GlobalFree = head;
+		m_GlobalFreeCount += count;
+	}
+
+	void FixedBlockPool::AllocateChunk()
+	{
+		uint8_t* chunk = static_cast<uint8_t*>(::operator new(m_BlockSize * m_BlocksPerChunk, std::align_val_t(m_BlockAlignment)));
+		m_Chunks.push_back(chunk);
+
+		// 倒序串起来，这样分配顺序和地址顺序一致
+		for (uint32_t i = m_BlocksPerChunk; i > 0; i--)
+		{
+			FreeNode* node = reinterpret_cast<FreeNode*>(chunk + (size_t)(i - 1) * m_BlockSize);
+			node->Next = m_GlobalFree;
+			m_GlobalFree = node;
+		}
+		m_GlobalFreeCount += m_BlocksPerChunk;
+	}
+
+	FixedBlockPool::Statistics FixedBlockPool::GetStatistics() const
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		Statistics stats;
+		stats.ChunksAllocated = m_Chunks.size();
+		stats.BlocksAllocated = m_Chunks.size() * m_BlocksPerChunk;
+		stats.BlocksInGlobalFreeList = m_GlobalFreeCount;
+		return stats;
+	}
+
+	FixedBlockPool* FixedBlockPool::GetSizeClass(size_t size, size_t alignment)
+	{
+		if (size == 0 || size > s_MaxSizeClassBytes || alignment > alignof(std::max_align_t))
+			return nullptr;
+
+		// 分级池和注册表一样不析构，静态对象析构时归还的块仍然有效
+		static FixedBlockPool** s_SizeClasses = []()
+		{
+			FixedBlockPool** pools = new FixedBlockPool*[s_SizeClassCount];
+			for (size_t i = 0; i < s_SizeClassCount; i++)
+				pools[i] = new FixedBlockPool((i + 1) * s_SizeClassGranularity);
+			return pools;
+		}();
+
+		return s_SizeClasses[(size - 1) / s_SizeClassGranularity];
+	}
+
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Hazel {
+
+	// 固定大小的块池
+	// - 每个线程有自己的空闲链表缓存，Allocate/Free 命中缓存时不加锁
+	// - 缓存空了从全局空闲链表批量拿，缓存太多批量还回去（加锁，很少发生）
+	// - 块只在池析构时还给系统，稳态下不会再碰系统堆
+	class HAZEL_API FixedBlockPool
+	{
+	public:
+		// 线程缓存每次和全局链表交换的块数
+		static constexpr uint32_t s_CacheBatchSize = 32;
+		// 能拥有线程缓存的池数量上限，超过的池直接走全局链表
+		static constexpr uint32_t s_MaxCachedPools = 64;
+
+		// 按大小分级的共享池，PoolAllocator 默认使用
+		static constexpr size_t s_SizeClassGranularity = 16;
+		static constexpr size_t s_MaxSizeClassBytes = 512;
+	public:
+		FixedBlockPool(size_t blockSize, size_t blockAlignment = alignof(std::max_align_t), uint32_t blocksPerChunk = 64);
+		~FixedBlockPool();
+
+		FixedBlockPool(const FixedBlockPool&) = delete;
+		FixedBlockPool& operator=(const FixedBlockPool&) = delete;
+
+		void* Allocate();
+		void Free(void* block);
+
+		inline size_t GetBlockSize() const { return m_BlockSize; }
+		inline size_t GetBlockAlignment() const { return m_BlockAlignment; }
+
+		struct Statistics
+		{
+			size_t ChunksAllocated = 0;
+			size_t BlocksAllocated = 0;		// 所有块，包括各线程缓存里的
+			size_t BlocksInGlobalFreeList = 0;
+		};
+		Statistics GetStatistics() const;
+
+		// size 超过 s_MaxSizeClassBytes 或对齐超过 max_align_t 时返回 nullptr
+		static FixedBlockPool* GetSizeClass(size_t size, size_t alignment);
+	private:
+		struct FreeNode
+		{
+			FreeNode* Next;
+		};
+
+		// 从全局链表取最多 maxCount 个块，链表为空时先申请新的 chunk
+		FreeNode* PopBatch(uint32_t maxCount, uint32_t& outCount);
+		void PushBatch(FreeNode* head, FreeNode* tail, uint32_t count);
+		void AllocateChunk();
+
+		friend struct PoolThreadCacheTable;
+	private:
+		size_t m_BlockSize;
+		size_t m_BlockAlignment;
+		uint32_t m_BlocksPerChunk;
+		uint32_t m_CacheIndex;
+
+		mutable std::mutex m_Mutex;
+		FreeNode* m_GlobalFree = nullptr;
+		size_t m_GlobalFreeCount = 0;
+		std::vector<void*> m_Chunks;
+	};
+
+	// STL / allocate_shared 分配器适配
+	// 小对象（包括 allocate_shared 的控制块、容器节点）走大小分级池，其余回退到 operator new
+	//	Ref<D3D12CommandList> list = CreatePooledRef<D3D12CommandList>(handle, type);
+	//	std::unordered_map<K, V, Hash, Eq, PoolAllocator<std::pair<const K, V>>> map;
+	template<typename T>
+	class PoolAllocator
+	{
+	public:
+		using value_type = T;
+
+		PoolAllocator() noexcept = default;
+		template<typename U>
+		PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+		T* allocate(size_t count)
+		{
+			if (FixedBlockPool* pool = FixedBlockPool::GetSizeClass(sizeof(T) * count, alignof(T)))
+				return static_cast<T*>(pool->Allocate());
+			return static_cast<T*>(::operator new(sizeof(T) * count));
+		}
+
+		void deallocate(T* ptr, size_t count) noexcept
+		{
+			// 同样的 size/alignment 一定落在同一个分级池
+			if (FixedBlockPool* pool = FixedBlockPool::GetSizeClass(sizeof(T) * count, alignof(T)))
+				pool->Free(ptr);
+			else
+				::operator delete(ptr);
+		}
+
+		template<typename U>
+		bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+		template<typename U>
+		bool operator!=(const PoolAllocator<U>&) const noexcept { return false; }
+	};
+
+	// 和 CreateRef 一样，但对象和控制块来自块池
+	template<typename T, typename ... Args>
+	constexpr Ref<T> CreatePooledRef(Args&& ... args)
+	{
+		return std::allocate_shared<T>(PoolAllocator<T>(), std::forward<Args>(args)...);
+	}
+
+	// 单一类型的对象池，不经过 shared_ptr 的场景使用
+	template<typename T>
+	class ObjectPool
+	{
+	public:
+		ObjectPool(uint32_t objectsPerChunk = 64)
+			: m_Blocks(sizeof(T), alignof(T) > alignof(std::max_align_t) ? alignof(T) : alignof(std::max_align_t), objectsPerChunk)
+		{
+		}
+
+		template<typename ... Args>
+		T* New(Args&& ... args)
+		{
+			return new (m_Blocks.Allocate()) T(std::forward<Args>(args)...);
+		}
+
+		void Delete(T* object)
+		{
+			if (!object)
+				return;
+			object->~T();
+			m_Blocks.Free(object);
+		}
+
+		inline FixedBlockPool::Statistics GetStatistics() const { return m_Blocks.GetStatistics(); }
+	private:
+		FixedBlockPool m_Blocks;
+	};
+
+}
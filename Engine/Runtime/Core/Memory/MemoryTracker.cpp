@@ -0,0 +1,305 @@
+#include "hzpch.h"
+#include "MemoryTracker.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace Hazel {
+
+	namespace {
+
+		struct TagCounters
+		{
+			std::atomic<size_t> LiveBytes{ 0 };
+			std::atomic<size_t> PeakBytes{ 0 };
+			std::atomic<uint64_t> LiveAllocations{ 0 };
+			std::atomic<uint64_t> TotalAllocations{ 0 };
+			std::atomic<uint64_t> FrameAllocations{ 0 };
+			std::atomic<size_t> FrameBytes{ 0 };
+			std::atomic<uint64_t> LastFrameAllocations{ 0 };
+			std::atomic<size_t> LastFrameBytes{ 0 };
+		};
+
+		// 全部是常量初始化，静态构造之前的分配也能安全计数
+		TagCounters s_Counters[(size_t)MemoryTag::Count];
+		std::atomic<uint64_t> s_FrameIndex{ 0 };
+
+		std::atomic<bool> s_GuardEnabled{ false };
+		std::atomic<uint64_t> s_GuardViolations{ 0 };
+		std::atomic<bool> s_FirstViolationRecorded{ false };
+		std::atomic<uint8_t> s_FirstViolationTag{ 0 };
+		std::atomic<size_t> s_FirstViolationSize{ 0 };
+		std::atomic<uint64_t> s_FirstViolationFrame{ 0 };
+
+		thread_local MemoryTag s_CurrentTag = MemoryTag::Untagged;
+
+		const char* s_TagNames[(size_t)MemoryTag::Count] = {
+			"Untagged", "Scene", "Material", "Mesh", "RHI", "Editor", "ImGui"
+		};
+
+		void UpdatePeak(std::atomic<size_t>& peak, size_t value)
+		{
+			size_t current = peak.load(std::memory_order_relaxed);
+			while (value > current && !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+		}
+
+	}
+
+	MemoryTag MemoryTracker::GetCurrentTag()
+	{
+		return s_CurrentTag;
+	}
+
+	void MemoryTracker::SetCurrentTag(MemoryTag tag)
+	{
+		s_CurrentTag = tag;
+	}
+
+	const char* MemoryTracker::GetTagName(MemoryTag tag)
+	{
+		return (size_t)tag < (size_t)MemoryTag::Count ? s_TagNames[(size_t)tag] : "Unknown";
+	}
+
+	void MemoryTracker::BeginFrame()
+	{
+		for (TagCounters& counters : s_Counters)
+		{
+			counters.LastFrameAllocations.store(counters.FrameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+			counters.LastFrameBytes.store(counters.FrameBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+		s_FrameIndex.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	uint64_t MemoryTracker::GetFrameIndex()
+	{
+		return s_FrameIndex.load(std::memory_order_relaxed);
+	}
+
+	MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+	{
+		MemoryTagStats stats;
+		if ((size_t)tag >= (size_t)MemoryTag::Count)
+			return stats;
+
+		const TagCounters& counters = s_Counters[(size_t)tag];
+		stats.LiveBytes = counters.LiveBytes.load(std::memory_order_relaxed);
+		stats.PeakBytes = counters.PeakBytes.load(std::memory_order_relaxed);
+		stats.LiveAllocations = counters.LiveAllocations.load(std::memory_order_relaxed);
+		stats.TotalAllocations = counters.TotalAllocations.load(std::memory_order_relaxed);
+		stats.FrameAllocations = counters.LastFrameAllocations.load(std::memory_order_relaxed);
+		stats.FrameBytes = counters.LastFrameBytes.load(std::memory_order_relaxed);
+		return stats;
+	}
+
+	MemoryTagStats MemoryTracker::GetTotalStats()
+	{
+		MemoryTagStats total;
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			MemoryTagStats stats = GetStats((MemoryTag)i);
+			total.LiveBytes += stats.LiveBytes;
+			total.PeakBytes += stats.PeakBytes;
+			total.LiveAllocations += stats.LiveAllocations;
+			total.TotalAllocations += stats.TotalAllocations;
+			total.FrameAllocations += stats.FrameAllocations;
+			total.FrameBytes += stats.FrameBytes;
+		}
+		return total;
+	}
+
+	void MemoryTracker::SetSteadyStateGuard(bool enabled)
+	{
+		s_GuardEnabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	bool MemoryTracker::IsSteadyStateGuardEnabled()
+	{
+		return s_GuardEnabled.load(std::memory_order_relaxed);
+	}
+
+	uint64_t MemoryTracker::GetGuardViolationCount()
+	{
+		return s_GuardViolations.load(std::memory_order_relaxed);
+	}
+
+	MemoryGuardViolation MemoryTracker::GetFirstGuardViolation()
+	{
+		MemoryGuardViolation violation;
+		if (!s_FirstViolationRecorded.load(std::memory_order_acquire))
+			return violation;
+		violation.Tag = (MemoryTag)s_FirstViolationTag.load(std::memory_order_relaxed);
+		violation.Size = s_FirstViolationSize.load(std::memory_order_relaxed);
+		violation.FrameIndex = s_FirstViolationFrame.load(std::memory_order_relaxed);
+		return violation;
+	}
+
+	void MemoryTracker::ResetGuardViolations()
+	{
+		s_GuardViolations.store(0, std::memory_order_relaxed);
+		s_FirstViolationRecorded.store(false, std::memory_order_release);
+	}
+
+	void MemoryTracker::LogReport()
+	{
+		if (!IsEnabled())
+		{
+			HZ_CORE_INFO("Memory: tracking disabled in this build");
+			return;
+		}
+
+		HZ_CORE_INFO("Memory: {0:<10} {1:>12} {2:>12} {3:>12} {4:>12} {5:>10}", "tag", "live KB", "peak KB", "live allocs", "total allocs", "last frame");
+		for (size_t i = 0; i < (size_t)MemoryTag::Count; i++)
+		{
+			MemoryTagStats stats = GetStats((MemoryTag)i);
+			HZ_CORE_INFO("Memory: {0:<10} {1:>12.1f} {2:>12.1f} {3:>12} {4:>12} {5:>10}", GetTagName((MemoryTag)i),
+				stats.LiveBytes / 1024.0, stats.PeakBytes / 1024.0, stats.LiveAllocations, stats.TotalAllocations, stats.FrameAllocations);
+		}
+
+		uint64_t violations = GetGuardViolationCount();
+		if (violations > 0)
+		{
+			MemoryGuardViolation first = GetFirstGuardViolation();
+			HZ_CORE_ERROR("Memory: steady-state guard saw {0} tagged allocations, first: {1} bytes in {2} at frame {3}",
+				violations, first.Size, GetTagName(first.Tag), first.FrameIndex);
+		}
+	}
+
+	void MemoryTracker::OnAllocate(MemoryTag tag, size_t size)
+	{
+		TagCounters& counters = s_Counters[(size_t)tag];
+		size_t live = counters.LiveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+		UpdatePeak(counters.PeakBytes, live);
+		counters.LiveAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.TotalAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.FrameAllocations.fetch_add(1, std::memory_order_relaxed);
+		counters.FrameBytes.fetch_add(size, std::memory_order_relaxed);
+
+		if (tag != MemoryTag::Untagged && s_GuardEnabled.load(std::memory_order_relaxed))
+		{
+			s_GuardViolations.fetch_add(1, std::memory_order_relaxed);
+			bool expected = false;
+			if (!s_FirstViolationRecorded.load(std::memory_order_relaxed) &&
+				s_FirstViolationRecorded.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+			{
+				s_FirstViolationTag.store((uint8_t)tag, std::memory_order_relaxed);
+				s_FirstViolationSize.store(size, std::memory_order_relaxed);
+				s_FirstViolationFrame.store(s_FrameIndex.load(std::memory_order_relaxed), std::memory_order_relaxed);
+			}
+		}
+	}
+
+	void MemoryTracker::OnFree(MemoryTag tag, size_t size)
+	{
+		TagCounters& counters = s_Counters[(size_t)tag];
+		counters.LiveBytes.fetch_sub(size, std::memory_order_relaxed);
+		counters.LiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+}
+
+#if HZ_MEMORY_TRACKING
+
+// ---------------- global operator new / delete ----------------
+
+namespace {
+
+	// 放在返回给调用方的指针前面
+	struct AllocationHeader
+	{
+		size_t Size;
+		uint32_t Offset;		// 用户指针到 malloc 返回值的距离
+		Hazel::MemoryTag Tag;
+	};
+
+	constexpr size_t s_HeaderSize = 16;
+	static_assert(sizeof(AllocationHeader) <= s_HeaderSize, "allocation header must fit in 16 bytes");
+
+	void* TrackedAllocate(size_t size, size_t alignment) noexcept
+	{
+		// malloc 已经满足 max_align_t 对齐，头部之后仍然对齐
+		const bool overAligned = alignment > alignof(std::max_align_t);
+		const size_t padding = overAligned ? alignment - 1 : 0;
+		if (size > SIZE_MAX - s_HeaderSize - padding)
+			return nullptr;
+
+		void* raw = std::malloc(size + s_HeaderSize + padding);
+		if (!raw)
+			return nullptr;
+
+		uintptr_t user = (uintptr_t)raw + s_HeaderSize;
+		if (overAligned)
+			user = (user + alignment - 1) & ~(uintptr_t)(alignment - 1);
+
+		Hazel::MemoryTag tag = Hazel::MemoryTracker::GetCurrentTag();
+		AllocationHeader* header = reinterpret_cast<AllocationHeader*>(user - s_HeaderSize);
+		header->Size = size;
+		header->Offset = (uint32_t)(user - (uintptr_t)raw);
+		header->Tag = tag;
+
+		Hazel::MemoryTracker::OnAllocate(tag, size);
+		return reinterpret_cast<void*>(user);
+	}
+
+	void* TrackedAllocateOrThrow(size_t size, size_t alignment)
+	{
+		for (;;)
+		{
+			if (void* p = TrackedAllocate(size, alignment))
+				return p;
+			std::new_handler handler = std::get_new_handler();
+			if (!handler)
+				throw std::bad_alloc();
+			handler();
+		}
+	}
+
+	void* TrackedAllocateNoThrow(size_t size, size_t alignment) noexcept
+	{
+		try
+		{
+			return TrackedAllocateOrThrow(size, alignment);
+		}
+		catch (...)
+		{
+			return nullptr;
+		}
+	}
+
+	void TrackedFree(void* p) noexcept
+	{
+		if (!p)
+			return;
+
+		uintptr_t user = reinterpret_cast<uintptr_t>(p);
+		const AllocationHeader* header = reinterpret_cast<const AllocationHeader*>(user - s_HeaderSize);
+		Hazel::MemoryTracker::OnFree(header->Tag, header->Size);
+		std::free(reinterpret_cast<void*>(user - header->Offset));
+	}
+
+}
+
+void* operator new(size_t size) { return TrackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size) { return TrackedAllocateOrThrow(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return TrackedAllocateNoThrow(size, alignof(std::max_align_t)); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return TrackedAllocateNoThrow(size, alignof(std::max_align_t)); }
+void* operator new(size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return TrackedAllocateOrThrow(size, (size_t)alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocateNoThrow(size, (size_t)alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return TrackedAllocateNoThrow(size, (size_t)alignment); }
+
+void operator delete(void* p) noexcept { TrackedFree(p); }
+void operator delete[](void* p) noexcept { TrackedFree(p); }
+void operator delete(void* p, size_t) noexcept { TrackedFree(p); }
+void operator delete[](void* p, size_t) noexcept { TrackedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { TrackedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { TrackedFree(p); }
+void operator delete(void* p, std::align_val_t) noexcept { TrackedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { TrackedFree(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { TrackedFree(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { TrackedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { TrackedFree(p); }
+
+#endif
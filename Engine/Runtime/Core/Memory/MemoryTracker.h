@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// 全局 operator new/delete 替换，默认只在 Debug 开启：每次分配多一个头和几次全局原子操作，
+// Release 下会拖慢所有基准；Release 需要时用 premake 的 --memory-tracking 打开
+// 关闭时标签宏展开为空，统计接口返回 0，稳态分配检查（SteadyStateGuard）也不生效
+#ifndef HZ_MEMORY_TRACKING
+	#if defined(HZ_DEBUG)
+		#define HZ_MEMORY_TRACKING 1
+	#else
+		#define HZ_MEMORY_TRACKING 0
+	#endif
+#endif
+
+namespace Hazel {
+
+	// 分配归属的子系统，由当前线程的 ScopedMemoryTag 决定
+	enum class MemoryTag : uint8_t
+	{
+		Untagged = 0,
+		Scene,
+		Material,
+		Mesh,
+		RHI,
+		Editor,
+		ImGui,
+		Count
+	};
+
+	struct MemoryTagStats
+	{
+		size_t LiveBytes = 0;
+		size_t PeakBytes = 0;
+		uint64_t LiveAllocations = 0;
+		uint64_t TotalAllocations = 0;
+		// 上一个完整帧的分配次数 / 字节数（见 MemoryTracker::BeginFrame）
+		uint64_t FrameAllocations = 0;
+		size_t FrameBytes = 0;
+	};
+
+	// 稳态守卫记录的第一次违规
+	struct MemoryGuardViolation
+	{
+		MemoryTag Tag = MemoryTag::Untagged;
+		size_t Size = 0;
+		uint64_t FrameIndex = 0;
+	};
+
+	// 全局分配统计
+	// - 每次分配多带一个头部记录大小和标签，释放时计回原来的标签
+	// - 统计只用原子计数，operator new 里不会再分配内存
+	// - 稳态守卫开启后，任何带标签的分配都记一次违规（Untagged 不算，第三方库/日志线程不受约束）
+	class HAZEL_API MemoryTracker
+	{
+	public:
+		static bool IsEnabled() { return HZ_MEMORY_TRACKING != 0; }
+
+		static MemoryTag GetCurrentTag();
+		static void SetCurrentTag(MemoryTag tag);
+		static const char* GetTagName(MemoryTag tag);
+
+		// 主线程每帧开始调用，把当前帧的计数滚动到 FrameAllocations / FrameBytes
+		static void BeginFrame();
+		static uint64_t GetFrameIndex();
+
+		static MemoryTagStats GetStats(MemoryTag tag);
+		// 所有标签（含 Untagged）的合计，PeakBytes 是各标签峰值之和
+		static MemoryTagStats GetTotalStats();
+
+		// 打开后，带标签的分配都记为违规；通常在预热帧之后打开
+		static void SetSteadyStateGuard(bool enabled);
+		static bool IsSteadyStateGuardEnabled();
+		static uint64_t GetGuardViolationCount();
+		static MemoryGuardViolation GetFirstGuardViolation();
+		static void ResetGuardViolations();
+
+		// 每个标签一行写到日志（headless 运行结束时用）
+		static void LogReport();
+
+		// 供 operator new/delete 调用
+		static void OnAllocate(MemoryTag tag, size_t size);
+		static void OnFree(MemoryTag tag, size_t size);
+	};
+
+	// 作用域内当前线程的分配都记到 tag 上，嵌套时内层优先，离开时恢复
+	class ScopedMemoryTag
+	{
+	public:
+		explicit ScopedMemoryTag(MemoryTag tag)
+			: m_Previous(MemoryTracker::GetCurrentTag())
+		{
+			MemoryTracker::SetCurrentTag(tag);
+		}
+
+		~ScopedMemoryTag()
+		{
+			MemoryTracker::SetCurrentTag(m_Previous);
+		}
+
+		ScopedMemoryTag(const ScopedMemoryTag&) = delete;
+		ScopedMemoryTag& operator=(const ScopedMemoryTag&) = delete;
+	private:
+		MemoryTag m_Previous;
+	};
+
+}
+
+#if HZ_MEMORY_TRACKING
+	#define HZ_MEMORY_TAG_CONCAT_IMPL(a, b) a##b
+	#define HZ_MEMORY_TAG_CONCAT(a, b) HZ_MEMORY_TAG_CONCAT_IMPL(a, b)
+	#define HZ_MEMORY_TAG(tag) ::Hazel::ScopedMemoryTag HZ_MEMORY_TAG_CONCAT(hzMemoryTag, __LINE__)(::Hazel::MemoryTag::tag)
+#else
+	#define HZ_MEMORY_TAG(tag)
+#endif
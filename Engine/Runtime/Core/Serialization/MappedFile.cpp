@@ -0,0 +1,94 @@
+#include "hzpch.h"
+#include "MappedFile.h"
+
+#if !defined(HZ_PLATFORM_WINDOWS)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace Hazel {
+
+	bool MappedFile::Open(const std::string& filepath)
+	{
+		Close();
+
+#if defined(HZ_PLATFORM_WINDOWS)
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			CloseHandle(file);
+			return false;
+		}
+
+		void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!data)
+		{
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return false;
+		}
+
+		m_FileHandle = file;
+		m_MappingHandle = mapping;
+		m_Data = static_cast<const uint8_t*>(data);
+		m_Size = (size_t)size.QuadPart;
+#else
+		int fd = open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+			return false;
+
+		struct stat info;
+		if (fstat(fd, &info) != 0 || info.st_size == 0)
+		{
+			close(fd);
+			return false;
+		}
+
+		void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		// 映射建立后文件描述符就不需要了
+		close(fd);
+		if (data == MAP_FAILED)
+			return false;
+
+		// 加载时整个文件都会读一遍，让内核提前预读
+		madvise(data, (size_t)info.st_size, MADV_WILLNEED);
+
+		m_Data = static_cast<const uint8_t*>(data);
+		m_Size = (size_t)info.st_size;
+#endif
+		return true;
+	}
+
+	void MappedFile::Close()
+	{
+		if (!m_Data)
+			return;
+
+#if defined(HZ_PLATFORM_WINDOWS)
+		UnmapViewOfFile(m_Data);
+		CloseHandle((HANDLE)m_MappingHandle);
+		CloseHandle((HANDLE)m_FileHandle);
+		m_MappingHandle = nullptr;
+		m_FileHandle = nullptr;
+#else
+		munmap(const_cast<uint8_t*>(m_Data), m_Size);
+#endif
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+
+} // namespace Hazel
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <cstdint>
+#include <string>
+
+namespace Hazel {
+
+	// 只读内存映射文件，页面在第一次访问时才从磁盘读入
+	// 映射关闭（Close / 析构）后 GetData 返回的指针失效
+	class HAZEL_API MappedFile
+	{
+	public:
+		MappedFile() = default;
+		~MappedFile() { Close(); }
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		// 文件不存在、为空或映射失败时返回 false
+		bool Open(const std::string& filepath);
+		void Close();
+
+		inline bool IsOpen() const { return m_Data != nullptr; }
+		inline const uint8_t* GetData() const { return m_Data; }
+		inline size_t GetSize() const { return m_Size; }
+	private:
+		const uint8_t* m_Data = nullptr;
+		size_t m_Size = 0;
+#if defined(HZ_PLATFORM_WINDOWS)
+		void* m_FileHandle = nullptr;
+		void* m_MappingHandle = nullptr;
+#endif
+	};
+
+} // namespace Hazel
@@ -0,0 +1,221 @@
+#include "hzpch.h"
+#include "InitGraph.h"
+
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Core/Time/FrameTimer.h"
+
+#include <thread>
+
+namespace Hazel {
+
+	InitGraph& InitGraph::Add(const std::string& name, std::function<void()> func,
+		std::initializer_list<const char*> dependencies, InitThread thread)
+	{
+		Scope<Task> task(new Task());
+		task->Name = name;
+		task->Func = std::move(func);
+		task->Thread = thread;
+		for (const char* dependency : dependencies)
+			task->DependencyNames.emplace_back(dependency);
+		m_Tasks.push_back(std::move(task));
+		return *this;
+	}
+
+	bool InitGraph::Resolve()
+	{
+		std::unordered_map<std::string, uint32_t> indices;
+		for (uint32_t i = 0; i < (uint32_t)m_Tasks.size(); i++)
+		{
+			if (!indices.emplace(m_Tasks[i]->Name, i).second)
+			{
+				HZ_CORE_ERROR("InitGraph[{0}]: duplicate task '{1}'", m_Name, m_Tasks[i]->Name);
+				return false;
+			}
+		}
+
+		for (auto& task : m_Tasks)
+		{
+			task->Dependencies.clear();
+			task->Dependents.clear();
+		}
+
+		for (uint32_t i = 0; i < (uint32_t)m_Tasks.size(); i++)
+		{
+			Task& task = *m_Tasks[i];
+			for (const std::string& dependency : task.DependencyNames)
+			{
+				auto it = indices.find(dependency);
+				if (it == indices.end())
+				{
+					HZ_CORE_ERROR("InitGraph[{0}]: '{1}' depends on unknown task '{2}'", m_Name, task.Name, dependency);
+					return false;
+				}
+				task.Dependencies.push_back(it->second);
+				m_Tasks[it->second]->Dependents.push_back(i);
+			}
+		}
+
+		// Kahn：能全部拓扑排序说明没有环
+		std::vector<uint32_t> inDegree(m_Tasks.size());
+		std::vector<uint32_t> ready;
+		for (uint32_t i = 0; i < (uint32_t)m_Tasks.size(); i++)
+		{
+			inDegree[i] = (uint32_t)m_Tasks[i]->Dependencies.size();
+			if (inDegree[i] == 0)
+				ready.push_back(i);
+		}
+		uint32_t visited = 0;
+		while (!ready.empty())
+		{
+			uint32_t index = ready.back();
+			ready.pop_back();
+			visited++;
+			for (uint32_t dependent : m_Tasks[index]->Dependents)
+			{
+				if (--inDegree[dependent] == 0)
+					ready.push_back(dependent);
+			}
+		}
+		if (visited != m_Tasks.size())
+		{
+			HZ_CORE_ERROR("InitGraph[{0}]: dependency cycle", m_Name);
+			return false;
+		}
+		return true;
+	}
+
+	bool InitGraph::Run()
+	{
+		HZ_PROFILE_FUNCTION();
+		if (!Resolve())
+			return false;
+
+		m_StartNs = Clock::NowNanoseconds();
+		m_Completed.store(0, std::memory_order_relaxed);
+		for (auto& task : m_Tasks)
+		{
+			task->Remaining.store((int32_t)task->Dependencies.size(), std::memory_order_relaxed);
+			task->Failed.store(false, std::memory_order_relaxed);
+			task->Skipped = false;
+		}
+
+		for (uint32_t i = 0; i < (uint32_t)m_Tasks.size(); i++)
+		{
+			if (m_Tasks[i]->Dependencies.empty())
+				Schedule(i);
+		}
+
+		// 主线程：先执行 Main 任务，没有就帮 JobSystem 干活
+		const uint32_t taskCount = (uint32_t)m_Tasks.size();
+		while (m_Completed.load(std::memory_order_acquire) < taskCount)
+		{
+			uint32_t mainTask = UINT32_MAX;
+			{
+				std::lock_guard<std::mutex> lock(m_MainQueueMutex);
+				if (!m_MainQueue.empty())
+				{
+					mainTask = m_MainQueue.back();
+					m_MainQueue.pop_back();
+				}
+			}
+
+			if (mainTask != UINT32_MAX)
+				Execute(mainTask);
+			else if (!JobSystem::IsInitialized() || !JobSystem::TryExecuteOne())
+				std::this_thread::yield();
+		}
+
+		m_WallMs = (double)(Clock::NowNanoseconds() - m_StartNs) / 1e6;
+
+		bool succeeded = true;
+		for (const auto& task : m_Tasks)
+			succeeded &= !task->Failed.load(std::memory_order_relaxed);
+		return succeeded;
+	}
+
+	void InitGraph::Schedule(uint32_t index)
+	{
+		if (m_Tasks[index]->Thread == InitThread::Main || !JobSystem::IsInitialized())
+		{
+			std::lock_guard<std::mutex> lock(m_MainQueueMutex);
+			m_MainQueue.push_back(index);
+			return;
+		}
+		JobSystem::Run([this, index]() { Execute(index); });
+	}
+
+	void InitGraph::Execute(uint32_t index)
+	{
+		Task& task = *m_Tasks[index];
+
+		double dependencyPathMs = 0.0;
+		bool dependencyFailed = false;
+		for (uint32_t dependency : task.Dependencies)
+		{
+			dependencyFailed |= m_Tasks[dependency]->Failed.load(std::memory_order_acquire);
+			dependencyPathMs = std::max(dependencyPathMs, m_Tasks[dependency]->CriticalPathMs);
+		}
+
+		uint64_t startNs = Clock::NowNanoseconds();
+		task.StartMs = (double)(startNs - m_StartNs) / 1e6;
+		if (dependencyFailed)
+		{
+			task.Skipped = true;
+			task.Failed.store(true, std::memory_order_release);
+		}
+		else
+		{
+			// 任务名不是字面量，不能直接交给 Instrumentor，时间线见 LogReport
+			HZ_PROFILE_SCOPE("InitGraph::Execute");
+			try
+			{
+				task.Func();
+			}
+			catch (const std::exception& e)
+			{
+				HZ_CORE_ERROR("InitGraph[{0}]: task '{1}' failed: {2}", m_Name, task.Name, e.what());
+				task.Failed.store(true, std::memory_order_release);
+			}
+			catch (...)
+			{
+				// 比如 D3D12 的 DxException 不是 std::exception，不能让它逃出工作线程
+				HZ_CORE_ERROR("InitGraph[{0}]: task '{1}' failed: unknown exception", m_Name, task.Name);
+				task.Failed.store(true, std::memory_order_release);
+			}
+		}
+		task.DurationMs = (double)(Clock::NowNanoseconds() - startNs) / 1e6;
+		task.CriticalPathMs = dependencyPathMs + task.DurationMs;
+
+		for (uint32_t dependent : task.Dependents)
+		{
+			if (m_Tasks[dependent]->Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				Schedule(dependent);
+		}
+		m_Completed.fetch_add(1, std::memory_order_release);
+	}
+
+	double InitGraph::GetSerialMs() const
+	{
+		double total = 0.0;
+		for (const auto& task : m_Tasks)
+			total += task->DurationMs;
+		return total;
+	}
+
+	void InitGraph::LogReport() const
+	{
+		double criticalPathMs = 0.0;
+		for (const auto& task : m_Tasks)
+			criticalPathMs = std::max(criticalPathMs, task->CriticalPathMs);
+
+		HZ_CORE_INFO("InitGraph[{0}]: {1} tasks, wall {2:.1f} ms, serial {3:.1f} ms, critical path {4:.1f} ms",
+			m_Name, m_Tasks.size(), m_WallMs, GetSerialMs(), criticalPathMs);
+		for (const auto& task : m_Tasks)
+		{
+			const char* status = task->Skipped ? " (skipped)" : (task->Failed.load(std::memory_order_relaxed) ? " (failed)" : "");
+			HZ_CORE_INFO("  {0:<24} start {1:>8.1f} ms  took {2:>8.1f} ms  {3}{4}", task->Name, task->StartMs, task->DurationMs,
+				task->Thread == InitThread::Main ? "main" : "any", status);
+		}
+	}
+
+} // namespace Hazel
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Hazel {
+
+	// 任务在哪个线程执行：Any 交给 JobSystem，Main 只在调用 Run 的线程上执行
+	// （窗口、交换链、需要录制命令列表的 GPU 上传等必须用 Main）
+	enum class InitThread : uint8_t
+	{
+		Any = 0,
+		Main
+	};
+
+	// 启动初始化的依赖图
+	// - 子系统 / 启动资源按名字声明依赖，所有依赖完成后才会开始
+	// - 互不依赖的 Any 任务并行执行，主线程等待期间执行 Main 任务并帮忙执行 JobSystem 任务
+	// - 任务抛出异常视为失败，依赖它的任务全部跳过，Run 返回 false
+	// - 记录每个任务的开始时间和耗时，LogReport 打印时间线和关键路径
+	//
+	//	InitGraph graph("SceneView");
+	//	graph.Add("Shader", [&]() { shader = ...; });
+	//	graph.Add("Mesh", [&]() { mesh->ImportMesh(path); });
+	//	graph.Add("MeshUpload", [&]() { mesh->UploadMesh(); }, { "Mesh" }, InitThread::Main);
+	//	graph.Add("Pipeline", [&]() { ... }, { "Shader" }, InitThread::Main);
+	//	graph.Run();
+	class HAZEL_API InitGraph
+	{
+	public:
+		InitGraph(const std::string& name) : m_Name(name) {}
+		InitGraph(const InitGraph&) = delete;
+		InitGraph& operator=(const InitGraph&) = delete;
+
+		InitGraph& Add(const std::string& name, std::function<void()> func,
+			std::initializer_list<const char*> dependencies = {}, InitThread thread = InitThread::Any);
+
+		// 阻塞到所有任务完成或被跳过；依赖名不存在或存在环时不执行任何任务
+		bool Run();
+
+		// 图从开始到结束的墙钟时间 / 所有任务耗时之和（串行执行时的耗时）
+		inline double GetWallMs() const { return m_WallMs; }
+		double GetSerialMs() const;
+
+		void LogReport() const;
+	private:
+		struct Task
+		{
+			std::string Name;
+			std::function<void()> Func;
+			std::vector<std::string> DependencyNames;
+			std::vector<uint32_t> Dependencies;
+			std::vector<uint32_t> Dependents;
+			InitThread Thread = InitThread::Any;
+
+			std::atomic<int32_t> Remaining{ 0 };
+			std::atomic<bool> Failed{ false };
+			bool Skipped = false;
+			double StartMs = 0.0;
+			double DurationMs = 0.0;
+			// 从图开始到此任务完成的最长依赖链耗时
+			double CriticalPathMs = 0.0;
+		};
+
+		bool Resolve();
+		void Schedule(uint32_t index);
+		void Execute(uint32_t index);
+	private:
+		std::string m_Name;
+		std::vector<Scope<Task>> m_Tasks;
+
+		uint64_t m_StartNs = 0;
+		double m_WallMs = 0.0;
+		std::atomic<uint32_t> m_Completed{ 0 };
+
+		std::mutex m_MainQueueMutex;
+		std::vector<uint32_t> m_MainQueue;
+	};
+
+} // namespace Hazel
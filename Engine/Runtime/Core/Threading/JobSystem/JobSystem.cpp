@@ -0,0 +1,335 @@
+#include "hzpch.h"
+#include "JobSystem.h"
+#include "WorkStealingQueue.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#if defined(HZ_PLATFORM_LINUX)
+	#include <pthread.h>
+	#include <sched.h>
+#endif
+
+namespace Hazel {
+
+	namespace {
+
+		// 每个线程的任务环形池大小，同时也是本地队列容量
+		constexpr uint32_t s_MaxJobsPerThread = 4096;
+		// 找不到任务时先自旋多少轮再睡眠
+		constexpr uint32_t s_SpinCountBeforeSleep = 64;
+
+		struct ThreadContext
+		{
+			WorkStealingQueue<Job*, s_MaxJobsPerThread> Queue;
+			std::unique_ptr<Job[]> JobRing;
+			uint32_t NextJob = 0;
+			uint32_t RandomState = 0;
+
+			ThreadContext(uint32_t seed)
+				: JobRing(new Job[s_MaxJobsPerThread]), RandomState(seed * 2654435761u + 1u)
+			{
+			}
+		};
+
+		struct JobSystemData
+		{
+			// [0] 主线程，[1..N] 工作线程
+			std::vector<std::unique_ptr<ThreadContext>> Contexts;
+			std::vector<std::thread> Workers;
+
+			std::mutex WakeMutex;
+			std::condition_variable WakeCondition;
+			std::atomic<int32_t> PendingJobs{ 0 };
+			std::atomic<int32_t> SleepingWorkers{ 0 };
+			std::atomic<bool> Running{ false };
+
+			// 非任务系统线程提交的任务
+			std::mutex ForeignMutex;
+			std::deque<Job*> ForeignQueue;
+		};
+
+		JobSystemData* s_Data = nullptr;
+		thread_local int32_t s_ThreadIndex = -1;
+
+		uint32_t NextRandom(uint32_t& state)
+		{
+			// xorshift32
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return state;
+		}
+
+		void PinThreadToCore(std::thread& thread, uint32_t core)
+		{
+#if defined(HZ_PLATFORM_WINDOWS)
+			SetThreadAffinityMask((HANDLE)thread.native_handle(), (DWORD_PTR)1 << core);
+#elif defined(HZ_PLATFORM_LINUX)
+			cpu_set_t cpuSet;
+			CPU_ZERO(&cpuSet);
+			CPU_SET(core, &cpuSet);
+			pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuSet);
+#else
+			(void)thread; (void)core;
+#endif
+		}
+
+		void SetThreadName(std::thread& thread, uint32_t index)
+		{
+#if defined(HZ_PLATFORM_WINDOWS)
+			std::wstring name = L"JobWorker " + std::to_wstring(index);
+			SetThreadDescription((HANDLE)thread.native_handle(), name.c_str());
+#elif defined(HZ_PLATFORM_LINUX)
+			std::string name = "JobWorker " + std::to_string(index);
+			pthread_setname_np(thread.native_handle(), name.c_str());
+#else
+			(void)thread; (void)index;
+#endif
+		}
+
+		void ExecuteJob(Job* job)
+		{
+			job->Invoke(*job);
+			job->Destroy(*job);
+
+			JobCounter* counter = job->Counter;
+			if (job->HeapAllocated)
+				delete job;
+			else
+				job->InFlight.store(false, std::memory_order_release);
+
+			// 最后再减计数，等待方醒来时任务槽已经可以复用
+			if (counter)
+				counter->Decrement();
+		}
+
+		Job* FetchJob()
+		{
+			JobSystemData& data = *s_Data;
+			Job* job = nullptr;
+
+			ThreadContext* self = s_ThreadIndex >= 0 ? data.Contexts[s_ThreadIndex].get() : nullptr;
+			if (self && self->Queue.Pop(job))
+				return job;
+
+			{
+				std::lock_guard<std::mutex> lock(data.ForeignMutex);
+				if (!data.ForeignQueue.empty())
+				{
+					job = data.ForeignQueue.front();
+					data.ForeignQueue.pop_front();
+					return job;
+				}
+			}
+
+			const uint32_t contextCount = (uint32_t)data.Contexts.size();
+			static thread_local uint32_t s_ForeignRandomState = 0x9e3779b9u;
+			uint32_t start = NextRandom(self ? self->RandomState : s_ForeignRandomState) % contextCount;
+			for (uint32_t i = 0; i < contextCount; i++)
+			{
+				uint32_t victim = (start + i) % contextCount;
+				if ((int32_t)victim == s_ThreadIndex)
+					continue;
+				if (data.Contexts[victim]->Queue.Steal(job))
+					return job;
+			}
+			return nullptr;
+		}
+
+		void WorkerLoop(uint32_t threadIndex)
+		{
+			s_ThreadIndex = (int32_t)threadIndex;
+			HZ_PROFILE_THREAD("JobWorker " + std::to_string(threadIndex));
+			JobSystemData& data = *s_Data;
+			uint32_t idleSpins = 0;
+
+			while (true)
+			{
+				if (JobSystem::TryExecuteOne())
+				{
+					idleSpins = 0;
+					continue;
+				}
+
+				if (!data.Running.load(std::memory_order_acquire))
+					break;
+
+				if (++idleSpins < s_SpinCountBeforeSleep)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(data.WakeMutex);
+				data.SleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+				data.WakeCondition.wait(lock, [&data]() {
+					return data.PendingJobs.load(std::memory_order_seq_cst) > 0 || !data.Running.load(std::memory_order_acquire);
+				});
+				data.SleepingWorkers.fetch_sub(1, std::memory_order_relaxed);
+				idleSpins = 0;
+			}
+		}
+
+	}
+
+	void JobSystem::Initialize(const JobSystemConfig& config)
+	{
+		HZ_CORE_ASSERT(!s_Data, "JobSystem already initialized");
+
+		uint32_t hardwareThreads = std::thread::hardware_concurrency();
+		uint32_t workerCount = config.WorkerCount;
+		if (workerCount == 0)
+			workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+
+		s_Data = new JobSystemData();
+		s_Data->Running.store(true, std::memory_order_release);
+
+		for (uint32_t i = 0; i <= workerCount; i++)
+			s_Data->Contexts.push_back(std::make_unique<ThreadContext>(i + 1));
+
+		s_ThreadIndex = 0;
+		for (uint32_t i = 1; i <= workerCount; i++)
+		{
+			s_Data->Workers.emplace_back(WorkerLoop, i);
+			SetThreadName(s_Data->Workers.back(), i);
+			if (config.PinWorkerThreads && hardwareThreads > 0)
+				PinThreadToCore(s_Data->Workers.back(), i % hardwareThreads);
+		}
+
+		HZ_CORE_INFO("[JobSystem] Initialized with {0} worker threads", workerCount);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		if (!s_Data)
+			return;
+
+		// 把剩余任务执行完再退出
+		while (TryExecuteOne()) {}
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->WakeMutex);
+			s_Data->Running.store(false, std::memory_order_release);
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (std::thread& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+		s_ThreadIndex = -1;
+	}
+
+	bool JobSystem::IsInitialized()
+	{
+		return s_Data != nullptr;
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return s_Data ? (uint32_t)s_Data->Workers.size() : 0;
+	}
+
+	int32_t JobSystem::GetThreadIndex()
+	{
+		return s_ThreadIndex;
+	}
+
+	Job* JobSystem::AllocateJob()
+	{
+		if (s_Data && s_ThreadIndex >= 0)
+		{
+			ThreadContext& context = *s_Data->Contexts[s_ThreadIndex];
+			Job* job = &context.JobRing[context.NextJob++ & (s_MaxJobsPerThread - 1)];
+
+			// 环形池绕回来时这个槽的任务还没执行完，退化成堆分配
+			bool expected = false;
+			if (job->InFlight.compare_exchange_strong(expected, true, std::memory_order_acquire))
+			{
+				job->HeapAllocated = false;
+				return job;
+			}
+		}
+
+		Job* job = new Job();
+		job->HeapAllocated = true;
+		job->InFlight.store(true, std::memory_order_relaxed);
+		return job;
+	}
+
+	void JobSystem::Submit(Job* job)
+	{
+		if (!s_Data)
+		{
+			// 任务系统没初始化（工具/测试环境），直接执行
+			ExecuteJob(job);
+			return;
+		}
+
+		JobSystemData& data = *s_Data;
+		bool queued = false;
+		if (s_ThreadIndex >= 0)
+		{
+			queued = data.Contexts[s_ThreadIndex]->Queue.Push(job);
+		}
+		else
+		{
+			std::lock_guard<std::mutex> lock(data.ForeignMutex);
+			data.ForeignQueue.push_back(job);
+			queued = true;
+		}
+
+		if (!queued)
+		{
+			// 本地队列满了，直接执行
+			ExecuteJob(job);
+			return;
+		}
+
+		data.PendingJobs.fetch_add(1, std::memory_order_seq_cst);
+		if (data.SleepingWorkers.load(std::memory_order_seq_cst) > 0)
+		{
+			// 加锁保证不会和正在进入睡眠的线程错过通知
+			{ std::lock_guard<std::mutex> lock(data.WakeMutex); }
+			data.WakeCondition.notify_one();
+		}
+	}
+
+	bool JobSystem::TryExecuteOne()
+	{
+		if (!s_Data)
+			return false;
+
+		Job* job = FetchJob();
+		if (!job)
+			return false;
+
+		s_Data->PendingJobs.fetch_sub(1, std::memory_order_relaxed);
+		ExecuteJob(job);
+		return true;
+	}
+
+	void JobSystem::Wait(const JobCounter& counter)
+	{
+		while (!counter.IsDone())
+		{
+			if (!TryExecuteOne())
+				std::this_thread::yield();
+		}
+	}
+
+	uint32_t JobSystem::ComputeBatchSize(uint32_t count, uint32_t minBatchSize)
+	{
+		// 每个线程大约分到4块，方便负载均衡又不至于太碎
+		uint32_t threadCount = GetWorkerCount() + 1;
+		uint32_t targetBatches = threadCount * 4;
+		uint32_t batchSize = (count + targetBatches - 1) / targetBatches;
+		if (minBatchSize == 0)
+			minBatchSize = 1;
+		return batchSize > minBatchSize ? batchSize : minBatchSize;
+	}
+
+} // namespace Hazel
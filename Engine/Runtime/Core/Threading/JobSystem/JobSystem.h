@@ -0,0 +1,137 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Hazel {
+
+	// 任务完成计数器：提交时+1，任务执行完-1，归零表示这一组任务全部完成
+	// 依赖关系通过计数器表达：后续任务在开始前 JobSystem::Wait(前置计数器)
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		inline void Add(int32_t count = 1) { m_Value.fetch_add(count, std::memory_order_relaxed); }
+		inline void Decrement() { m_Value.fetch_sub(1, std::memory_order_acq_rel); }
+		inline bool IsDone() const { return m_Value.load(std::memory_order_acquire) == 0; }
+		inline int32_t Get() const { return m_Value.load(std::memory_order_acquire); }
+	private:
+		std::atomic<int32_t> m_Value{ 0 };
+	};
+
+	// 一个任务占两条cache line，可调用对象直接放在Payload里，放不下才走堆
+	struct alignas(64) Job
+	{
+		static constexpr size_t s_PayloadSize = 96;
+
+		void (*Invoke)(Job& job) = nullptr;
+		void (*Destroy)(Job& job) = nullptr;
+		JobCounter* Counter = nullptr;
+		bool HeapAllocated = false;
+		std::atomic<bool> InFlight{ false };
+
+		alignas(16) unsigned char Payload[s_PayloadSize];
+	};
+
+	struct JobSystemConfig
+	{
+		// 0 表示 硬件线程数 - 1（主线程也参与执行任务）
+		uint32_t WorkerCount = 0;
+		// 把工作线程绑定到固定核心：worker i -> core i + 1，主线程留在 core 0
+		bool PinWorkerThreads = false;
+	};
+
+	// 工作窃取任务系统
+	// - 每个工作线程（和主线程）一个 Chase-Lev 双端队列，空闲时随机窃取其他线程的任务
+	// - 非任务系统线程提交的任务进入一个加锁的共享队列
+	// - Wait 在等待计数器时会帮忙执行其他任务，不会阻塞线程
+	//
+	//	JobCounter counter;
+	//	JobSystem::Run([]() { ... }, &counter);
+	//	JobSystem::ParallelFor(count, 64, [&](uint32_t begin, uint32_t end) { ... });
+	//	JobSystem::Wait(counter);
+	class HAZEL_API JobSystem
+	{
+	public:
+		static void Initialize(const JobSystemConfig& config = JobSystemConfig());
+		static void Shutdown();
+		static bool IsInitialized();
+
+		// 工作线程数，不包含主线程
+		static uint32_t GetWorkerCount();
+		// 主线程为0，工作线程为 1..N，非任务系统线程返回 -1
+		static int32_t GetThreadIndex();
+
+		template<typename F>
+		static void Run(F&& func, JobCounter* counter = nullptr)
+		{
+			using Callable = std::decay_t<F>;
+
+			if (counter)
+				counter->Add(1);
+
+			Job* job = AllocateJob();
+			job->Counter = counter;
+
+			if constexpr (sizeof(Callable) <= Job::s_PayloadSize && alignof(Callable) <= 16)
+			{
+				new (job->Payload) Callable(std::forward<F>(func));
+				job->Invoke = [](Job& j) { (*std::launder(reinterpret_cast<Callable*>(j.Payload)))(); };
+				job->Destroy = [](Job& j) { std::launder(reinterpret_cast<Callable*>(j.Payload))->~Callable(); };
+			}
+			else
+			{
+				Callable* heapCallable = new Callable(std::forward<F>(func));
+				new (job->Payload) Callable*(heapCallable);
+				job->Invoke = [](Job& j) { (**reinterpret_cast<Callable**>(j.Payload))(); };
+				job->Destroy = [](Job& j) { delete *reinterpret_cast<Callable**>(j.Payload); };
+			}
+
+			Submit(job);
+		}
+
+		// 等待计数器归零，期间执行队列中的其他任务
+		static void Wait(const JobCounter& counter);
+
+		// func(begin, end)，按线程数自动分块，调用线程执行第一块并等待全部完成
+		template<typename F>
+		static void ParallelFor(uint32_t count, uint32_t minBatchSize, F&& func)
+		{
+			if (count == 0)
+				return;
+
+			uint32_t batchSize = ComputeBatchSize(count, minBatchSize);
+			if (batchSize >= count || !IsInitialized())
+			{
+				func(0u, count);
+				return;
+			}
+
+			JobCounter counter;
+			for (uint32_t begin = batchSize; begin < count; begin += batchSize)
+			{
+				uint32_t end = begin + batchSize < count ? begin + batchSize : count;
+				Run([&func, begin, end]() { func(begin, end); }, &counter);
+			}
+
+			func(0u, batchSize);
+			Wait(counter);
+		}
+
+		// 执行一个可用的任务（本地队列 -> 共享队列 -> 窃取），没有任务时返回false
+		static bool TryExecuteOne();
+	private:
+		static Job* AllocateJob();
+		static void Submit(Job* job);
+		static uint32_t ComputeBatchSize(uint32_t count, uint32_t minBatchSize);
+	};
+
+} // namespace Hazel
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Hazel {
+
+	// Chase-Lev 工作窃取队列（固定容量，不扩容）
+	// 参考 "Correct and Efficient Work-Stealing for Weak Memory Models" (Lê et al. 2013)
+	// - Push / Pop 只能由拥有者线程调用（LIFO，缓存友好）
+	// - Steal 可以被任意线程调用（FIFO，从另一端拿）
+	template<typename T, size_t Capacity>
+	class WorkStealingQueue
+	{
+		static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+		static constexpr int64_t s_Mask = (int64_t)Capacity - 1;
+	public:
+		WorkStealingQueue()
+		{
+			for (auto& slot : m_Buffer)
+				slot.store(T{}, std::memory_order_relaxed);
+		}
+
+		// 队列满时返回false，调用方应直接执行该任务
+		bool Push(T item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			if (bottom - top >= (int64_t)Capacity)
+				return false;
+
+			m_Buffer[bottom & s_Mask].store(item, std::memory_order_release);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		bool Pop(T& out)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				// 空队列
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			out = m_Buffer[bottom & s_Mask].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// 最后一个元素，和窃取者竞争
+				bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return won;
+			}
+			return true;
+		}
+
+		bool Steal(T& out)
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return false;
+
+			out = m_Buffer[top & s_Mask].load(std::memory_order_acquire);
+			return m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+
+		size_t ApproximateSize() const
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+			return bottom > top ? (size_t)(bottom - top) : 0;
+		}
+	private:
+		// top 和 bottom 分开放在不同的cache line，避免窃取者和拥有者互相伪共享
+		alignas(64) std::atomic<int64_t> m_Top{ 0 };
+		alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+		alignas(64) std::atomic<T> m_Buffer[Capacity];
+	};
+
+} // namespace Hazel
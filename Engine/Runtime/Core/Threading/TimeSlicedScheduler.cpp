@@ -0,0 +1,215 @@
+#include "hzpch.h"
+#include "TimeSlicedScheduler.h"
+
+namespace Hazel {
+
+	static const char* GetPriorityName(BackgroundPriority priority)
+	{
+		switch (priority)
+		{
+		case BackgroundPriority::High:		return "High";
+		case BackgroundPriority::Normal:	return "Normal";
+		case BackgroundPriority::Low:		return "Low";
+		default:							return "Unknown";
+		}
+	}
+
+	TimeSlicedScheduler::TaskId TimeSlicedScheduler::Register(const BackgroundTaskDesc& desc)
+	{
+		HZ_CORE_ASSERT(desc.Step, "Background task needs a Step function");
+
+		std::lock_guard<std::mutex> lock(m_PendingMutex);
+		Task task;
+		task.Id = m_NextId++;
+		task.Desc = desc;
+		task.Stats.Name = desc.Name;
+		task.Stats.Priority = desc.Priority;
+		task.NextRun = Clock::Now();
+		m_PendingAdd.push_back(std::move(task));
+		return m_PendingAdd.back().Id;
+	}
+
+	void TimeSlicedScheduler::Unregister(TaskId id)
+	{
+		if (std::this_thread::get_id() == m_RunThread.load(std::memory_order_relaxed))
+		{
+			for (Task& task : m_Tasks)
+			{
+				if (task.Id == id)
+					task.Removed = true;
+			}
+		}
+
+		// 还在 m_PendingAdd 里的任务要等 ApplyPending 才能删
+		std::lock_guard<std::mutex> lock(m_PendingMutex);
+		m_PendingRemove.push_back(id);
+	}
+
+	void TimeSlicedScheduler::ApplyPending()
+	{
+		std::lock_guard<std::mutex> lock(m_PendingMutex);
+		for (Task& task : m_PendingAdd)
+			m_Tasks.push_back(std::move(task));
+		m_PendingAdd.clear();
+
+		for (TaskId id : m_PendingRemove)
+		{
+			for (Task& task : m_Tasks)
+			{
+				if (task.Id == id)
+					task.Removed = true;
+			}
+		}
+		m_PendingRemove.clear();
+
+		m_Tasks.erase(std::remove_if(m_Tasks.begin(), m_Tasks.end(), [](const Task& task) { return task.Removed; }), m_Tasks.end());
+	}
+
+	bool TimeSlicedScheduler::IsReady(const Task& task, Clock::TimePoint now, uint64_t frameIndex) const
+	{
+		return !task.Removed && task.YieldedFrame != frameIndex && task.NextRun <= now;
+	}
+
+	TimeSlicedScheduler::Task* TimeSlicedScheduler::PickNext(Clock::TimePoint now, uint64_t frameIndex)
+	{
+		// 等待过久的任务最先，其次优先级，同优先级取最久没执行的
+		Task* best = nullptr;
+		bool bestStarving = false;
+		for (Task& task : m_Tasks)
+		{
+			if (!IsReady(task, now, frameIndex))
+				continue;
+
+			// 提前一次就够了，本帧执行过之后按正常顺序排
+			bool starving = !task.RanThisFrame && task.Stats.WaitFrames >= task.Desc.MaxWaitFrames;
+			if (!best
+				|| (starving && !bestStarving)
+				|| (starving == bestStarving && task.Desc.Priority < best->Desc.Priority)
+				|| (starving == bestStarving && task.Desc.Priority == best->Desc.Priority && task.LastSlice < best->LastSlice))
+			{
+				best = &task;
+				bestStarving = starving;
+			}
+		}
+
+		if (best && bestStarving)
+		{
+			best->Stats.StarvationBoosts++;
+			m_Stats.StarvationBoosts++;
+		}
+		return best;
+	}
+
+	void TimeSlicedScheduler::RunFrame(uint64_t frameIndex)
+	{
+		HZ_PROFILE_FUNCTION();
+		m_RunThread.store(std::this_thread::get_id(), std::memory_order_relaxed);
+		ApplyPending();
+		if (m_Tasks.empty())
+			return;
+
+		const Clock::TimePoint frameStart = Clock::Now();
+		TimeSlice slice;
+		slice.FrameIndex = frameIndex;
+		slice.Deadline = frameStart + std::chrono::duration_cast<Clock::TimePoint::duration>(std::chrono::duration<double, std::milli>(m_BudgetMs));
+
+		for (Task& task : m_Tasks)
+			task.RanThisFrame = false;
+
+		uint64_t slicesThisFrame = 0;
+		Clock::TimePoint now = frameStart;
+		while (true)
+		{
+			// 第一个 slice 不看预算，保证有进展
+			if (slicesThisFrame > 0 && now >= slice.Deadline)
+				break;
+
+			Task* task = PickNext(now, frameIndex);
+			if (!task)
+				break;
+
+			Clock::TimePoint sliceStart = now;
+			SliceResult result = task->Desc.Step(slice);
+			now = Clock::Now();
+
+			double sliceMs = Clock::ElapsedSeconds(sliceStart, now) * 1000.0;
+			BackgroundTaskStats& stats = task->Stats;
+			stats.Slices++;
+			stats.TotalMs += sliceMs;
+			stats.MaxSliceMs = std::max(stats.MaxSliceMs, sliceMs);
+			if (now > slice.Deadline)
+				stats.Overruns++;
+
+			task->RanThisFrame = true;
+			task->LastSlice = ++m_SliceCounter;
+			slicesThisFrame++;
+
+			if (result == SliceResult::Yield)
+			{
+				task->YieldedFrame = frameIndex;
+			}
+			else if (result == SliceResult::Done)
+			{
+				stats.CompletedRuns++;
+				if (task->Desc.IntervalMs > 0.0)
+					task->NextRun = now + std::chrono::duration_cast<Clock::TimePoint::duration>(std::chrono::duration<double, std::milli>(task->Desc.IntervalMs));
+				else
+					task->Removed = true;
+			}
+		}
+
+		// 本帧有工作但没轮到的任务累计等待帧数
+		bool anyWaiting = false;
+		for (Task& task : m_Tasks)
+		{
+			if (task.RanThisFrame)
+			{
+				task.Stats.WaitFrames = 0;
+			}
+			else if (IsReady(task, now, frameIndex))
+			{
+				anyWaiting = true;
+				task.Stats.WaitFrames++;
+				task.Stats.MaxWaitFrames = std::max(task.Stats.MaxWaitFrames, task.Stats.WaitFrames);
+			}
+		}
+
+		double usedMs = Clock::ElapsedSeconds(frameStart, now) * 1000.0;
+		m_Stats.Frames++;
+		m_Stats.Slices += slicesThisFrame;
+		m_Stats.TotalMs += usedMs;
+		m_Stats.LastFrameMs = usedMs;
+		if (usedMs > m_BudgetMs)
+		{
+			m_Stats.OverrunFrames++;
+			m_Stats.MaxOverrunMs = std::max(m_Stats.MaxOverrunMs, usedMs - m_BudgetMs);
+		}
+		if (anyWaiting)
+			m_Stats.SaturatedFrames++;
+
+		m_Tasks.erase(std::remove_if(m_Tasks.begin(), m_Tasks.end(), [](const Task& task) { return task.Removed; }), m_Tasks.end());
+	}
+
+	void TimeSlicedScheduler::GetTaskStats(std::vector<BackgroundTaskStats>& outStats) const
+	{
+		outStats.clear();
+		for (const Task& task : m_Tasks)
+			outStats.push_back(task.Stats);
+	}
+
+	void TimeSlicedScheduler::LogReport() const
+	{
+		const BackgroundSchedulerStats& stats = m_Stats;
+		HZ_CORE_INFO("Background tasks: budget {0:.2f} ms, {1} frames, {2} slices, avg {3:.3f} ms/frame",
+			m_BudgetMs, stats.Frames, stats.Slices, stats.Frames ? stats.TotalMs / (double)stats.Frames : 0.0);
+		HZ_CORE_INFO("  over budget {0} frames (max +{1:.3f} ms), saturated {2} frames, starvation boosts {3}",
+			stats.OverrunFrames, stats.MaxOverrunMs, stats.SaturatedFrames, stats.StarvationBoosts);
+		for (const Task& task : m_Tasks)
+		{
+			const BackgroundTaskStats& t = task.Stats;
+			HZ_CORE_INFO("  {0:<24} {1:<6} slices {2:>7} runs {3:>5} total {4:>8.2f} ms max slice {5:.3f} ms overruns {6} max wait {7} frames",
+				t.Name, GetPriorityName(t.Priority), t.Slices, t.CompletedRuns, t.TotalMs, t.MaxSliceMs, t.Overruns, t.MaxWaitFrames);
+		}
+	}
+
+} // namespace Hazel
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Time/FrameTimer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Hazel {
+
+	enum class BackgroundPriority : uint8_t
+	{
+		High = 0,
+		Normal,
+		Low
+	};
+
+	// Step 的返回值
+	enum class SliceResult : uint8_t
+	{
+		Continue = 0,	// 还有工作，本帧预算内可以再次调用
+		Yield,			// 还有工作，但本帧不要再调用（比如在等别的系统）
+		Done			// 这一轮做完了：周期任务等 Interval 之后开始下一轮，一次性任务移除
+	};
+
+	// 传给 Step，任务内部循环时用 HasTime 判断是否该返回
+	struct TimeSlice
+	{
+		Clock::TimePoint Deadline;
+		uint64_t FrameIndex = 0;
+
+		inline bool HasTime() const { return Clock::Now() < Deadline; }
+		inline double GetRemainingMs() const { return std::max(0.0, Clock::ElapsedSeconds(Clock::Now(), Deadline) * 1000.0); }
+	};
+
+	struct BackgroundTaskDesc
+	{
+		std::string Name;
+		BackgroundPriority Priority = BackgroundPriority::Normal;
+		// 做一小段可以中断的工作，进度保存在任务自己的状态里，下次调用接着做
+		std::function<SliceResult(const TimeSlice&)> Step;
+		// > 0 为周期任务，两轮之间至少间隔这么久；0 为一次性任务
+		double IntervalMs = 0.0;
+		// 有工作却连续这么多帧没轮到，下一帧排在所有任务前面（防止被高优先级任务饿死）
+		uint32_t MaxWaitFrames = 30;
+	};
+
+	struct BackgroundTaskStats
+	{
+		std::string Name;
+		BackgroundPriority Priority = BackgroundPriority::Normal;
+		uint64_t Slices = 0;
+		uint64_t CompletedRuns = 0;
+		double TotalMs = 0.0;
+		double MaxSliceMs = 0.0;
+		// 结束时间超过本帧预算的 slice 数
+		uint64_t Overruns = 0;
+		uint32_t WaitFrames = 0;
+		uint32_t MaxWaitFrames = 0;
+		// 因为等待过久被提前的次数
+		uint64_t StarvationBoosts = 0;
+	};
+
+	struct BackgroundSchedulerStats
+	{
+		uint64_t Frames = 0;
+		uint64_t Slices = 0;
+		double TotalMs = 0.0;
+		// 用时超过预算的帧数和最大超出量
+		uint64_t OverrunFrames = 0;
+		double MaxOverrunMs = 0.0;
+		// 有任务等待但预算用完的帧数
+		uint64_t SaturatedFrames = 0;
+		uint64_t StarvationBoosts = 0;
+		double LastFrameMs = 0.0;
+	};
+
+	// 主线程上的分时后台任务
+	// - 缓存清理、资源收尾、缩略图生成这类不急但也不能一次做完的工作，拆成可恢复的小步
+	// - 每帧 RunFrame 在预算内按优先级轮流调用各任务的 Step，同优先级轮询；
+	//   只要有工作，每帧至少执行一个 slice，保证总有进展
+	// - Register / Unregister 可以在任意线程调用，下一次 RunFrame 生效（主线程上的 Unregister 立即生效）；
+	//   Step 只在主线程执行
+	class HAZEL_API TimeSlicedScheduler
+	{
+	public:
+		using TaskId = uint32_t;
+		static constexpr TaskId s_InvalidTask = 0;
+	public:
+		TimeSlicedScheduler(double budgetMs = 1.0) : m_BudgetMs(budgetMs) {}
+		TimeSlicedScheduler(const TimeSlicedScheduler&) = delete;
+		TimeSlicedScheduler& operator=(const TimeSlicedScheduler&) = delete;
+
+		TaskId Register(const BackgroundTaskDesc& desc);
+		// 在执行 RunFrame 的线程上调用（包括任务自己的 Step 里）立即生效，本帧不会再执行它；
+		// 其他线程调用时下一次 RunFrame 生效
+		void Unregister(TaskId id);
+
+		inline void SetBudgetMs(double budgetMs) { m_BudgetMs = budgetMs; }
+		inline double GetBudgetMs() const { return m_BudgetMs; }
+
+		// 主线程每帧调用一次
+		void RunFrame(uint64_t frameIndex);
+
+		inline const BackgroundSchedulerStats& GetStats() const { return m_Stats; }
+		void GetTaskStats(std::vector<BackgroundTaskStats>& outStats) const;
+		size_t GetTaskCount() const { return m_Tasks.size(); }
+
+		void LogReport() const;
+	private:
+		struct Task
+		{
+			TaskId Id = s_InvalidTask;
+			BackgroundTaskDesc Desc;
+			BackgroundTaskStats Stats;
+			// 周期任务下一轮最早开始的时间
+			Clock::TimePoint NextRun;
+			// 同优先级轮询用，越小越久没执行
+			uint64_t LastSlice = 0;
+			uint64_t YieldedFrame = UINT64_MAX;
+			bool RanThisFrame = false;
+			bool Removed = false;
+		};
+
+		void ApplyPending();
+		bool IsReady(const Task& task, Clock::TimePoint now, uint64_t frameIndex) const;
+		Task* PickNext(Clock::TimePoint now, uint64_t frameIndex);
+	private:
+		double m_BudgetMs;
+		std::vector<Task> m_Tasks;
+		uint64_t m_SliceCounter = 0;
+		BackgroundSchedulerStats m_Stats;
+
+		std::mutex m_PendingMutex;
+		std::vector<Task> m_PendingAdd;
+		std::vector<TaskId> m_PendingRemove;
+		TaskId m_NextId = 1;
+		// 执行 RunFrame 的线程，只有它能直接改 m_Tasks
+		std::atomic<std::thread::id> m_RunThread;
+	};
+
+	// 把 unordered_map 的清理拆成小步：每次从 cursor 开始检查最多 maxBuckets 个桶，删除满足 pred 的元素
+	// 整张表扫完一遍返回 true 并把 cursor 归零；两步之间表可以被修改（rehash 后可能漏掉几个，下一遍补上）
+	template<typename Map, typename Pred>
+	bool SweepBuckets(Map& map, size_t& cursor, size_t maxBuckets, Pred pred)
+	{
+		size_t bucketCount = map.bucket_count();
+		size_t end = std::min(bucketCount, cursor + maxBuckets);
+		std::vector<typename Map::key_type> expired;
+		for (; cursor < end; cursor++)
+		{
+			for (auto it = map.begin(cursor); it != map.end(cursor); ++it)
+			{
+				if (pred(*it))
+					expired.push_back(it->first);
+			}
+			// 桶内迭代器不能用来删除，按 key 删除不会触发 rehash
+			for (const auto& key : expired)
+				map.erase(key);
+			expired.clear();
+		}
+
+		if (cursor >= bucketCount)
+		{
+			cursor = 0;
+			return true;
+		}
+		return false;
+	}
+
+} // namespace Hazel
@@ -0,0 +1,128 @@
+#include "hzpch.h"
+#include "FrameTimer.h"
+
+#include <thread>
+
+#ifdef HZ_PLATFORM_WINDOWS
+	#include <timeapi.h>
+	#pragma comment(lib, "winmm.lib")
+#endif
+
+namespace Hazel {
+
+	// sleep is only accurate to the scheduler quantum, the last part before the deadline is yielded away
+	static constexpr double s_SpinMarginSeconds = 0.002;
+
+	FrameTimer::FrameTimer(uint32_t historySize)
+	{
+		if (historySize == 0)
+			historySize = 1;
+		m_History.assign(historySize, 0.0f);
+		m_SortScratch.reserve(historySize);
+		m_StartTime = Clock::Now();
+		m_FrameStart = m_StartTime;
+
+#ifdef HZ_PLATFORM_WINDOWS
+		// default timer resolution is ~15.6ms which makes Sleep useless for pacing
+		timeBeginPeriod(1);
+#endif
+	}
+
+	FrameTimer::~FrameTimer()
+	{
+#ifdef HZ_PLATFORM_WINDOWS
+		timeEndPeriod(1);
+#endif
+	}
+
+	Timestep FrameTimer::BeginFrame()
+	{
+		Clock::TimePoint now = Clock::Now();
+		if (m_FirstFrame)
+		{
+			m_DeltaTime = 0.0f;
+			m_FirstFrame = false;
+		}
+		else
+		{
+			float delta = (float)Clock::ElapsedSeconds(m_FrameStart, now);
+			m_DeltaTime = delta < m_MaxDeltaTime ? delta : m_MaxDeltaTime;
+		}
+		m_FrameStart = now;
+
+		m_Accumulator += m_DeltaTime;
+		m_Stats.FrameDeltaMs = m_DeltaTime * 1000.0f;
+		m_Stats.FixedStepsThisFrame = 0;
+		return Timestep(m_DeltaTime);
+	}
+
+	uint32_t FrameTimer::ConsumeFixedSteps()
+	{
+		uint32_t steps = 0;
+		while (m_Accumulator >= m_FixedTimestep && steps < m_MaxFixedSteps)
+		{
+			m_Accumulator -= m_FixedTimestep;
+			steps++;
+		}
+
+		// we could not keep up, drop the backlog instead of spiraling
+		if (m_Accumulator >= m_FixedTimestep)
+			m_Accumulator = 0.0;
+
+		m_Alpha = (float)(m_Accumulator / m_FixedTimestep);
+		m_Stats.FixedStepsThisFrame += steps;
+		return steps;
+	}
+
+	void FrameTimer::EndFrame()
+	{
+		Clock::TimePoint now = Clock::Now();
+		RecordCpuTime((float)(Clock::ElapsedSeconds(m_FrameStart, now) * 1000.0));
+
+		if (m_TargetFrameTime > 0.0f)
+		{
+			auto target = std::chrono::duration_cast<Clock::TimePoint::duration>(std::chrono::duration<double>(m_TargetFrameTime));
+			WaitUntil(m_FrameStart + target);
+		}
+	}
+
+	void FrameTimer::RecordCpuTime(float ms)
+	{
+		const uint32_t capacity = (uint32_t)m_History.size();
+
+		m_HistorySum -= m_History[m_HistoryHead];
+		m_History[m_HistoryHead] = ms;
+		m_HistorySum += ms;
+		m_HistoryHead = (m_HistoryHead + 1) % capacity;
+
+		m_Stats.FrameIndex++;
+		if (m_Stats.SampleCount < capacity)
+			m_Stats.SampleCount++;
+
+		const uint32_t count = m_Stats.SampleCount;
+		// while the window is filling up the valid samples are [0, count)
+		const float* samples = m_History.data();
+
+		m_SortScratch.assign(samples, samples + count);
+		uint32_t p99Index = (uint32_t)((count - 1) * 0.99f);
+		std::nth_element(m_SortScratch.begin(), m_SortScratch.begin() + p99Index, m_SortScratch.end());
+
+		m_Stats.CpuFrameMs = ms;
+		m_Stats.MinCpuFrameMs = *std::min_element(samples, samples + count);
+		m_Stats.AvgCpuFrameMs = (float)(m_HistorySum / count);
+		m_Stats.P99CpuFrameMs = m_SortScratch[p99Index];
+	}
+
+	void FrameTimer::WaitUntil(Clock::TimePoint deadline)
+	{
+		auto margin = std::chrono::duration_cast<Clock::TimePoint::duration>(std::chrono::duration<double>(s_SpinMarginSeconds));
+
+		Clock::TimePoint now = Clock::Now();
+		if (deadline - now > margin)
+			std::this_thread::sleep_for(deadline - now - margin);
+
+		while (Clock::Now() < deadline)
+			std::this_thread::yield();
+	}
+
+}
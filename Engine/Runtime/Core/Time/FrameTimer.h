@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Time/Timestep.h"
+
+#include <chrono>
+#include <vector>
+#include <cstdint>
+
+namespace Hazel {
+
+	// monotonic high resolution clock, steady_clock maps to QueryPerformanceCounter on MSVC
+	class Clock
+	{
+	public:
+		using TimePoint = std::chrono::steady_clock::time_point;
+
+		static TimePoint Now() { return std::chrono::steady_clock::now(); }
+
+		static uint64_t NowNanoseconds()
+		{
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Now().time_since_epoch()).count();
+		}
+
+		static double ElapsedSeconds(TimePoint from, TimePoint to)
+		{
+			return std::chrono::duration<double>(to - from).count();
+		}
+	};
+
+	// cpu side frame statistics over a rolling window, all values in milliseconds
+	struct FrameStats
+	{
+		uint64_t FrameIndex = 0;
+		uint32_t SampleCount = 0;
+
+		// time spent in the frame before pacing kicked in
+		float CpuFrameMs = 0.0f;
+		float MinCpuFrameMs = 0.0f;
+		float AvgCpuFrameMs = 0.0f;
+		float P99CpuFrameMs = 0.0f;
+
+		// wall time between two frame starts (what the simulation actually sees)
+		float FrameDeltaMs = 0.0f;
+		uint32_t FixedStepsThisFrame = 0;
+	};
+
+	// Drives the main loop timing:
+	//  - variable delta time measured with a high resolution clock
+	//  - fixed step accumulator + interpolation alpha for deterministic simulation
+	//  - rolling min/avg/p99 cpu frame time
+	//  - optional pacing to a target frame time (sleep, then a short yield tail)
+	class HAZEL_API FrameTimer
+	{
+	public:
+		FrameTimer(uint32_t historySize = 240);
+		~FrameTimer();
+
+		// call once at the start of a frame, returns the variable delta time
+		Timestep BeginFrame();
+		// call once at the end of a frame, records cpu time and waits for the target frame time
+		void EndFrame();
+
+		// number of fixed steps the simulation has to run this frame, consumes them from the accumulator
+		uint32_t ConsumeFixedSteps();
+		// drop whatever is left in the accumulator (e.g. after a long stall or while minimized)
+		void ResetAccumulator() { m_Accumulator = 0.0; }
+
+		inline void SetFixedTimestep(float seconds) { m_FixedTimestep = seconds > 0.0f ? seconds : m_FixedTimestep; }
+		inline Timestep GetFixedTimestep() const { return Timestep(m_FixedTimestep); }
+		inline void SetMaxFixedStepsPerFrame(uint32_t steps) { m_MaxFixedSteps = steps ? steps : 1; }
+
+		// 0 means unlimited
+		inline void SetTargetFrameTime(float seconds) { m_TargetFrameTime = seconds > 0.0f ? seconds : 0.0f; }
+		inline void SetTargetFrameRate(float fps) { SetTargetFrameTime(fps > 0.0f ? 1.0f / fps : 0.0f); }
+		inline float GetTargetFrameTime() const { return m_TargetFrameTime; }
+
+		// how far we are between the last and the next fixed step, [0, 1)
+		inline float GetInterpolationAlpha() const { return m_Alpha; }
+		inline Timestep GetDeltaTime() const { return Timestep(m_DeltaTime); }
+		inline double GetTime() const { return Clock::ElapsedSeconds(m_StartTime, Clock::Now()); }
+		inline const FrameStats& GetStats() const { return m_Stats; }
+	private:
+		void RecordCpuTime(float ms);
+		void WaitUntil(Clock::TimePoint deadline);
+	private:
+		Clock::TimePoint m_StartTime;
+		Clock::TimePoint m_FrameStart;
+		bool m_FirstFrame = true;
+
+		float m_DeltaTime = 0.0f;
+		// clamp for hitches (debugger break, window drag...) so the sim does not explode
+		float m_MaxDeltaTime = 0.25f;
+
+		double m_Accumulator = 0.0;
+		float m_FixedTimestep = 1.0f / 60.0f;
+		uint32_t m_MaxFixedSteps = 8;
+		float m_Alpha = 0.0f;
+
+		float m_TargetFrameTime = 0.0f;
+
+		// ring buffer of cpu frame times, scratch is reused for the p99 selection
+		std::vector<float> m_History;
+		std::vector<float> m_SortScratch;
+		uint32_t m_HistoryHead = 0;
+		double m_HistorySum = 0.0;
+
+		FrameStats m_Stats;
+	};
+
+}
@@ -0,0 +1,395 @@
+#include "hzpch.h"
+#include "Instrumentor.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace Hazel {
+
+	namespace {
+
+		// single producer (owning thread) / single consumer (flush thread) ring
+		struct ThreadBuffer
+		{
+			static constexpr uint64_t s_Capacity = 1 << 14;
+
+			alignas(64) std::atomic<uint64_t> Head{ 0 };
+			alignas(64) std::atomic<uint64_t> Tail{ 0 };
+
+			ProfileEvent Events[s_Capacity];
+
+			uint32_t ThreadId = 0;
+			std::mutex NameMutex;
+			std::string Name;
+			bool NameDirty = true;
+		};
+
+		thread_local ThreadBuffer* t_ThreadBuffer = nullptr;
+
+		// binary record kinds (.hzprof)
+		enum class BinaryRecord : uint8_t
+		{
+			String = 0,		// uint32 id, uint32 length, chars
+			ThreadName,		// uint32 thread id, uint32 length, chars
+			Event			// uint8 type, uint32 thread id, uint32 name id, uint64 timestamp, uint64 value
+		};
+
+		constexpr char s_BinaryMagic[8] = { 'H', 'Z', 'P', 'R', 'O', 'F', '0', '1' };
+		constexpr auto s_FlushInterval = std::chrono::milliseconds(10);
+
+	}
+
+	struct Instrumentor::Impl
+	{
+		std::mutex RegistryMutex;
+		std::vector<std::unique_ptr<ThreadBuffer>> Buffers;
+
+		std::mutex SessionMutex;
+		std::thread FlushThread;
+		std::mutex FlushMutex;
+		std::condition_variable FlushCondition;
+		bool StopFlush = false;
+
+		std::ofstream Output;
+		std::string SessionName;
+		bool Binary = false;
+		bool FirstJsonEvent = true;
+		uint64_t SessionStartNs = 0;
+
+		// flush thread only
+		std::unordered_map<const char*, uint32_t> NameIds;
+		std::string Line;
+
+		ThreadBuffer& GetThreadBuffer()
+		{
+			if (!t_ThreadBuffer)
+			{
+				std::lock_guard<std::mutex> lock(RegistryMutex);
+				Buffers.push_back(std::make_unique<ThreadBuffer>());
+				ThreadBuffer* buffer = Buffers.back().get();
+				buffer->ThreadId = (uint32_t)Buffers.size() - 1;
+				buffer->Name = "Thread " + std::to_string(buffer->ThreadId);
+				t_ThreadBuffer = buffer;
+			}
+			return *t_ThreadBuffer;
+		}
+
+		template<typename T>
+		void WriteRaw(const T& value)
+		{
+			Output.write(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		void WriteBinaryString(BinaryRecord kind, uint32_t id, const char* text)
+		{
+			uint32_t length = (uint32_t)strlen(text);
+			WriteRaw((uint8_t)kind);
+			WriteRaw(id);
+			WriteRaw(length);
+			Output.write(text, length);
+		}
+
+		uint32_t GetNameId(const char* name)
+		{
+			auto it = NameIds.find(name);
+			if (it != NameIds.end())
+				return it->second;
+
+			uint32_t id = (uint32_t)NameIds.size();
+			NameIds.emplace(name, id);
+			WriteBinaryString(BinaryRecord::String, id, name);
+			return id;
+		}
+
+		void BeginJsonEvent()
+		{
+			if (!FirstJsonEvent)
+				Output << ",\n";
+			FirstJsonEvent = false;
+		}
+
+		static void AppendEscaped(std::string& out, const char* text)
+		{
+			for (const char* c = text; *c; c++)
+			{
+				if (*c == '"')
+					out += '\'';
+				else if (*c == '\\')
+					out += '/';
+				else
+					out += *c;
+			}
+		}
+
+		void WriteThreadName(ThreadBuffer& buffer)
+		{
+			std::string name;
+			{
+				std::lock_guard<std::mutex> lock(buffer.NameMutex);
+				if (!buffer.NameDirty)
+					return;
+				buffer.NameDirty = false;
+				name = buffer.Name;
+			}
+
+			if (Binary)
+			{
+				WriteBinaryString(BinaryRecord::ThreadName, buffer.ThreadId, name.c_str());
+				return;
+			}
+
+			BeginJsonEvent();
+			Line.clear();
+			Line += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":";
+			Line += std::to_string(buffer.ThreadId);
+			Line += ",\"args\":{\"name\":\"";
+			AppendEscaped(Line, name.c_str());
+			Line += "\"}}";
+			Output << Line;
+		}
+
+		void WriteEvent(const ProfileEvent& e, uint32_t threadId)
+		{
+			uint64_t relativeNs = e.TimestampNs > SessionStartNs ? e.TimestampNs - SessionStartNs : 0;
+
+			if (Binary)
+			{
+				uint32_t nameId = GetNameId(e.Name);
+				WriteRaw((uint8_t)BinaryRecord::Event);
+				WriteRaw((uint8_t)e.EventType);
+				WriteRaw(threadId);
+				WriteRaw(nameId);
+				WriteRaw(relativeNs);
+				WriteRaw(e.Value);
+				return;
+			}
+
+			char number[64];
+			BeginJsonEvent();
+			Line.clear();
+			Line += "{\"name\":\"";
+			AppendEscaped(Line, e.Name);
+			Line += "\",\"pid\":0,\"tid\":";
+			Line += std::to_string(threadId);
+			// chrome tracing timestamps are microseconds, keep the ns as decimals
+			snprintf(number, sizeof(number), ",\"ts\":%.3f", relativeNs / 1000.0);
+			Line += number;
+
+			switch (e.EventType)
+			{
+			case ProfileEvent::Type::Scope:
+				snprintf(number, sizeof(number), ",\"dur\":%.3f", e.Value / 1000.0);
+				Line += ",\"cat\":\"function\",\"ph\":\"X\"";
+				Line += number;
+				break;
+			case ProfileEvent::Type::Counter:
+			{
+				double value;
+				memcpy(&value, &e.Value, sizeof(double));
+				snprintf(number, sizeof(number), "%.6g", value);
+				Line += ",\"ph\":\"C\",\"args\":{\"value\":";
+				Line += number;
+				Line += "}";
+				break;
+			}
+			case ProfileEvent::Type::FrameMark:
+				Line += ",\"ph\":\"i\",\"s\":\"g\",\"args\":{\"frame\":";
+				Line += std::to_string(e.Value);
+				Line += "}";
+				break;
+			case ProfileEvent::Type::Instant:
+				Line += ",\"ph\":\"i\",\"s\":\"t\"";
+				break;
+			}
+			Line += "}";
+			Output << Line;
+		}
+	};
+
+	Instrumentor::Instrumentor()
+		: m_Impl(new Impl())
+	{
+	}
+
+	Instrumentor::~Instrumentor()
+	{
+		EndSession();
+		delete m_Impl;
+	}
+
+	void Instrumentor::BeginSession(const std::string& name, const std::string& filepath)
+	{
+		std::lock_guard<std::mutex> sessionLock(m_Impl->SessionMutex);
+		if (m_SessionActive.load())
+		{
+			HZ_CORE_ERROR("Instrumentor::BeginSession('{0}') when session '{1}' already open.", name, m_Impl->SessionName);
+			return;
+		}
+
+		Impl& impl = *m_Impl;
+		impl.Binary = filepath.size() >= 7 && filepath.compare(filepath.size() - 7, 7, ".hzprof") == 0;
+		impl.Output.open(filepath, impl.Binary ? std::ios::out | std::ios::binary : std::ios::out);
+		if (!impl.Output.is_open())
+		{
+			HZ_CORE_ERROR("Instrumentor could not open results file '{0}'.", filepath);
+			return;
+		}
+
+		impl.SessionName = name;
+		impl.SessionStartNs = NowNanoseconds();
+		impl.FirstJsonEvent = true;
+		impl.NameIds.clear();
+
+		{
+			// drop anything recorded between the last session and this one, re-emit thread names
+			std::lock_guard<std::mutex> lock(impl.RegistryMutex);
+			for (auto& buffer : impl.Buffers)
+			{
+				buffer->Tail.store(buffer->Head.load(std::memory_order_acquire), std::memory_order_release);
+				std::lock_guard<std::mutex> nameLock(buffer->NameMutex);
+				buffer->NameDirty = true;
+			}
+		}
+
+		if (impl.Binary)
+		{
+			impl.Output.write(s_BinaryMagic, sizeof(s_BinaryMagic));
+			impl.WriteRaw(impl.SessionStartNs);
+		}
+		else
+		{
+			impl.Output << "{\"otherData\": {},\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+		}
+
+		m_FrameIndex.store(0, std::memory_order_relaxed);
+		impl.StopFlush = false;
+		impl.FlushThread = std::thread([this]() { FlushThreadLoop(); });
+		m_SessionActive.store(true, std::memory_order_release);
+	}
+
+	void Instrumentor::EndSession()
+	{
+		std::lock_guard<std::mutex> sessionLock(m_Impl->SessionMutex);
+		if (!m_SessionActive.load())
+			return;
+
+		m_SessionActive.store(false, std::memory_order_release);
+
+		Impl& impl = *m_Impl;
+		{
+			std::lock_guard<std::mutex> lock(impl.FlushMutex);
+			impl.StopFlush = true;
+		}
+		impl.FlushCondition.notify_one();
+		impl.FlushThread.join();
+
+		DrainAll(true);
+		if (!impl.Binary)
+			impl.Output << "\n]}";
+		impl.Output.close();
+
+		uint64_t dropped = m_DroppedEvents.exchange(0);
+		if (dropped)
+			HZ_CORE_WARN("Instrumentor session '{0}' dropped {1} events (ring buffer full)", impl.SessionName, dropped);
+	}
+
+	void Instrumentor::Record(const ProfileEvent& e)
+	{
+		ThreadBuffer& buffer = m_Impl->GetThreadBuffer();
+		uint64_t head = buffer.Head.load(std::memory_order_relaxed);
+		uint64_t tail = buffer.Tail.load(std::memory_order_acquire);
+		if (head - tail >= ThreadBuffer::s_Capacity)
+		{
+			m_DroppedEvents.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		buffer.Events[head & (ThreadBuffer::s_Capacity - 1)] = e;
+		buffer.Head.store(head + 1, std::memory_order_release);
+	}
+
+	void Instrumentor::WriteScope(const char* name, uint64_t startNs, uint64_t durationNs)
+	{
+		Record({ name, startNs, durationNs, ProfileEvent::Type::Scope });
+	}
+
+	void Instrumentor::WriteCounter(const char* name, double value)
+	{
+		if (!IsSessionActive())
+			return;
+
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(double));
+		Record({ name, NowNanoseconds(), bits, ProfileEvent::Type::Counter });
+	}
+
+	void Instrumentor::WriteFrameMark()
+	{
+		if (!IsSessionActive())
+			return;
+
+		uint64_t frame = m_FrameIndex.fetch_add(1, std::memory_order_relaxed);
+		Record({ "Frame", NowNanoseconds(), frame, ProfileEvent::Type::FrameMark });
+	}
+
+	void Instrumentor::WriteInstant(const char* name)
+	{
+		if (!IsSessionActive())
+			return;
+
+		Record({ name, NowNanoseconds(), 0, ProfileEvent::Type::Instant });
+	}
+
+	void Instrumentor::SetThreadName(const std::string& name)
+	{
+		ThreadBuffer& buffer = m_Impl->GetThreadBuffer();
+		std::lock_guard<std::mutex> lock(buffer.NameMutex);
+		buffer.Name = name;
+		buffer.NameDirty = true;
+	}
+
+	void Instrumentor::FlushThreadLoop()
+	{
+		Impl& impl = *m_Impl;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(impl.FlushMutex);
+				impl.FlushCondition.wait_for(lock, s_FlushInterval, [&impl]() { return impl.StopFlush; });
+				if (impl.StopFlush)
+					return;
+			}
+			DrainAll(false);
+		}
+	}
+
+	void Instrumentor::DrainAll(bool final)
+	{
+		Impl& impl = *m_Impl;
+
+		std::vector<ThreadBuffer*> buffers;
+		{
+			std::lock_guard<std::mutex> lock(impl.RegistryMutex);
+			buffers.reserve(impl.Buffers.size());
+			for (auto& buffer : impl.Buffers)
+				buffers.push_back(buffer.get());
+		}
+
+		for (ThreadBuffer* buffer : buffers)
+		{
+			impl.WriteThreadName(*buffer);
+
+			uint64_t tail = buffer->Tail.load(std::memory_order_relaxed);
+			uint64_t head = buffer->Head.load(std::memory_order_acquire);
+			for (; tail != head; tail++)
+				impl.WriteEvent(buffer->Events[tail & (ThreadBuffer::s_Capacity - 1)], buffer->ThreadId);
+			buffer->Tail.store(tail, std::memory_order_release);
+		}
+
+		if (final)
+			impl.Output.flush();
+	}
+
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Hazel {
+
+	// One recorded profiling event. Names must be string literals (or otherwise outlive the
+	// session): only the pointer is stored in the hot path, the flush thread resolves the text.
+	struct ProfileEvent
+	{
+		enum class Type : uint8_t
+		{
+			Scope = 0,		// complete event, Value = duration in ns
+			Counter,		// Value = counter value (double bits)
+			FrameMark,		// Value = frame index
+			Instant
+		};
+
+		const char* Name;
+		uint64_t TimestampNs;
+		uint64_t Value;
+		Type EventType;
+	};
+
+	// Low overhead chrome://tracing / Perfetto instrumentor.
+	//  - every thread records into its own lock-free single producer ring buffer
+	//  - a background thread drains the rings and streams them to disk
+	//  - output is trace event JSON, or the compact binary format when the file ends in ".hzprof"
+	//  - events recorded while no session is active are dropped with a single atomic load
+	class HAZEL_API Instrumentor
+	{
+	public:
+		Instrumentor(const Instrumentor&) = delete;
+		Instrumentor(Instrumentor&&) = delete;
+
+		static Instrumentor& Get()
+		{
+			static Instrumentor instance;
+			return instance;
+		}
+
+		void BeginSession(const std::string& name, const std::string& filepath = "results.json");
+		void EndSession();
+
+		inline bool IsSessionActive() const { return m_SessionActive.load(std::memory_order_relaxed); }
+
+		void WriteScope(const char* name, uint64_t startNs, uint64_t durationNs);
+		void WriteCounter(const char* name, double value);
+		void WriteFrameMark();
+		void WriteInstant(const char* name);
+
+		// display name of the calling thread in the trace viewer
+		void SetThreadName(const std::string& name);
+
+		// events lost because a thread ring buffer was full
+		inline uint64_t GetDroppedEventCount() const { return m_DroppedEvents.load(std::memory_order_relaxed); }
+
+		static inline uint64_t NowNanoseconds()
+		{
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		}
+	private:
+		Instrumentor();
+		~Instrumentor();
+
+		void Record(const ProfileEvent& e);
+		void FlushThreadLoop();
+		void DrainAll(bool final);
+	private:
+		struct Impl;
+		Impl* m_Impl = nullptr;
+
+		std::atomic<bool> m_SessionActive{ false };
+		std::atomic<uint64_t> m_DroppedEvents{ 0 };
+		std::atomic<uint64_t> m_FrameIndex{ 0 };
+	};
+
+	class InstrumentationTimer
+	{
+	public:
+		InstrumentationTimer(const char* name)
+			: m_Name(name), m_Active(Instrumentor::Get().IsSessionActive())
+		{
+			if (m_Active)
+				m_StartNs = Instrumentor::NowNanoseconds();
+		}
+
+		~InstrumentationTimer()
+		{
+			if (m_Active)
+				Instrumentor::Get().WriteScope(m_Name, m_StartNs, Instrumentor::NowNanoseconds() - m_StartNs);
+		}
+	private:
+		const char* m_Name;
+		uint64_t m_StartNs = 0;
+		bool m_Active;
+	};
+
+}
+
+#ifndef HZ_PROFILE
+	#ifdef HZ_DIST
+		#define HZ_PROFILE 0
+	#else
+		#define HZ_PROFILE 1
+	#endif
+#endif
+
+#if HZ_PROFILE
+	// Resolve which function signature macro will be used. Note that this only
+	// is resolved when the (pre)compiler starts, so the syntax highlighting
+	// could mark the wrong one in your editor!
+	#if defined(__GNUC__) || (defined(__MWERKS__) && (__MWERKS__ >= 0x3000)) || (defined(__ICC) && (__ICC >= 600)) || defined(__ghs__)
+		#define HZ_FUNC_SIG __PRETTY_FUNCTION__
+	#elif defined(__DMC__) && (__DMC__ >= 0x810)
+		#define HZ_FUNC_SIG __PRETTY_FUNCTION__
+	#elif (defined(__FUNCSIG__) || (_MSC_VER))
+		#define HZ_FUNC_SIG __FUNCSIG__
+	#elif (defined(__INTEL_COMPILER) && (__INTEL_COMPILER >= 600)) || (defined(__IBMCPP__) && (__IBMCPP__ >= 500))
+		#define HZ_FUNC_SIG __FUNCTION__
+	#elif defined(__BORLANDC__) && (__BORLANDC__ >= 0x550)
+		#define HZ_FUNC_SIG __FUNC__
+	#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901)
+		#define HZ_FUNC_SIG __func__
+	#elif defined(__cplusplus) && (__cplusplus >= 201103)
+		#define HZ_FUNC_SIG __func__
+	#else
+		#define HZ_FUNC_SIG "HZ_FUNC_SIG unknown!"
+	#endif
+
+	#define HZ_PROFILE_CONCAT_INNER(a, b) a##b
+	#define HZ_PROFILE_CONCAT(a, b) HZ_PROFILE_CONCAT_INNER(a, b)
+
+	#define HZ_PROFILE_BEGIN_SESSION(name, filepath) ::Hazel::Instrumentor::Get().BeginSession(name, filepath)
+	#define HZ_PROFILE_END_SESSION() ::Hazel::Instrumentor::Get().EndSession()
+	#define HZ_PROFILE_SCOPE(name) ::Hazel::InstrumentationTimer HZ_PROFILE_CONCAT(timer, __LINE__)(name)
+	#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE(HZ_FUNC_SIG)
+	#define HZ_PROFILE_COUNTER(name, value) ::Hazel::Instrumentor::Get().WriteCounter(name, (double)(value))
+	#define HZ_PROFILE_FRAME_MARK() ::Hazel::Instrumentor::Get().WriteFrameMark()
+	#define HZ_PROFILE_INSTANT(name) ::Hazel::Instrumentor::Get().WriteInstant(name)
+	#define HZ_PROFILE_THREAD(name) ::Hazel::Instrumentor::Get().SetThreadName(name)
+#else
+	#define HZ_PROFILE_BEGIN_SESSION(name, filepath)
+	#define HZ_PROFILE_END_SESSION()
+	#define HZ_PROFILE_SCOPE(name)
+	#define HZ_PROFILE_FUNCTION()
+	#define HZ_PROFILE_COUNTER(name, value)
+	#define HZ_PROFILE_FRAME_MARK()
+	#define HZ_PROFILE_INSTANT(name)
+	#define HZ_PROFILE_THREAD(name)
+#endif
@@ -0,0 +1,183 @@
+#include "hzpch.h"
+#include "PerfCounters.h"
+
+#include <fstream>
+
+namespace Hazel {
+
+	thread_local PerfCounters::ThreadCounters* PerfCounters::t_ThreadCounters = nullptr;
+	std::vector<PerfCounterFrame> PerfCounters::s_Recording;
+
+	struct PerfCounters::Registry
+	{
+		std::mutex Mutex;
+		// blocks are never freed: a thread that exits keeps its counts, and EndFrame never
+		// races with thread teardown
+		std::vector<ThreadCounters*> Blocks;
+
+		PerfCounterFrame History[HistorySize];
+		uint64_t HistoryCount = 0;
+		bool Recording = false;
+	};
+
+	// intentionally leaked so worker threads can still count during static destruction
+	PerfCounters::Registry& PerfCounters::GetRegistry()
+	{
+		static Registry* registry = new Registry();
+		return *registry;
+	}
+
+	const char* PerfCounters::GetCounterName(PerfCounter counter)
+	{
+		switch (counter)
+		{
+		case PerfCounter::DrawCalls:				return "DrawCalls";
+		case PerfCounter::Instances:				return "Instances";
+		case PerfCounter::PipelineSwitches:			return "PipelineSwitches";
+		case PerfCounter::DescriptorHeapSwitches:	return "DescriptorHeapSwitches";
+		case PerfCounter::DescriptorsAllocated:		return "DescriptorsAllocated";
+		case PerfCounter::ConstantBufferBytes:		return "ConstantBufferBytes";
+		case PerfCounter::CommandListsAcquired:		return "CommandListsAcquired";
+		case PerfCounter::MaterialsSynced:			return "MaterialsSynced";
+		case PerfCounter::TransformsUpdated:		return "TransformsUpdated";
+		default:									return "Unknown";
+		}
+	}
+
+	PerfCounters::ThreadCounters* PerfCounters::RegisterThread()
+	{
+		ThreadCounters* block = new ThreadCounters();
+		Registry& registry = GetRegistry();
+		{
+			std::lock_guard<std::mutex> lock(registry.Mutex);
+			registry.Blocks.push_back(block);
+		}
+		t_ThreadCounters = block;
+		return block;
+	}
+
+	void PerfCounters::EndFrame(uint64_t frameIndex, float cpuFrameMs)
+	{
+		PerfCounterFrame frame;
+		frame.FrameIndex = frameIndex;
+		frame.CpuFrameMs = cpuFrameMs;
+
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		for (ThreadCounters* block : registry.Blocks)
+		{
+			for (size_t i = 0; i < (size_t)PerfCounter::Count; i++)
+			{
+				uint64_t value = block->Values[i].load(std::memory_order_relaxed);
+				frame.Values[i] += value - block->Consumed[i];
+				block->Consumed[i] = value;
+			}
+		}
+
+		registry.History[registry.HistoryCount % HistorySize] = frame;
+		registry.HistoryCount++;
+		if (registry.Recording)
+			s_Recording.push_back(frame);
+	}
+
+	PerfCounterFrame PerfCounters::GetLastFrame()
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		if (registry.HistoryCount == 0)
+			return PerfCounterFrame{};
+		return registry.History[(registry.HistoryCount - 1) % HistorySize];
+	}
+
+	void PerfCounters::GetHistory(std::vector<PerfCounterFrame>& outFrames)
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		uint64_t count = std::min<uint64_t>(registry.HistoryCount, HistorySize);
+		outFrames.resize((size_t)count);
+		for (uint64_t i = 0; i < count; i++)
+			outFrames[(size_t)i] = registry.History[(registry.HistoryCount - count + i) % HistorySize];
+	}
+
+	void PerfCounters::BeginRecording(uint64_t reserveFrames)
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		s_Recording.clear();
+		if (reserveFrames)
+			s_Recording.reserve((size_t)reserveFrames);
+		registry.Recording = true;
+	}
+
+	void PerfCounters::EndRecording()
+	{
+		Registry& registry = GetRegistry();
+		std::lock_guard<std::mutex> lock(registry.Mutex);
+		registry.Recording = false;
+	}
+
+	bool PerfCounters::WriteRecording(const std::string& filepath)
+	{
+		std::ofstream out(filepath, std::ios::out | std::ios::trunc);
+		if (!out.is_open())
+		{
+			HZ_CORE_ERROR("PerfCounters: could not open '{0}'", filepath);
+			return false;
+		}
+
+		std::string extension = std::filesystem::path(filepath).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+		if (extension == ".json")
+		{
+			out << "{\n  \"frameCount\": " << s_Recording.size() << ",\n  \"frames\": [";
+			for (size_t f = 0; f < s_Recording.size(); f++)
+			{
+				const PerfCounterFrame& frame = s_Recording[f];
+				out << (f ? ",\n" : "\n") << "    { \"frame\": " << frame.FrameIndex << ", \"cpuMs\": " << frame.CpuFrameMs;
+				for (size_t i = 0; i < (size_t)PerfCounter::Count; i++)
+					out << ", \"" << GetCounterName((PerfCounter)i) << "\": " << frame.Values[i];
+				out << " }";
+			}
+			out << "\n  ]\n}\n";
+		}
+		else
+		{
+			out << "frame,cpuMs";
+			for (size_t i = 0; i < (size_t)PerfCounter::Count; i++)
+				out << ',' << GetCounterName((PerfCounter)i);
+			out << '\n';
+			for (const PerfCounterFrame& frame : s_Recording)
+			{
+				out << frame.FrameIndex << ',' << frame.CpuFrameMs;
+				for (size_t i = 0; i < (size_t)PerfCounter::Count; i++)
+					out << ',' << frame.Values[i];
+				out << '\n';
+			}
+		}
+
+		HZ_CORE_INFO("PerfCounters: wrote {0} frames to '{1}'", s_Recording.size(), filepath);
+		return true;
+	}
+
+	void PerfCounters::LogSummary()
+	{
+		if (s_Recording.empty())
+			return;
+
+		double cpuMs = 0.0;
+		double totals[(size_t)PerfCounter::Count] = {};
+		for (const PerfCounterFrame& frame : s_Recording)
+		{
+			cpuMs += frame.CpuFrameMs;
+			for (size_t i = 0; i < (size_t)PerfCounter::Count; i++)
+				totals[i] += (double)frame.Values[i];
+		}
+
+		double frames = (double)s_Recording.size();
+		HZ_CORE_INFO("PerfCounters: {0} frames, avg cpu {1:.3f} ms", s_Recording.size(), cpuMs / frames);
+		for (size_t i = 0; i < (size_t)PerfCounter::Count; i++)
+			HZ_CORE_INFO("  {0:<24} {1:>14.1f} / frame", GetCounterName((PerfCounter)i), totals[i] / frames);
+	}
+
+}
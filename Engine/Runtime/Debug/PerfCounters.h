@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Counters compile to nothing in Dist builds
+#ifndef HZ_PERF_COUNTERS
+	#if defined(HZ_DIST)
+		#define HZ_PERF_COUNTERS 0
+	#else
+		#define HZ_PERF_COUNTERS 1
+	#endif
+#endif
+
+namespace Hazel {
+
+	// Hot path work counted per frame. Keep PerfCounters::GetCounterName in sync.
+	enum class PerfCounter : uint32_t
+	{
+		DrawCalls = 0,
+		Instances,					// sum of instanceCount over all draws
+		PipelineSwitches,			// SetPipelineState with a different pipeline than the bound one
+		DescriptorHeapSwitches,
+		DescriptorsAllocated,		// descriptors, not Allocate calls
+		ConstantBufferBytes,		// bytes written through ConstantBuffer::SetData
+		CommandListsAcquired,
+		MaterialsSynced,			// Material::SyncToRawData calls
+		TransformsUpdated,			// world matrices recomputed by TransformSystem
+		Count
+	};
+
+	struct PerfCounterFrame
+	{
+		uint64_t FrameIndex = 0;
+		float CpuFrameMs = 0.0f;
+		uint64_t Values[(size_t)PerfCounter::Count] = {};
+
+		inline uint64_t Get(PerfCounter counter) const { return Values[(size_t)counter]; }
+	};
+
+	// Per frame hot path counters.
+	//  - every thread increments its own block of counters (relaxed load + store, no RMW, no lock)
+	//  - EndFrame on the main thread sums the per thread deltas into one PerfCounterFrame
+	//  - the last HistorySize frames are kept for the editor overlay; headless runs can also
+	//    record every frame and write them out as CSV or JSON
+	class HAZEL_API PerfCounters
+	{
+	public:
+		static constexpr uint32_t HistorySize = 240;
+
+		static inline void Add(PerfCounter counter, uint64_t value = 1)
+		{
+			ThreadCounters* block = t_ThreadCounters ? t_ThreadCounters : RegisterThread();
+			std::atomic<uint64_t>& slot = block->Values[(size_t)counter];
+			// only the owning thread writes, EndFrame just reads
+			slot.store(slot.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+
+		static const char* GetCounterName(PerfCounter counter);
+
+		// main thread, once per frame after all work of the frame has been recorded
+		static void EndFrame(uint64_t frameIndex, float cpuFrameMs);
+
+		static PerfCounterFrame GetLastFrame();
+		// oldest first, at most HistorySize frames
+		static void GetHistory(std::vector<PerfCounterFrame>& outFrames);
+
+		// keep every frame from now on (reserveFrames avoids regrowth during the run)
+		static void BeginRecording(uint64_t reserveFrames = 0);
+		static void EndRecording();
+		static const std::vector<PerfCounterFrame>& GetRecording() { return s_Recording; }
+
+		// ".json" writes JSON, anything else CSV; returns false if the file can't be opened
+		static bool WriteRecording(const std::string& filepath);
+		// per frame averages of the recording, to the log
+		static void LogSummary();
+	private:
+		struct alignas(64) ThreadCounters
+		{
+			std::atomic<uint64_t> Values[(size_t)PerfCounter::Count] = {};
+			// values at the previous EndFrame, only touched by EndFrame
+			uint64_t Consumed[(size_t)PerfCounter::Count] = {};
+		};
+
+		struct Registry;
+
+		static ThreadCounters* RegisterThread();
+		static Registry& GetRegistry();
+
+		static thread_local ThreadCounters* t_ThreadCounters;
+		static std::vector<PerfCounterFrame> s_Recording;
+	};
+
+}
+
+#if HZ_PERF_COUNTERS
+	#define HZ_PERF_COUNTER_ADD(counter, value) ::Hazel::PerfCounters::Add(::Hazel::PerfCounter::counter, (uint64_t)(value))
+	#define HZ_PERF_COUNTER_INC(counter) ::Hazel::PerfCounters::Add(::Hazel::PerfCounter::counter)
+#else
+	#define HZ_PERF_COUNTER_ADD(counter, value)
+	#define HZ_PERF_COUNTER_INC(counter)
+#endif
@@ -1,10 +1,65 @@
 #include "hzpch.h"
 #include "Culling.h"
+#include "Runtime/Core/Math/SimdMath.h"
 
 namespace Hazel
 {
+	// 每帧复用的 SoA 缓冲，只增不减，稳定后不再分配
+	struct CullingScratch
+	{
+		std::vector<entt::entity> Entities;
+		std::vector<BoundingSphere> LocalBounds;
+		std::vector<glm::mat4> World;
+		std::vector<float> Spheres[4];
+		std::vector<uint32_t> Visible;
+
+		void Reserve(size_t count)
+		{
+			if (World.size() >= count)
+				return;
+			Entities.resize(count);
+			LocalBounds.resize(count);
+			World.resize(count);
+			for (std::vector<float>& component : Spheres)
+				component.resize(count);
+			Visible.resize(count);
+		}
+	};
+
 	RenderNode* Culling::Cull(Camera* cam, Scene* scene)
 	{
 		return nullptr;
 	}
-}
\ No newline at end of file
+
+	void Culling::CullScene(const glm::mat4& viewProjection, Scene* scene, std::vector<entt::entity>& outVisible)
+	{
+		HZ_PROFILE_FUNCTION();
+		Frustum frustum(viewProjection);
+
+		// 先收集成连续数组，再整批算包围球和视锥测试；世界矩阵由 TransformSystem 缓存，这里只拷贝
+		thread_local CullingScratch scratch;
+		auto view = scene->Reg().view<WorldTransformComponent, MeshFilterComponent>();
+		scratch.Reserve(view.size_hint());
+
+		size_t count = 0;
+		for (entt::entity entity : view)
+		{
+			const MeshFilterComponent& meshFilter = view.get<MeshFilterComponent>(entity);
+			if (!meshFilter.mesh)
+				continue;
+
+			scratch.World[count] = view.get<WorldTransformComponent>(entity).World;
+			scratch.LocalBounds[count] = meshFilter.mesh->GetBounds();
+			scratch.Entities[count] = entity;
+			count++;
+		}
+
+		SphereSoA spheres = { scratch.Spheres[0].data(), scratch.Spheres[1].data(), scratch.Spheres[2].data(), scratch.Spheres[3].data() };
+		SimdMath::TransformSpheres(scratch.World.data(), scratch.LocalBounds.data(), spheres, count);
+		size_t visibleCount = SimdMath::CullSpheres(frustum, spheres, count, scratch.Visible.data());
+
+		outVisible.reserve(outVisible.size() + visibleCount);
+		for (size_t i = 0; i < visibleCount; i++)
+			outVisible.push_back(scratch.Entities[scratch.Visible[i]]);
+	}
+}
@@ -2,12 +2,17 @@
 #include "Runtime/Graphics/Camera/Camera.h"
 #include "Runtime/Scene/Scene.h"
 #include "Runtime/Graphics/Renderer/RenderStruct.h"
+#include "Runtime/Core/Math/Bounds.h"
 namespace Hazel 
 {
 	class Culling 
 	{
 	public:
 		static RenderNode* Cull(Camera* cam, Scene* scene);
-	
+
+		// 视锥剔除：带 Transform + MeshFilter 的实体，用 Mesh 的包围球测试
+		// 世界矩阵读 WorldTransformComponent，要在 Scene::OnUpdate 之后调用
+		// 结果追加到 outVisible（调用方负责清空，便于复用容量）
+		static void CullScene(const glm::mat4& viewProjection, Scene* scene, std::vector<entt::entity>& outVisible);
 	};
-}
\ No newline at end of file
+}
@@ -8,6 +8,7 @@ namespace Hazel
 	Material::Material(const Ref<Shader>& shader)
 		: m_Shader(shader)
 	{
+		HZ_MEMORY_TAG(Material);
 		// 自动从着色器反射数据同步属性
 		if (shader)
 			SyncWithShaderReflection();
@@ -64,6 +65,7 @@ namespace Hazel
 
 	Ref<Material> Material::Clone() const
 	{
+		HZ_MEMORY_TAG(Material);
 		Ref<Material> material = CreateRef<Material>(m_Shader);
 		material->m_Properties = m_Properties;
 		return material;
@@ -76,35 +78,40 @@ namespace Hazel
 
 	void Material::SyncToRawData()
 	{
+		HZ_MEMORY_TAG(Material);
 		if (!m_Shader)
 			return;
+		HZ_PERF_COUNTER_INC(MaterialsSynced);
 
 		// 获取寄存器块信息
-		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlocks();
+		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlockRefs();
 		
-		for (const auto& block : registerBlocks)
+		for (const ShaderRegisterBlock* blockRef : registerBlocks)
 		{
+			const ShaderRegisterBlock& block = *blockRef;
 			// 计算块键值
 			uint64_t blockKey = CalculateBlockKey(block.BindPoint, block.BindSpace);
 			
 			// 检查块是否存在
-			if (m_PropertyBlocks.find(blockKey) == m_PropertyBlocks.end())
+			auto blockIt = m_PropertyBlocks.find(blockKey);
+			if (blockIt == m_PropertyBlocks.end())
 				continue;
 			
-			auto& propertyBlock = m_PropertyBlocks[blockKey];
+			auto& propertyBlock = blockIt->second;
 			
 			// 遍历块中的所有参数
 			for (const auto& param : block.Parameters)
 			{
 				// 检查属性是否存在
-				if (!HasProperty(param.Name))
+				auto propertyIt = m_Properties.find(param.Name);
+				if (propertyIt == m_Properties.end())
 					continue;
 				
 				// 获取偏移量
 				uint32_t offset = param.Offset / sizeof(float);
 				
 				// 根据属性类型复制数据
-				const auto& property = m_Properties[param.Name];
+				const auto& property = propertyIt->second;
 				
 				switch (property.GetType())
 				{
@@ -167,7 +174,7 @@ namespace Hazel
 					break;
 				}
 				default:
-					HZ_CORE_WARN("Material: Property type {0} not supported for raw data sync", (int)property.GetType());
+					HZ_CORE_WARN_RATE_LIMITED(10, "Material: Property type {0} not supported for raw data sync", (int)property.GetType());
 					break;
 				}
 			}
@@ -204,11 +211,12 @@ namespace Hazel
 		m_Properties.clear();
 
 		// 从着色器反射数据中获取寄存器块信息
-		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlocks();
+		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlockRefs();
 		
 		// 创建材质需要的所有属性
-		for (const auto& block : registerBlocks)
+		for (const ShaderRegisterBlock* blockRef : registerBlocks)
 		{
+			const ShaderRegisterBlock& block = *blockRef;
 			for (const auto& param : block.Parameters)
 			{
 				// 根据反射数据创建属性
@@ -227,7 +235,6 @@ namespace Hazel
 			return;
 
 		// 尝试从Shader反射数据中找到此属性的更详细信息
-		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlocks();
 		ShaderDataType dataType = ShaderDataType::None;
 		
 		// 如果找不到详细类型信息，则根据大小推断类型
@@ -261,7 +268,7 @@ namespace Hazel
 			Set(name, glm::mat4(1.0f)); // 初始化为单位矩阵
 			break;
 		default:
-			HZ_CORE_WARN("Material: Cannot create property '{0}', type {1} is not supported.", name, (int)dataType);
+			HZ_CORE_WARN_RATE_LIMITED(10, "Material: Cannot create property '{0}', type {1} is not supported.", name, (int)dataType);
 			break;
 		}
 	}
@@ -275,10 +282,11 @@ namespace Hazel
 		m_PropertyBlocks.clear();
 
 		// 获取寄存器块信息
-		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlocks();
+		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlockRefs();
 		
-		for (const auto& block : registerBlocks)
+		for (const ShaderRegisterBlock* blockRef : registerBlocks)
 		{
+			const ShaderRegisterBlock& block = *blockRef;
 			// 计算块键值
 			uint64_t blockKey = CalculateBlockKey(block.BindPoint, block.BindSpace);
 			
@@ -300,7 +308,7 @@ namespace Hazel
 			// 存储属性块
 			m_PropertyBlocks[blockKey] = propertyBlock;
 			
-			HZ_CORE_INFO("Material: Created property block for register b{0}, space {1}, size {2} bytes", 
+			HZ_CORE_TRACE("Material: Created property block for register b{0}, space {1}, size {2} bytes", 
 				block.BindPoint, block.BindSpace, block.Size);
 		}
 	}
@@ -344,7 +352,7 @@ namespace Hazel
 		case 64:
 			return ShaderDataType::Mat4;
 		default:
-			HZ_CORE_WARN("Material: Cannot infer type from size {0}", size);
+			HZ_CORE_WARN_RATE_LIMITED(10, "Material: Cannot infer type from size {0}", size);
 			return ShaderDataType::None;
 		}
 	}
@@ -388,10 +396,11 @@ namespace Hazel
 	{
 		// Find parameter size from shader reflection
 		uint32_t paramSize = 0;
-		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlocks();
+		const auto registerBlocks = m_Shader->GetReflection()->GetAllRegisterBlockRefs();
 		
-		for (const auto& block : registerBlocks)
+		for (const ShaderRegisterBlock* blockRef : registerBlocks)
 		{
+			const ShaderRegisterBlock& block = *blockRef;
 			for (const auto& param : block.Parameters)
 			{
 				if (param.Name == paramName)
@@ -416,6 +425,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<float>(const std::string& name, const float& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -423,6 +433,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<glm::vec2>(const std::string& name, const glm::vec2& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -430,6 +441,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<glm::vec3>(const std::string& name, const glm::vec3& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -437,6 +449,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<glm::vec4>(const std::string& name, const glm::vec4& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -444,6 +457,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<int>(const std::string& name, const int& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -451,6 +465,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<bool>(const std::string& name, const bool& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -458,6 +473,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<Ref<Texture2D>>(const std::string& name, const Ref<Texture2D>& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
@@ -465,6 +481,7 @@ namespace Hazel
 	template<> 
 	void Material::Set<glm::mat4>(const std::string& name, const glm::mat4& value)
 	{
+		HZ_MEMORY_TAG(Material);
 		m_Properties[name] = MaterialProperty(value);
 		MarkPropertyDirty(name);
 	}
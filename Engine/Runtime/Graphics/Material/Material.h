@@ -3,7 +3,7 @@
 #include "hzpch.h"
 #include "MaterialProperty.h"
 #include "Runtime/Graphics/Shader/Shader.h"
-#include <unordered_map>
+#include "Runtime/Core/Containers/FlatHashMap.h"
 
 namespace Hazel 
 {
@@ -43,10 +43,10 @@ namespace Hazel
 
 	protected:
 		Ref<Shader> m_Shader;
-		std::unordered_map<std::string, MaterialProperty> m_Properties;
+		FlatHashMap<std::string, MaterialProperty> m_Properties;
 		
 		// 常量缓冲区块集合，按bindPoint组织
-		std::unordered_map<uint64_t, MaterialPropertyBlock> m_PropertyBlocks;
+		FlatHashMap<uint64_t, MaterialPropertyBlock> m_PropertyBlocks;
 		
 		// 材质的唯一标识符（基于文件路径的哈希值）
 		std::string m_MaterialID;
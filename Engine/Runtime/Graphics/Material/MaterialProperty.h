@@ -4,6 +4,7 @@
 #include <variant>
 #include <glm/glm.hpp>
 #include "Runtime/Graphics/Texture/Texture.h"
+#include "Runtime/Core/Containers/FlatHashMap.h"
 
 namespace Hazel 
 {
@@ -71,7 +72,7 @@ namespace Hazel
 		bool Dirty;                        // 脏标记，表示数据需要更新
         
 		// 记录属性名称到原始数据偏移量的映射
-		std::unordered_map<std::string, uint32_t> PropertyOffsets;
+		FlatHashMap<std::string, uint32_t> PropertyOffsets;
 	};
 
 	// MaterialProperty模板特化声明
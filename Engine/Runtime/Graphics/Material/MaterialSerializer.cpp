@@ -3,6 +3,7 @@
 #include "Material.h"
 #include "MaterialProperty.h"
 #include "Runtime/Graphics/Shader/Shader.h"
+#include "Runtime/Graphics/Shader/ShaderLibrary.h"
 #include "Runtime/Graphics/Texture/Texture.h"
 #include <fstream>
 #include <sstream>
@@ -10,10 +11,20 @@
 
 namespace Hazel 
 {
-	void MaterialSerializer::SerializeToJSON(const Ref<Material>& material, const std::string& filepath)
+	static FILE* OpenFile(const std::string& filepath, const char* mode)
 	{
+#ifdef HZ_PLATFORM_WINDOWS
 		FILE* file = nullptr;
-		fopen_s(&file, filepath.c_str(), "w");
+		fopen_s(&file, filepath.c_str(), mode);
+		return file;
+#else
+		return std::fopen(filepath.c_str(), mode);
+#endif
+	}
+
+	void MaterialSerializer::SerializeToJSON(const Ref<Material>& material, const std::string& filepath)
+	{
+		FILE* file = OpenFile(filepath, "w");
 		if (!file)
 		{
 			HZ_CORE_ERROR("MaterialSerializer: Cannot open file {0} for writing", filepath);
@@ -128,8 +139,7 @@ namespace Hazel
 	Ref<Material> MaterialSerializer::DeserializeFromJSON(const std::string& filepath)
 	{
 		// 读取整个文件内容
-		FILE* file = nullptr;
-		fopen_s(&file, filepath.c_str(), "rb");
+		FILE* file = OpenFile(filepath, "rb");
 		if (!file)
 		{
 			HZ_CORE_ERROR("MaterialSerializer: Cannot open file {0}", filepath);
@@ -205,7 +215,8 @@ namespace Hazel
 		HZ_CORE_TRACE("MaterialSerializer: Loading shader {0} for material", shaderPath);
 
 		// 加载着色器
-		Ref<Shader> shader = Shader::Create(shaderPath);
+		// 走全局缓存，同一个着色器被多个材质引用时只编译一次
+		Ref<Shader> shader = ShaderLibrary::GetGlobal().LoadCached(shaderPath);
 		if (!shader)
 		{
 			HZ_CORE_ERROR("MaterialSerializer: Failed to load shader {0}", shaderPath);
@@ -15,6 +15,15 @@ namespace Hazel
 
 	bool Mesh::LoadMesh(const std::string& path)
 	{
+		if (!ImportMesh(path))
+			return false;
+		UploadMesh();
+		return true;
+	}
+
+	bool Mesh::ImportMesh(const std::string& path)
+	{
+		HZ_MEMORY_TAG(Mesh);
 		Assimp::Importer import;
 		const aiScene* scene = import.ReadFile(path, aiProcess_Triangulate | aiProcess_JoinIdenticalVertices);
 
@@ -25,13 +34,48 @@ namespace Hazel
 		}
 		
 		processNode(scene->mRootNode, scene);
+		CalculateBounds();
 
-		// todo: accroding to meta file, fill vertex array
-		std::string metaFilePath = path.substr(0, path.find_last_of('.')) + ".meta";
-		FillVertexArray(metaFilePath);
+		m_MetaFilePath = path.substr(0, path.find_last_of('.')) + ".meta";
 		return true;
 	}
 
+	void Mesh::UploadMesh()
+	{
+		HZ_MEMORY_TAG(Mesh);
+		// todo: accroding to meta file, fill vertex array
+		FillVertexArray(m_MetaFilePath);
+	}
+
+	void Mesh::CalculateBounds()
+	{
+		if (positionData.size() < 3)
+		{
+			m_Bounds = BoundingSphere{};
+			return;
+		}
+
+		// 包围盒中心 + 最远顶点距离，不是最小包围球，但足够剔除使用
+		glm::vec3 minPos(positionData[0], positionData[1], positionData[2]);
+		glm::vec3 maxPos = minPos;
+		for (size_t i = 0; i + 2 < positionData.size(); i += 3)
+		{
+			glm::vec3 p(positionData[i], positionData[i + 1], positionData[i + 2]);
+			minPos = glm::min(minPos, p);
+			maxPos = glm::max(maxPos, p);
+		}
+
+		glm::vec3 center = (minPos + maxPos) * 0.5f;
+		float radiusSq = 0.0f;
+		for (size_t i = 0; i + 2 < positionData.size(); i += 3)
+		{
+			glm::vec3 d = glm::vec3(positionData[i], positionData[i + 1], positionData[i + 2]) - center;
+			radiusSq = std::max(radiusSq, glm::dot(d, d));
+		}
+		m_Bounds.Center = center;
+		m_Bounds.Radius = std::sqrt(radiusSq);
+	}
+
 	void Mesh::processNode(aiNode* node, const aiScene* scene)
 	{
 		// ??????????е?????????е????
@@ -56,7 +100,7 @@ namespace Hazel
 		// ??????????????????? ??????????????????????????????? needposition??neednormal?????????
 		// ??????????????????????????vertexdata array?? ???????????????Щ?????
 		// ???????????????У? ??д?????????????????position normal??color???????
-		HZ_CORE_INFO("vertices size :{0}", aiMesh->mNumVertices);
+		HZ_CORE_TRACE("vertices size :{0}", aiMesh->mNumVertices);
 		for (unsigned int i = 0; i < aiMesh->mNumVertices; i++)
 		{
 			if (aiMesh->mVertices)
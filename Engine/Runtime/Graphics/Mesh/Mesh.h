@@ -5,6 +5,7 @@
 #include "Runtime/Graphics/Texture/Texture.h"
 #include "Runtime/Graphics/Shader/Shader.h"
 #include "Runtime/Graphics/RHI/Core/VertexArray.h"
+#include "Runtime/Core/Math/Bounds.h"
 #include <assimp/Importer.hpp>      // C++ importer interface
 #include <assimp/scene.h>           // Output data structure
 #include <assimp/postprocess.h>     // Post processing flags
@@ -21,9 +22,22 @@ namespace Hazel
         };
 
         static Ref<Mesh> Create();
+        // ImportMesh + UploadMesh
         bool LoadMesh(const std::string& path);
+        // 只做 assimp 导入和顶点数据整理，不碰 RHI，可以在工作线程执行
+        bool ImportMesh(const std::string& path);
+        // 创建顶点/索引缓冲，需要在主线程（会录制上传命令）
+        void UploadMesh();
         Ref<VertexArray> meshData;
+
+        // 局部空间包围球，LoadMesh 时由顶点位置计算，剔除用
+        inline const BoundingSphere& GetBounds() const { return m_Bounds; }
+        inline void SetBounds(const BoundingSphere& bounds) { m_Bounds = bounds; }
     private:
+        void CalculateBounds();
+
+        BoundingSphere m_Bounds;
+        std::string m_MetaFilePath;
         bool needPosition = true;
         bool needNormal = true;
         bool needTangent = true;
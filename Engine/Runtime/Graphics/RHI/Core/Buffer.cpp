@@ -2,51 +2,78 @@
 #include "Buffer.h"
 
 #include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 
+#ifdef HZ_PLATFORM_WINDOWS
 #include "Platform/OpenGL/OpenGLBuffer.h"
 #include "Platform/D3D12/D3D12Buffer.h"
 #include "Platform/D3D12/D3D12ConstantBuffer.h"
+#endif
+#include "Platform/Null/NullBuffer.h"
 namespace Hazel {
 	Ref<VertexBuffer> VertexBuffer::Create(float* vertices, uint32_t size, uint32_t stride)
 	{
+		HZ_MEMORY_TAG(RHI);
+#ifdef HZ_RHI_STATIC_DISPATCH
+		return std::make_shared<BackendVertexBuffer>(vertices, size, stride);
+#else
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported"); break;
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::OpenGL: return std::make_shared<OpenGLVertexBuffer>(vertices, size, stride); break;
 		case RenderAPI::API::DirectX12: return std::make_shared<D3D12VertexBuffer>(vertices, size, stride); break;
+#endif
+		case RenderAPI::API::Null: return std::make_shared<NullVertexBuffer>(vertices, size, stride); break;
 
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
+#endif
 	}
 
 	
 	Ref<IndexBuffer> IndexBuffer::Create(uint16_t* indices, uint32_t size)
 	{
+		HZ_MEMORY_TAG(RHI);
+#ifdef HZ_RHI_STATIC_DISPATCH
+		return std::make_shared<BackendIndexBuffer>(indices, size);
+#else
 		switch (RenderAPI::GetAPI())
 		{
 			case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 			case RenderAPI::API::DirectX12: return std::make_shared<D3D12IndexBuffer>(indices, size);
 			case RenderAPI::API::OpenGL: return std::make_shared<OpenGLIndexBuffer>(indices, size);
+#endif
+			case RenderAPI::API::Null: return std::make_shared<NullIndexBuffer>(indices, size);
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
+#endif
 	}	
 
 	// ����һ��ConstantBuffer, ��ʵֻ��Ҫ����һ��T���������T��size�Ϳ����ˣ�Ȼ���ڲ���һ��cpu�˵�buffer��
 
 	Ref<ConstantBuffer> ConstantBuffer::Create(uint32_t bufferSize)
 	{
+		HZ_MEMORY_TAG(RHI);
 		auto elementSize = 0;
-		
+#ifdef HZ_RHI_STATIC_DISPATCH
+		return std::make_shared<BackendConstantBuffer>(bufferSize);
+#else
 		switch (RenderAPI::GetAPI())
 		{
+#ifdef HZ_PLATFORM_WINDOWS
 			case RenderAPI::API::DirectX12: return std::make_shared<D3D12ConstantBuffer>(bufferSize); break;
+#endif
+			case RenderAPI::API::Null: return std::make_shared<NullConstantBuffer>(bufferSize); break;
 			default: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
 			//case RenderAPI::API::OpenGL: return new OpenGLIndexBuffer(size);
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
+#endif
 	}
 
 }
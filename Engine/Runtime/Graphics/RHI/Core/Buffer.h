@@ -1,5 +1,6 @@
 #pragma once
 #include "hzpch.h"
+#include "Runtime/Graphics/RHI/Core/NativeResourceHandle.h"
 
 namespace Hazel {
 
@@ -184,30 +185,22 @@ namespace Hazel {
 
 		template<typename T>
 		T getCpuHandle() const {
-			if constexpr (std::is_same_v<T, uint32_t> || std::is_same_v<T, CD3DX12_CPU_DESCRIPTOR_HANDLE>) {
-				return std::get<T>(m_CpuHandle);  // ���Ի�ȡ T ���͵�ֵ
-			}
-			else {
-				static_assert(false, "T must be either uint32_t or CD3DX12_CPU_DESCRIPTOR_HANDLE");
-			}
+			static_assert(IsNativeHandleAlternative<T, NativeCpuHandle>::value, "T must be either uint32_t or CD3DX12_CPU_DESCRIPTOR_HANDLE");
+			return std::get<T>(m_CpuHandle);  // ���Ի�ȡ T ���͵�ֵ
 		}
 
 		template<typename T>
 		T getResource() const {
-			if constexpr (std::is_same_v<T, uint32_t> || std::is_same_v<T, Microsoft::WRL::ComPtr<ID3D12Resource>>) {
-				return std::get<T>(m_BufferResource);  // ���Ի�ȡ T ���͵�ֵ
-			}
-			else {
-				static_assert(false, "T must be either uint32_t or ID3D12Resource");
-			}
+			static_assert(IsNativeHandleAlternative<T, NativeResourceHandle>::value, "T must be either uint32_t or ID3D12Resource");
+			return std::get<T>(m_BufferResource);  // ���Ի�ȡ T ���͵�ֵ
 		}
 
 		virtual void* GetNativeResource() const = 0;
 
 	protected:
 
-		std::variant<uint32_t, CD3DX12_CPU_DESCRIPTOR_HANDLE> m_CpuHandle;
-		std::variant<uint32_t, Microsoft::WRL::ComPtr<ID3D12Resource>> m_BufferResource;
+		NativeCpuHandle m_CpuHandle;
+		NativeResourceHandle m_BufferResource;
 		
 		boost::uuids::uuid m_UUID;
 		uint32_t m_BufferSize;
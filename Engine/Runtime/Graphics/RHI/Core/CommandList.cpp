@@ -5,6 +5,7 @@
 #ifdef RENDER_API_DIRECTX12
 #include "Platform/D3D12/D3D12CommandList.h"
 #endif
+#include "Platform/Null/NullCommandList.h"
 
 namespace Hazel
 {
@@ -19,8 +20,12 @@ namespace Hazel
 			case RenderAPI::API::None: 
 				HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
 				return nullptr;
+#ifdef RENDER_API_DIRECTX12
 			case RenderAPI::API::DirectX12: 
 				return CreateRef<D3D12CommandList>(type);
+#endif
+			case RenderAPI::API::Null: 
+				return CreateRef<NullCommandList>(type);
 		}
 		HZ_CORE_ASSERT(false, "Unknown API...");
 		return nullptr;
@@ -3,6 +3,7 @@
 #include "Runtime/Graphics/Utility/Color.h"
 #include "Runtime/Graphics/Texture/TextureStruct.h"
 #include "Runtime/Graphics/Texture/TextureBuffer.h"
+#include "Runtime/Graphics/RHI/Core/VertexArray.h"
 #include <atomic>
 #include <functional>
 
@@ -46,6 +47,11 @@ namespace Hazel
 		                               const TextureRenderUsage& fromFormat, 
 		                               const TextureRenderUsage& toFormat) = 0;
 		
+		// 绘制操作
+		virtual void SetVertexArray(const Ref<VertexArray>& vertexArray) = 0;
+		virtual void DrawIndexed(uint32_t indexCount, uint32_t instanceCount = 1, uint32_t startIndex = 0, int32_t baseVertex = 0) = 0;
+		virtual void Draw(uint32_t vertexCount, uint32_t instanceCount = 1, uint32_t startVertex = 0) = 0;
+		
 		// 状态管理
 		ExecutionState GetState() const { return m_state.load(); }
 		CommandListType GetType() const { return m_type; }
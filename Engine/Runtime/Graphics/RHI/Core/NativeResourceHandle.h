@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <variant>
+
+#ifdef HZ_PLATFORM_WINDOWS
+#include "Platform/D3D12/d3dx12.h"
+#include <wrl.h>
+#endif
+
+namespace Hazel {
+
+	// Buffer / TextureBuffer 里保存的后端原生句柄
+	// OpenGL 用 uint32_t，D3D12 用 descriptor handle / ID3D12Resource
+	// headless（Linux）没有图形后端，只保留 uint32_t
+#ifdef HZ_PLATFORM_WINDOWS
+	using NativeCpuHandle = std::variant<uint32_t, CD3DX12_CPU_DESCRIPTOR_HANDLE>;
+	using NativeResourceHandle = std::variant<uint32_t, Microsoft::WRL::ComPtr<ID3D12Resource>>;
+#else
+	using NativeCpuHandle = std::variant<uint32_t>;
+	using NativeResourceHandle = std::variant<uint32_t>;
+#endif
+
+	template<typename T, typename Variant>
+	struct IsNativeHandleAlternative : std::false_type {};
+
+	template<typename T, typename ... Types>
+	struct IsNativeHandleAlternative<T, std::variant<Types...>> : std::bool_constant<(std::is_same_v<T, Types> || ...)> {};
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RenderAPIManager.h"
+#include "Runtime/Graphics/RHI/Core/Buffer.h"
+#include "Runtime/Graphics/RHI/Core/CommandList.h"
+#include "Runtime/Graphics/RHI/Core/VertexArray.h"
+
+// 静态分发构建（premake --rhi-static=native|null，定义 HZ_RHI_STATIC_DISPATCH）
+// - 整个程序只使用一个后端：native 在 Windows 上是 D3D12、Linux 上是 Null；null 强制 Null，
+//   用来在有 GPU 的机器上单独测前端的 CPU 开销
+// - 工厂函数（VertexBuffer::Create、ICommandListManager::Get ...）不再按 RenderAPI::GetAPI() 分支，
+//   直接创建下面别名对应的类型；这些类型都是 final，通过它们调用虚函数时编译器生成直接调用
+// - 热路径用 RHICast 拿到具体类型：静态分发下是 static_cast（开启断言时用 dynamic_cast 校验），
+//   默认构建下仍然是 dynamic_cast，同一份代码两种模式都能编译
+#ifdef HZ_RHI_STATIC_DISPATCH
+	#if defined(HZ_RHI_STATIC_NULL) || !defined(RENDER_API_DIRECTX12)
+		#define HZ_RHI_STATIC_BACKEND_NULL
+	#else
+		#define HZ_RHI_STATIC_BACKEND_D3D12
+	#endif
+#endif
+
+#if defined(HZ_RHI_STATIC_BACKEND_D3D12)
+#include "Platform/D3D12/D3D12RenderAPIManager.h"
+#include "Platform/D3D12/D3D12Buffer.h"
+#include "Platform/D3D12/D3D12ConstantBuffer.h"
+#include "Platform/D3D12/D3D12VertexArray.h"
+#include "Platform/D3D12/D3D12CommandList.h"
+#include "Platform/D3D12/D3D12CommandListManager.h"
+#include "Platform/D3D12/D3D12GfxViewManager.h"
+#include "Platform/D3D12/D3D12PipelineStateManager.h"
+#elif defined(HZ_RHI_STATIC_BACKEND_NULL)
+#include "Platform/Null/NullRenderAPIManager.h"
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Null/NullVertexArray.h"
+#include "Platform/Null/NullCommandList.h"
+#include "Platform/Null/NullCommandListManager.h"
+#include "Platform/Null/NullGfxViewManager.h"
+#include "Platform/Null/NullPipelineStateManager.h"
+#endif
+
+namespace Hazel
+{
+#if defined(HZ_RHI_STATIC_BACKEND_D3D12)
+	static constexpr RenderAPI::API s_BackendAPI = RenderAPI::API::DirectX12;
+	using BackendRenderAPIManager = D3D12RenderAPIManager;
+	using BackendVertexBuffer = D3D12VertexBuffer;
+	using BackendIndexBuffer = D3D12IndexBuffer;
+	using BackendConstantBuffer = D3D12ConstantBuffer;
+	using BackendVertexArray = D3D12VertexArray;
+	using BackendCommandList = D3D12CommandList;
+	using BackendCommandListManager = D3D12CommandListManager;
+	using BackendGfxViewManager = D3D12GfxViewManager;
+	using BackendPipelineStateManager = D3D12PipelineStateManager;
+#elif defined(HZ_RHI_STATIC_BACKEND_NULL)
+	static constexpr RenderAPI::API s_BackendAPI = RenderAPI::API::Null;
+	using BackendRenderAPIManager = NullRenderAPIManager;
+	using BackendVertexBuffer = NullVertexBuffer;
+	using BackendIndexBuffer = NullIndexBuffer;
+	using BackendConstantBuffer = NullConstantBuffer;
+	using BackendVertexArray = NullVertexArray;
+	using BackendCommandList = NullCommandList;
+	using BackendCommandListManager = NullCommandListManager;
+	using BackendGfxViewManager = NullGfxViewManager;
+	using BackendPipelineStateManager = NullPipelineStateManager;
+#endif
+
+	// 接口指针转成后端的具体类型，类型不符时默认构建返回 nullptr
+	template<typename T, typename Base>
+	inline T* RHICast(Base* object)
+	{
+#ifdef HZ_RHI_STATIC_DISPATCH
+		HZ_CORE_ASSERT(!object || dynamic_cast<T*>(object), "RHICast: object does not belong to the compiled-in backend");
+		return static_cast<T*>(object);
+#else
+		return dynamic_cast<T*>(object);
+#endif
+	}
+
+	template<typename T, typename Base>
+	inline T* RHICast(const Ref<Base>& object)
+	{
+		return RHICast<T>(object.get());
+	}
+}
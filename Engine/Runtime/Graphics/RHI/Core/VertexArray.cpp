@@ -2,22 +2,33 @@
 #include "VertexArray.h"
 
 #include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
+#ifdef HZ_PLATFORM_WINDOWS
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 #include "Platform/D3D12/D3D12VertexArray.h"
+#endif
+#include "Platform/Null/NullVertexArray.h"
 
 namespace Hazel {
 
 
 	Ref<VertexArray> VertexArray::Create()
 	{
+#ifdef HZ_RHI_STATIC_DISPATCH
+		return std::make_shared<BackendVertexArray>();
+#else
 		switch (RenderAPI::GetAPI())
 		{
 			case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 			case RenderAPI::API::OpenGL: return std::make_shared<OpenGLVertexArray>();
 			case RenderAPI::API::DirectX12: return std::make_shared<D3D12VertexArray>();
+#endif
+			case RenderAPI::API::Null: return std::make_shared<NullVertexArray>();
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
+#endif
 	}
 
 
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Runtime/Core/Containers/SmallVector.h"
+#include <algorithm>
+#include <cstdint>
+
+namespace Hazel {
+
+    // 描述符空闲块表，D3D12 和 Null 的常驻分配器共用
+    // 按块大小升序排在一段连续内存里（同样大小先释放的在前），
+    // 分配取第一个足够大的块，剩余部分放回，行为和原来的 std::multimap<count, offset> 一致
+    class DescriptorFreeList {
+    public:
+        // 找到足够大的块时返回 true，outOffset 为分配到的起始偏移
+        bool Allocate(uint32_t count, uint32_t& outOffset) {
+            auto it = std::lower_bound(m_Blocks.begin(), m_Blocks.end(), count,
+                [](const Block& block, uint32_t value) { return block.Count < value; });
+            if (it == m_Blocks.end()) {
+                return false;
+            }
+
+            Block block = *it;
+            m_Blocks.erase(it);
+            outOffset = block.Offset;
+            if (block.Count > count) {
+                Free(block.Offset + count, block.Count - count);
+            }
+            return true;
+        }
+
+        void Free(uint32_t offset, uint32_t count) {
+            auto it = std::upper_bound(m_Blocks.begin(), m_Blocks.end(), count,
+                [](uint32_t value, const Block& block) { return value < block.Count; });
+            m_Blocks.insert(it, Block{ count, offset });
+        }
+
+        void Clear() { m_Blocks.clear(); }
+        size_t GetBlockCount() const { return m_Blocks.size(); }
+
+    private:
+        struct Block {
+            uint32_t Count;
+            uint32_t Offset;
+        };
+
+        SmallVector<Block, 16> m_Blocks;
+    };
+
+} // namespace Hazel
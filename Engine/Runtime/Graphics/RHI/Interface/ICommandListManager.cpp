@@ -1,5 +1,8 @@
 #include "hzpch.h"
 #include "ICommandListManager.h"
+#include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
+#include "Platform/Null/NullCommandListManager.h"
 
 #ifdef RENDER_API_DIRECTX12
 #include "Platform/D3D12/D3D12CommandListManager.h"
@@ -11,10 +14,22 @@ namespace Hazel {
 
     ICommandListManager& ICommandListManager::Get() {
         if (!s_Instance) {
-#ifdef RENDER_API_DIRECTX12
-            s_Instance = std::make_unique<D3D12CommandListManager>();
+#ifdef HZ_RHI_STATIC_DISPATCH
+            s_Instance = std::make_unique<BackendCommandListManager>();
 #else
-            HZ_CORE_ASSERT(false, "No CommandListManager implementation available for current API");
+            switch (RenderAPI::GetAPI()) {
+#ifdef RENDER_API_DIRECTX12
+                case RenderAPI::API::DirectX12:
+                    s_Instance = std::make_unique<D3D12CommandListManager>();
+                    break;
+#endif
+                case RenderAPI::API::Null:
+                    s_Instance = std::make_unique<NullCommandListManager>();
+                    break;
+                default:
+                    HZ_CORE_ASSERT(false, "No CommandListManager implementation available for current API");
+                    break;
+            }
 #endif
             s_Instance->Initialize();
         }
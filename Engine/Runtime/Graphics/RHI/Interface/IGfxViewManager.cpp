@@ -1,5 +1,8 @@
 #include "hzpch.h"
 #include "IGfxViewManager.h"
+#include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
+#include "Platform/Null/NullGfxViewManager.h"
 
 #ifdef RENDER_API_DIRECTX12
 #include "Platform/D3D12/D3D12GfxViewManager.h"
@@ -16,14 +19,24 @@ namespace Hazel {
         std::lock_guard<std::mutex> lock(s_Mutex);
         
         if (!s_Instance) {
+#ifdef HZ_RHI_STATIC_DISPATCH
+            s_Instance = std::make_unique<BackendGfxViewManager>();
+#else
             // Create the appropriate implementation based on the current render API
+            switch (RenderAPI::GetAPI()) {
 #ifdef RENDER_API_DIRECTX12
-            s_Instance = std::make_unique<D3D12GfxViewManager>();
-#elif RENDER_API_OPENGL
-            // TODO: Create OpenGL implementation
-            HZ_CORE_ASSERT(false, "OpenGL GfxViewManager not implemented yet");
-#else
-            HZ_CORE_ASSERT(false, "Unknown render API");
+                case RenderAPI::API::DirectX12:
+                    s_Instance = std::make_unique<D3D12GfxViewManager>();
+                    break;
+#endif
+                case RenderAPI::API::Null:
+                    s_Instance = std::make_unique<NullGfxViewManager>();
+                    break;
+                default:
+                    // TODO: Create OpenGL implementation
+                    HZ_CORE_ASSERT(false, "No GfxViewManager implementation available for current API");
+                    break;
+            }
 #endif
             
             // Initialize the instance
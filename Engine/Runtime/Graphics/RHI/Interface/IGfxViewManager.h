@@ -8,10 +8,34 @@
 #include <boost/uuid/uuid.hpp>
 #include "Runtime/Graphics/Texture/TextureBuffer.h"
 #include "Runtime/Graphics/RHI/Core/Buffer.h"
+#include "Runtime/Core/Containers/SmallVector.h"
 
 
 namespace Hazel {
 
+    // 单个资源的视图缓存。一个资源一般只有 1~2 种视图，内联存储 + 线性查找，不为每种视图单独分配节点
+    struct ResourceViews {
+        SmallVector<std::pair<DescriptorType, DescriptorAllocation>, 2> Views;
+
+        DescriptorAllocation Find(DescriptorType type) const {
+            for (const auto& [viewType, allocation] : Views) {
+                if (viewType == type)
+                    return allocation;
+            }
+            return DescriptorAllocation{};
+        }
+
+        void Set(DescriptorType type, const DescriptorAllocation& allocation) {
+            for (auto& [viewType, existing] : Views) {
+                if (viewType == type) {
+                    existing = allocation;
+                    return;
+                }
+            }
+            Views.emplace_back(type, allocation);
+        }
+    };
+
     class IGfxViewManager {
     public:
         virtual ~IGfxViewManager() = default;
@@ -1,5 +1,9 @@
 #include "hzpch.h"
 #include "IPipelineStateManager.h"
+#include "Runtime/Graphics/RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
+#include "Runtime/Core/Threading/TimeSlicedScheduler.h"
+#include "Platform/Null/NullPipelineStateManager.h"
 
 #ifdef RENDER_API_DIRECTX12
 #include "Platform/D3D12/D3D12PipelineStateManager.h"
@@ -16,14 +20,24 @@ namespace Hazel {
         std::lock_guard<std::mutex> lock(s_Mutex);
         
         if (!s_Instance) {
+#ifdef HZ_RHI_STATIC_DISPATCH
+            s_Instance = std::make_unique<BackendPipelineStateManager>();
+#else
             // Create the appropriate implementation based on the current render API
+            switch (RenderAPI::GetAPI()) {
 #ifdef RENDER_API_DIRECTX12
-            s_Instance = std::make_unique<D3D12PipelineStateManager>();
-#elif RENDER_API_OPENGL
-            // TODO: Create OpenGL implementation
-            HZ_CORE_ASSERT(false, "OpenGL PipelineStateManager not implemented yet");
-#else
-            HZ_CORE_ASSERT(false, "Unknown render API");
+                case RenderAPI::API::DirectX12:
+                    s_Instance = std::make_unique<D3D12PipelineStateManager>();
+                    break;
+#endif
+                case RenderAPI::API::Null:
+                    s_Instance = std::make_unique<NullPipelineStateManager>();
+                    break;
+                default:
+                    // TODO: Create OpenGL implementation
+                    HZ_CORE_ASSERT(false, "No PipelineStateManager implementation available for current API");
+                    break;
+            }
 #endif
         }
         
@@ -39,4 +53,86 @@ namespace Hazel {
         }
     }
 
-} // namespace Hazel 
\ No newline at end of file
+    bool IPipelineStateManager::CollectExpiredStep(size_t maxBuckets) {
+        return SweepBuckets(m_PipelineCache, m_SweepCursor, maxBuckets,
+            [](const auto& entry) { return entry.second.expired(); });
+    }
+
+    uint64_t IPipelineStateManager::HashPipelineDesc(const GraphicsPipelineDesc& desc) const
+    {
+        // 使用std::hash组合各个组件的哈希值
+        size_t hash = 0;
+        
+        // 哈希shader指针（假设同一个shader对象表示同一个shader）
+        hash ^= std::hash<void*>{}(desc.shader.get()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        // 哈希光栅化状态
+        hash ^= HashRasterizerState(desc.rasterizerState) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        // 哈希混合状态
+        hash ^= HashBlendState(desc.blendState) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        // 哈希深度模板状态
+        hash ^= HashDepthStencilState(desc.depthStencilState) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        // 哈希图元拓扑
+        hash ^= std::hash<int>{}(static_cast<int>(desc.primitiveTopology)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        // 哈希渲染目标格式
+        hash ^= std::hash<int>{}(static_cast<int>(desc.colorFormat)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<int>{}(static_cast<int>(desc.depthStencilFormat)) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        // 哈希采样设置
+        hash ^= std::hash<uint32_t>{}(desc.sampleCount) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<uint32_t>{}(desc.sampleQuality) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        
+        return hash;
+    }
+
+    size_t IPipelineStateManager::HashRasterizerState(const RasterizerStateDesc& desc)
+    {
+        size_t hash = 0;
+        hash ^= std::hash<int>{}(static_cast<int>(desc.fillMode));
+        hash ^= std::hash<int>{}(static_cast<int>(desc.cullMode)) << 1;
+        hash ^= std::hash<bool>{}(desc.frontCounterClockwise) << 2;
+        hash ^= std::hash<bool>{}(desc.depthClipEnable) << 3;
+        hash ^= std::hash<bool>{}(desc.scissorEnable) << 4;
+        hash ^= std::hash<float>{}(desc.depthBias) << 5;
+        hash ^= std::hash<float>{}(desc.depthBiasClamp) << 6;
+        hash ^= std::hash<float>{}(desc.slopeScaledDepthBias) << 7;
+        return hash;
+    }
+
+    size_t IPipelineStateManager::HashBlendState(const BlendStateDesc& desc)
+    {
+        size_t hash = 0;
+        hash ^= std::hash<bool>{}(desc.alphaToCoverageEnable);
+        hash ^= std::hash<bool>{}(desc.independentBlendEnable) << 1;
+        
+        // 对于简化，只哈希第一个渲染目标的混合状态
+        const auto& rt = desc.renderTargetBlend[0];
+        hash ^= std::hash<bool>{}(rt.blendEnable) << 2;
+        hash ^= std::hash<int>{}(static_cast<int>(rt.srcColorBlendFactor)) << 3;
+        hash ^= std::hash<int>{}(static_cast<int>(rt.dstColorBlendFactor)) << 4;
+        hash ^= std::hash<int>{}(static_cast<int>(rt.colorBlendOp)) << 5;
+        hash ^= std::hash<int>{}(static_cast<int>(rt.srcAlphaBlendFactor)) << 6;
+        hash ^= std::hash<int>{}(static_cast<int>(rt.dstAlphaBlendFactor)) << 7;
+        hash ^= std::hash<int>{}(static_cast<int>(rt.alphaBlendOp)) << 8;
+        hash ^= std::hash<uint8_t>{}(rt.colorWriteMask) << 9;
+        
+        return hash;
+    }
+
+    size_t IPipelineStateManager::HashDepthStencilState(const DepthStencilStateDesc& desc)
+    {
+        size_t hash = 0;
+        hash ^= std::hash<bool>{}(desc.depthEnable);
+        hash ^= std::hash<bool>{}(desc.depthWriteEnable) << 1;
+        hash ^= std::hash<int>{}(static_cast<int>(desc.depthFunc)) << 2;
+        hash ^= std::hash<bool>{}(desc.stencilEnable) << 3;
+        hash ^= std::hash<uint8_t>{}(desc.stencilReadMask) << 4;
+        hash ^= std::hash<uint8_t>{}(desc.stencilWriteMask) << 5;
+        return hash;
+    }
+
+} // namespace Hazel
\ No newline at end of file
@@ -18,6 +18,9 @@ namespace Hazel {
         
         // 清理无用的管线
         virtual void GarbageCollect() = 0;
+
+        // 分步清理失效的缓存项，每次最多检查 maxBuckets 个桶，扫完一遍返回 true（后台任务用）
+        bool CollectExpiredStep(size_t maxBuckets);
         
         // 获取缓存统计信息
         virtual size_t GetCachedPipelineCount() const = 0;
@@ -29,9 +32,13 @@ namespace Hazel {
         static void Shutdown();
         
     protected:
-        // 管线哈希和缓存
-        virtual uint64_t HashPipelineDesc(const GraphicsPipelineDesc& desc) const = 0;
+        // 管线哈希和缓存，默认实现只依赖描述本身，各后端共用
+        virtual uint64_t HashPipelineDesc(const GraphicsPipelineDesc& desc) const;
+        static size_t HashRasterizerState(const RasterizerStateDesc& desc);
+        static size_t HashBlendState(const BlendStateDesc& desc);
+        static size_t HashDepthStencilState(const DepthStencilStateDesc& desc);
         std::unordered_map<uint64_t, std::weak_ptr<IGraphicsPipeline>> m_PipelineCache;
+        size_t m_SweepCursor = 0;
     };
 
 } // namespace Hazel 
\ No newline at end of file
@@ -6,15 +6,18 @@
 
 namespace Hazel {
 
+    // 放在类外面：嵌套类的默认成员初始化器不能在外层类的默认参数里使用（GCC/Clang）
+    struct PerFrameCommandListAllocatorConfig {
+        uint32_t maxGraphicsCommandLists = 16;
+        uint32_t maxComputeCommandLists = 8;
+        uint32_t maxCopyCommandLists = 4;
+        uint32_t framesInFlight = 3;  // 缓冲帧数
+    };
+
     // 帧级别的CommandList分配器 - 使用Ring Buffer设计
     class PerFrameCommandListAllocator : public ICommandListAllocator {
     public:
-        struct Config {
-            uint32_t maxGraphicsCommandLists = 16;
-            uint32_t maxComputeCommandLists = 8;
-            uint32_t maxCopyCommandLists = 4;
-            uint32_t framesInFlight = 3;  // 缓冲帧数
-        };
+        using Config = PerFrameCommandListAllocatorConfig;
         
         PerFrameCommandListAllocator(const Config& config = {});
         virtual ~PerFrameCommandListAllocator() = default;
@@ -0,0 +1,14 @@
+#include "hzpch.h"
+#include "PerFrameDescriptorAllocator.h"
+
+namespace Hazel {
+
+    PerFrameDescriptorAllocator::PerFrameDescriptorAllocator(DescriptorHeapType heapType, uint32_t maxDescriptors)
+        : m_HeapType(heapType)
+        , m_MaxDescriptors(maxDescriptors)
+        , m_CurrentOffset(0)
+        , m_DescriptorSize(0)
+    {
+    }
+
+} // namespace Hazel
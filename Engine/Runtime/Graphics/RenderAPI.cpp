@@ -1,11 +1,18 @@
 #include "hzpch.h"
 #include "RenderAPI.h"
+#include "Runtime/Graphics/RHI/Core/RHIBackend.h"
 
 namespace Hazel {
-#ifdef RENDER_API_OPENGL
+#if defined(HZ_RHI_STATIC_DISPATCH)
+	// only one backend is compiled in, see RHIBackend.h
+	RenderAPI::API RenderAPI::s_API = s_BackendAPI;
+#elif defined(RENDER_API_OPENGL)
 	RenderAPI::API RenderAPI::s_API = RenderAPI::API::OpenGL;
 #elif RENDER_API_DIRECTX12 // RENDER_API_OPENGL
 	RenderAPI::API RenderAPI::s_API = RenderAPI::API::DirectX12;
+#else
+	// headless build, no GPU backend compiled in
+	RenderAPI::API RenderAPI::s_API = RenderAPI::API::None;
 #endif // DEBUG
 
 }
\ No newline at end of file
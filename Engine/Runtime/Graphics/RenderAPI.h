@@ -11,10 +11,12 @@ namespace Hazel {
 	public:
 		enum class API
 		{
-			None = 0, OpenGL = 1, DirectX12 = 2
+			None = 0, OpenGL = 1, DirectX12 = 2, Null = 3
 		};
 	public:
 		inline static API GetAPI() { return s_API; };
+		// 只能在创建任何RHI对象之前调用（headless 模式切到 Null 后端）
+		inline static void SetAPI(API api) { s_API = api; };
 
 	private:
 		static API s_API;
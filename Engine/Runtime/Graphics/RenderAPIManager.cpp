@@ -1,6 +1,8 @@
 #include "hzpch.h"
 #include "Runtime/Graphics/RenderAPIManager.h"
+#ifdef RENDER_API_DIRECTX12
 #include "Platform/D3D12/D3D12RenderAPIManager.h"
+#endif
 //#include "Platform/Windows/WindowsDXGIWindow.h"
 
 #include "Runtime/Graphics/RenderAPI.h"
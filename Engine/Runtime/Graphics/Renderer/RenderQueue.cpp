@@ -0,0 +1,47 @@
+#include "hzpch.h"
+#include "RenderQueue.h"
+
+namespace Hazel 
+{
+	// 指针右移去掉对齐位，只用于分组，不要求全局唯一
+	static inline uint32_t PointerKey(const void* pointer)
+	{
+		return (uint32_t)((uintptr_t)pointer >> 4);
+	}
+
+	void RenderQueue::Extract(Scene* scene, const std::vector<entt::entity>& visible)
+	{
+		HZ_PROFILE_FUNCTION();
+		entt::registry& registry = scene->Reg();
+		m_Items.reserve(m_Items.size() + visible.size());
+
+		for (entt::entity entity : visible)
+		{
+			const MeshRendererComponent* renderer = registry.try_get<MeshRendererComponent>(entity);
+			const MeshFilterComponent* meshFilter = registry.try_get<MeshFilterComponent>(entity);
+			if (!renderer || !meshFilter || !renderer->material || !meshFilter->mesh)
+				continue;
+
+			RenderItem& item = m_Items.emplace_back();
+			item.MeshData = meshFilter->mesh.get();
+			item.MaterialData = renderer->material.get();
+			item.ObjectToWorld = registry.get<WorldTransformComponent>(entity).World;
+			item.SortKey = ((uint64_t)PointerKey(item.MaterialData) << 32) | PointerKey(item.MeshData);
+		}
+	}
+
+	uint32_t RenderQueue::Sort()
+	{
+		HZ_PROFILE_FUNCTION();
+		std::sort(m_Items.begin(), m_Items.end(),
+			[](const RenderItem& a, const RenderItem& b) { return a.SortKey < b.SortKey; });
+
+		uint32_t stateChanges = 0;
+		for (size_t i = 0; i < m_Items.size(); i++)
+		{
+			if (i == 0 || m_Items[i].SortKey != m_Items[i - 1].SortKey)
+				stateChanges++;
+		}
+		return stateChanges;
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "Runtime/Scene/Scene.h"
+#include "Runtime/Graphics/Renderer/RenderStruct.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Hazel 
+{
+	class Mesh;
+
+	// 从场景里提取出来的一次绘制，渲染线程只读这份数据，不再访问 registry
+	struct RenderItem
+	{
+		Mesh* MeshData = nullptr;
+		Material* MaterialData = nullptr;
+		glm::mat4 ObjectToWorld = glm::mat4(1.0f);
+		// 高 32 位材质、低 32 位网格，排序后相同状态的 draw 相邻
+		uint64_t SortKey = 0;
+	};
+
+	class RenderQueue
+	{
+	public:
+		// 保留容量，每帧复用
+		void Clear() { m_Items.clear(); }
+
+		// 收集剔除后可见的实体，要求同时有 MeshFilter + MeshRenderer
+		void Extract(Scene* scene, const std::vector<entt::entity>& visible);
+		// 按 SortKey 排序，返回状态切换（材质或网格变化）的次数
+		uint32_t Sort();
+
+		inline const std::vector<RenderItem>& GetItems() const { return m_Items; }
+		inline size_t GetSize() const { return m_Items.size(); }
+	private:
+		std::vector<RenderItem> m_Items;
+	};
+}
@@ -3,8 +3,10 @@
 #include "ShaderLibrary.h"
 
 #include "Runtime/Graphics/RenderAPI.h"
+#ifdef HZ_PLATFORM_WINDOWS
 #include "Platform/OpenGL/OpenGLShader.h"
 #include "Platform/D3D12/D3D12Shader.h"
+#endif
 
 namespace Hazel {
 	Ref<Shader> Shader::Create(const std::string& filepath)
@@ -13,7 +15,9 @@ namespace Hazel {
 		{
 			case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
 			//case RenderAPI::API::OpenGL: return std::make_shared<OpenGLShader>(filepath);
+#ifdef HZ_PLATFORM_WINDOWS
 			case RenderAPI::API::DirectX12: return std::make_shared<D3D12Shader>(filepath);
+#endif
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
@@ -65,4 +69,66 @@ namespace Hazel {
 	{
 		return m_Shaders.find(name) != m_Shaders.end();
 	}
+
+	ShaderLibrary& ShaderLibrary::GetGlobal()
+	{
+		static ShaderLibrary instance;
+		return instance;
+	}
+
+	Ref<Shader> ShaderLibrary::LoadCached(const std::string& filepath)
+	{
+		std::string key = std::filesystem::path(filepath).lexically_normal().generic_string();
+
+		std::promise<Ref<Shader>> promise;
+		std::shared_future<Ref<Shader>> future;
+		bool compileHere = false;
+		{
+			std::lock_guard<std::mutex> lock(m_CacheMutex);
+			auto it = m_PathCache.find(key);
+			if (it != m_PathCache.end())
+			{
+				future = it->second;
+			}
+			else
+			{
+				future = promise.get_future().share();
+				m_PathCache.emplace(key, future);
+				compileHere = true;
+			}
+		}
+
+		// 别的线程已经在编译（或已经编译完成）
+		if (!compileHere)
+			return future.get();
+
+		Ref<Shader> shader;
+		try
+		{
+			shader = Shader::Create(filepath);
+		}
+		catch (const std::exception& e)
+		{
+			HZ_CORE_ERROR("ShaderLibrary: failed to compile '{0}': {1}", filepath, e.what());
+		}
+		catch (...)
+		{
+			// 异常不能跳过下面的 set_value，否则等同一个 shader 的线程会一直阻塞
+			HZ_CORE_ERROR("ShaderLibrary: failed to compile '{0}': unknown exception", filepath);
+		}
+
+		if (!shader)
+		{
+			std::lock_guard<std::mutex> lock(m_CacheMutex);
+			m_PathCache.erase(key);
+		}
+		promise.set_value(shader);
+		return shader;
+	}
+
+	void ShaderLibrary::ClearCache()
+	{
+		std::lock_guard<std::mutex> lock(m_CacheMutex);
+		m_PathCache.clear();
+	}
 }
\ No newline at end of file
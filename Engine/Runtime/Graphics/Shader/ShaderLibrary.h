@@ -1,5 +1,7 @@
 #pragma once
 
+#include <future>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include "Runtime/Core/Core.h"
@@ -19,9 +21,20 @@ namespace Hazel {
 		
 		Ref<Shader> Get(const std::string& name);
 		bool Exists(const std::string& name) const;
+
+		// 引擎共用的着色器库（材质加载、启动资源都走这里）
+		static ShaderLibrary& GetGlobal();
+
+		// 按文件路径缓存，线程安全；多个线程同时请求同一个文件只编译一次，其余等待结果
+		// 编译失败返回 nullptr 且不缓存，下次请求会重新编译
+		Ref<Shader> LoadCached(const std::string& filepath);
+		void ClearCache();
 		
 	private:
 		std::unordered_map<std::string, Ref<Shader>> m_Shaders;
+
+		std::mutex m_CacheMutex;
+		std::unordered_map<std::string, std::shared_future<Ref<Shader>>> m_PathCache;
 	};
 
 } // namespace Hazel 
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include "Runtime/Core/Core.h"
 #include "Runtime/Graphics/RHI/Core/Buffer.h"
+#include "Runtime/Core/Memory/Allocator/FrameArena.h"
 
 namespace Hazel {
 	
@@ -143,26 +144,29 @@ namespace Hazel {
 		// InputLayout 接口（只属于顶点着色器）
 		virtual BufferLayout ReflectVertexInputLayout() = 0;
 		
-		// 便利方法：收集所有阶段的资源（用于现有代码兼容）
-		std::vector<ShaderRegisterBlock> GetAllRegisterBlocks() const {
-			std::vector<ShaderRegisterBlock> allBlocks;
-			auto stages = GetAvailableStages();
+		// 便利方法：收集所有阶段的寄存器块（按绑定点去重），只返回指针，临时数组走帧分配器
+		// 结果只在当前帧有效，不要保存
+		FrameVector<const ShaderRegisterBlock*> GetAllRegisterBlockRefs() const {
+			FrameVector<const ShaderRegisterBlock*> allBlocks;
 			
-			for (auto stage : stages) {
+			for (uint32_t i = 0; i < (uint32_t)ShaderStage::Count; ++i) {
+				ShaderStage stage = (ShaderStage)i;
+				if (!HasStage(stage))
+					continue;
 				auto* stageRes = GetStageResources(stage);
 				if (stageRes) {
 					for (const auto& block : stageRes->registerBlocks) {
 						// 避免重复添加相同绑定点的块
 						bool exists = false;
-						for (const auto& existing : allBlocks) {
-							if (existing.BindPoint == block.BindPoint && 
-								existing.BindSpace == block.BindSpace) {
+						for (const auto* existing : allBlocks) {
+							if (existing->BindPoint == block.BindPoint && 
+								existing->BindSpace == block.BindSpace) {
 								exists = true;
 								break;
 							}
 						}
 						if (!exists) {
-							allBlocks.push_back(block);
+							allBlocks.push_back(&block);
 						}
 					}
 				}
@@ -170,6 +174,15 @@ namespace Hazel {
 			return allBlocks;
 		}
 		
+		// 便利方法：收集所有阶段的资源（用于现有代码兼容）
+		std::vector<ShaderRegisterBlock> GetAllRegisterBlocks() const {
+			std::vector<ShaderRegisterBlock> allBlocks;
+			for (const auto* block : GetAllRegisterBlockRefs()) {
+				allBlocks.push_back(*block);
+			}
+			return allBlocks;
+		}
+		
 		std::vector<ResourceBinding> GetAllResourceBindings() const {
 			std::vector<ResourceBinding> allBindings;
 			auto stages = GetAvailableStages();
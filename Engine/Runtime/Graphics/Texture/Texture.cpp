@@ -3,9 +3,11 @@
 
 #include "Texture.h"
 #include "Runtime/Graphics/RenderAPI.h"
+#ifdef HZ_PLATFORM_WINDOWS
 #include "Platform/OpenGL/OpenGLTexture2D.h"
 #include "Platform/OpenGL/OpenGLTexture3D.h"
 #include "Platform/D3D12/D3D12Texture2D.h"
+#endif
 
 namespace Hazel {
 	Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height, uint32_t colorFormat)
@@ -13,7 +15,9 @@ namespace Hazel {
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None:    HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported!"); return nullptr;
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::OpenGL:  return  std::make_shared<OpenGLTexture2D>(width, height, colorFormat);
+#endif
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown RenderAPI!");
@@ -26,7 +30,9 @@ namespace Hazel {
 		switch (RenderAPI::GetAPI())
 		{
 			case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 			case RenderAPI::API::OpenGL: return std::make_shared<OpenGLTexture2D>(path);
+#endif
 			//case RenderAPI::API::DirectX12 : return std::make_shared<D3D12Texture2D>(path);
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
@@ -38,7 +44,9 @@ namespace Hazel {
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::OpenGL: return std::make_shared<OpenGLTexture2D>(path, isCompressedImage, enableMip);
+#endif
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
@@ -50,7 +58,9 @@ namespace Hazel {
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None:    HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported!"); return nullptr;
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::OpenGL:  return  std::make_shared<OpenGLTexture3D>(width, height);
+#endif
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown RenderAPI!");
@@ -63,7 +73,9 @@ namespace Hazel {
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::OpenGL: return std::make_shared<OpenGLTexture3D>(path);
+#endif
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
@@ -74,7 +86,9 @@ namespace Hazel {
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::OpenGL: return std::make_shared<OpenGLTexture3D>(path, isCompressedImage, enableMipMap);
+#endif
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
@@ -1,7 +1,10 @@
 #include "hzpch.h"
 #include "TextureBuffer.h"
+#ifdef HZ_PLATFORM_WINDOWS
 #include "Platform/OpenGL/OpenGLFramebuffer.h"
 #include "Platform/D3D12/D3D12TextureBuffer.h"
+#endif
+#include "Platform/Null/NullTextureBuffer.h"
 #include "Runtime/Graphics/RenderAPI.h"
 
 namespace Hazel 
@@ -9,13 +12,17 @@ namespace Hazel
 
 	Ref<TextureBuffer> TextureBuffer::Create(const TextureBufferSpecification& spec)
 	{
+		HZ_MEMORY_TAG(RHI);
 		// ����һ��uuid�����TextureBuffer
 
 		switch (RenderAPI::GetAPI())
 		{
 		case RenderAPI::API::None: HZ_CORE_ASSERT(false, "RenderAPI::None is currently not supported");
+#ifdef HZ_PLATFORM_WINDOWS
 		case RenderAPI::API::DirectX12: return  std::make_shared<D3D12TextureBuffer>(spec);
 		case RenderAPI::API::OpenGL: return  std::make_shared<OpenGLFramebuffer>(spec);
+#endif
+		case RenderAPI::API::Null: return  std::make_shared<NullTextureBuffer>(spec);
 		}
 		HZ_CORE_ASSERT(false, "Unknowed API...");
 		return nullptr;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "hzpch.h"
+#include "entt.hpp"
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
 #include "Runtime/Graphics/Mesh/Mesh.h"
 #include <Runtime/Graphics/Material/Material.h>
 //#include <Hazel/Model/Model.h>
@@ -11,27 +13,71 @@
 
 namespace Hazel {
 
+	// 局部变换，矩阵缓存在 WorldTransformComponent 里，由 TransformSystem 每帧批量重算
+	// 直接改 Translation / Rotation / Scale 之后要调用 MarkDirty()，或者用 SetXxx；没有标记的修改不会生效
 	struct TransformComponent 
 	{
 		glm::vec3 Translation = { 0.0f, 0.0f, 0.0f };
+		// 欧拉角（度），按 X、Y、Z 的顺序相乘
 		glm::vec3 Rotation = { 0.0f, 0.0f, 0.0f };
 		glm::vec3 Scale = { 1.0f, 1.0f, 1.0f };
+		// UseQuaternion 时用它代替 Rotation（SetRotation(quat) 打开，SetRotation(vec3) 关闭）
+		glm::quat Orientation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		bool UseQuaternion = false;
+		bool Dirty = true;
 
 		TransformComponent() = default;
 		TransformComponent(const TransformComponent&) = default;
 		TransformComponent(const glm::vec3& translation)
 			: Translation(translation) {}
 
+		inline void MarkDirty() { Dirty = true; }
+		inline void SetTranslation(const glm::vec3& translation) { Translation = translation; Dirty = true; }
+		inline void SetRotation(const glm::vec3& eulerDegrees) { Rotation = eulerDegrees; UseQuaternion = false; Dirty = true; }
+		inline void SetRotation(const glm::quat& orientation) { Orientation = orientation; UseQuaternion = true; Dirty = true; }
+		inline void SetScale(const glm::vec3& scale) { Scale = scale; Dirty = true; }
+
+		// 每次调用都重新计算；每帧要用的地方读 WorldTransformComponent
 		glm::mat4 GetTransform() const
 		{
-			glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), glm::radians(Rotation.x), { 1, 0, 0 })
-				* glm::rotate(glm::mat4(1.0f), glm::radians(Rotation.y), { 0, 1, 0 })
-				* glm::rotate(glm::mat4(1.0f), glm::radians(Rotation.z), { 0, 0, 1 });
+			glm::mat4 rotation;
+			if (UseQuaternion)
+			{
+				rotation = glm::mat4_cast(Orientation);
+			}
+			else
+			{
+				rotation = glm::rotate(glm::mat4(1.0f), glm::radians(Rotation.x), { 1, 0, 0 })
+					* glm::rotate(glm::mat4(1.0f), glm::radians(Rotation.y), { 0, 1, 0 })
+					* glm::rotate(glm::mat4(1.0f), glm::radians(Rotation.z), { 0, 0, 1 });
+			}
 
 			return glm::translate(glm::mat4(1.0f), Translation) * rotation * glm::scale(glm::mat4(1.0f), Scale);
 		}
 	};
 
+	// TransformComponent 的缓存矩阵，Scene 给每个带 TransformComponent 的实体自动添加
+	// 只在 TransformSystem::Update 里写，其他系统只读；有父节点时是父节点 World * 自身局部矩阵
+	struct WorldTransformComponent
+	{
+		glm::mat4 World = glm::mat4(1.0f);
+		// TransformSystem 内部用：在层级数组里的下标，不在层级里为 s_NotInHierarchy
+		static constexpr uint32_t s_NotInHierarchy = UINT32_MAX;
+		uint32_t HierarchyIndex = s_NotInHierarchy;
+	};
+
+	// 父子关系，子节点用双向链表串起来，不额外分配内存
+	// 只通过 Scene::SetParent 修改，直接改字段 TransformSystem 不会重建层级
+	struct RelationshipComponent
+	{
+		entt::entity Parent = entt::null;
+		entt::entity FirstChild = entt::null;
+		entt::entity LastChild = entt::null;
+		entt::entity PrevSibling = entt::null;
+		entt::entity NextSibling = entt::null;
+		uint32_t ChildCount = 0;
+	};
+
 	struct SpriteRendererComponent
 	{
 		glm::vec4 Color{1.0f, 1.0f, 1.0f, 1.0f};
@@ -50,18 +96,31 @@ namespace Hazel {
 	struct MeshFilterComponent
 	{
 		Ref<Mesh> mesh;
+		MeshFilterComponent() = default;
+		// 多个实体共用同一个 Mesh，不重复加载
+		MeshFilterComponent(const Ref<Mesh>& sharedMesh)
+			: mesh(sharedMesh) {}
 		MeshFilterComponent(const std::string& meshAddress)
 		{
 			mesh = Mesh::Create();
 			//mesh->Create();
 			mesh->LoadMesh(meshAddress);
 		}
+
+		// 增量快照用来判断组件池是否变化
+		bool operator==(const MeshFilterComponent& other) const { return mesh == other.mesh; }
 	};
 
 	struct MeshRendererComponent
 	{
 		Ref<Material> material;
 
+		MeshRendererComponent() = default;
+		MeshRendererComponent(const Ref<Material>& sharedMaterial)
+			: material(sharedMaterial) {}
+
+		bool operator==(const MeshRendererComponent& other) const { return material == other.material; }
+
 		//MeshRendererComponent()
 		//{
 		//	material = Material::Create();
@@ -76,6 +135,8 @@ namespace Hazel {
 		TagComponent(const TagComponent&) = default;
 		TagComponent(const std::string& tag)
 			: Tag(tag) {}
+
+		bool operator==(const TagComponent& other) const { return Tag == other.Tag; }
 	
 	};
 
@@ -38,6 +38,8 @@ namespace Hazel
 			return m_Scene->m_Registry.remove<T>(m_EntityHandle);
 		}
 
+		entt::entity GetHandle() const { return m_EntityHandle; }
+
 		operator bool() const { return m_EntityHandle != entt::null; }
 		operator uint32_t() const { return (uint32_t)m_EntityHandle; }
 
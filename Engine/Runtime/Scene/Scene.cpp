@@ -1,17 +1,30 @@
 #include "hzpch.h"
 #include "Scene.h"
 #include "Entity.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
 
 #include <glm/glm.hpp>
 namespace Hazel {
 
-
-	static void OnTransformConstruct() 
-	{
-	}
-
 	Scene::Scene() 
 	{
+		HZ_MEMORY_TAG(Scene);
+		// 每个 TransformComponent 都配一个 WorldTransformComponent 缓存矩阵，父子关系变化时通知系统
+		m_TransformSystem.Attach(m_Registry);
+		m_Systems.Add("Transform",
+			SystemAccess().Read<RelationshipComponent>().Write<TransformComponent, WorldTransformComponent>(),
+			[this](SystemContext& context) { m_TransformSystem.Update(context.Registry); },
+			SystemStage::Transform);
+
+		RegisterSnapshotComponent<TagComponent>();
+		RegisterSnapshotComponent<TransformComponent>();
+		RegisterSnapshotComponent<WorldTransformComponent>();
+		RegisterSnapshotComponent<RelationshipComponent>();
+		RegisterSnapshotComponent<SpriteRendererComponent>();
+		RegisterSnapshotComponent<MeshFilterComponent>();
+		RegisterSnapshotComponent<MeshRendererComponent>();
+		RegisterSnapshotComponent<CameraComponent>();
+
 		//struct MeshComponent 
 		//{
 		//	float value;
@@ -54,9 +67,6 @@ namespace Hazel {
 			 
 			//Rrenderer::submit(mesh, transform);
 		}
-
-		// add a callback to Transform constructor. when every time an TransformComponent added
-		m_Registry.on_construct<TransformComponent>().connect<&OnTransformConstruct>();
 	}
 
 
@@ -66,11 +76,173 @@ namespace Hazel {
 
 	void Scene::OnUpdate(float ts) 
 	{
+		HZ_MEMORY_TAG(Scene);
 		//HZ_CORE_INFO("{0} test test test");
+		m_Systems.Run(m_Registry, ts);
 	}	
+
+	bool Scene::SetParent(Entity child, Entity parent)
+	{
+		HZ_MEMORY_TAG(Scene);
+		entt::entity childHandle = child.GetHandle();
+		entt::entity parentHandle = parent ? parent.GetHandle() : entt::null;
+		HZ_CORE_ASSERT(m_Registry.all_of<TransformComponent>(childHandle), "SetParent: child has no TransformComponent");
+		HZ_CORE_ASSERT(parentHandle == entt::null || m_Registry.all_of<TransformComponent>(parentHandle), "SetParent: parent has no TransformComponent");
+
+		// 不能挂到自己或者自己的后代下面
+		for (entt::entity ancestor = parentHandle; ancestor != entt::null;)
+		{
+			if (ancestor == childHandle)
+				return false;
+			const RelationshipComponent* relationship = m_Registry.try_get<RelationshipComponent>(ancestor);
+			ancestor = relationship ? relationship->Parent : entt::null;
+		}
+
+		DetachFromParent(childHandle);
+		if (parentHandle != entt::null)
+		{
+			RelationshipComponent& parentRelationship = m_Registry.get_or_emplace<RelationshipComponent>(parentHandle);
+			RelationshipComponent& childRelationship = m_Registry.get_or_emplace<RelationshipComponent>(childHandle);
+			childRelationship.Parent = parentHandle;
+			childRelationship.PrevSibling = parentRelationship.LastChild;
+			childRelationship.NextSibling = entt::null;
+			if (parentRelationship.LastChild != entt::null)
+				m_Registry.get<RelationshipComponent>(parentRelationship.LastChild).NextSibling = childHandle;
+			else
+				parentRelationship.FirstChild = childHandle;
+			parentRelationship.LastChild = childHandle;
+			parentRelationship.ChildCount++;
+		}
+
+		// Translation/Rotation/Scale 保持不变，解释成相对新父节点的值
+		m_Registry.get<TransformComponent>(childHandle).MarkDirty();
+		m_TransformSystem.MarkHierarchyChanged();
+		return true;
+	}
+
+	Ref<SceneSnapshot> Scene::CreateSnapshot(const SceneSnapshot* previous)
+	{
+		HZ_PROFILE_FUNCTION();
+		HZ_MEMORY_TAG(Scene);
+		Ref<SceneSnapshot> snapshot = CreateRef<SceneSnapshot>();
+		snapshot->m_EntityPool.assign(m_Registry.data(), m_Registry.data() + m_Registry.size());
+		snapshot->m_FreeList = m_Registry.released();
+
+		// 池在注册时就建好了，这里各个池只读，可以并行拷贝
+		const uint32_t typeCount = (uint32_t)m_SnapshotTypes.size();
+		snapshot->m_Pools.resize(typeCount);
+		snapshot->m_Captured.resize(typeCount);
+		JobSystem::ParallelFor(typeCount, 1, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+			{
+				const SnapshotComponentType& type = m_SnapshotTypes[i];
+				Ref<const SnapshotPool> last = previous ? previous->FindPool(type.Type) : nullptr;
+				snapshot->m_Pools[i] = type.Capture(m_Registry, last);
+			}
+		});
+		for (uint32_t i = 0; i < typeCount; i++)
+		{
+			Ref<const SnapshotPool> last = previous ? previous->FindPool(m_SnapshotTypes[i].Type) : nullptr;
+			snapshot->m_Captured[i] = snapshot->m_Pools[i] != last;
+			snapshot->m_CapturedPoolCount += snapshot->m_Captured[i] ? 1 : 0;
+		}
+		return snapshot;
+	}
+
+	void Scene::RestoreSnapshot(const SceneSnapshot& snapshot)
+	{
+		HZ_PROFILE_FUNCTION();
+		HZ_MEMORY_TAG(Scene);
+		// WorldTransformComponent 跟着快照一起恢复，整池重建时的信号不用 TransformSystem 处理
+		m_TransformSystem.Detach(m_Registry);
+
+		// 实体池不同（中间创建或销毁过实体）时整个重建，否则只替换组件池
+		const bool rebuild = (size_t)m_Registry.size() != snapshot.m_EntityPool.size()
+			|| m_Registry.released() != snapshot.m_FreeList
+			|| std::memcmp(m_Registry.data(), snapshot.m_EntityPool.data(), snapshot.m_EntityPool.size() * sizeof(entt::entity)) != 0;
+		if (rebuild)
+		{
+			m_Registry.clear();
+			m_Registry.assign(snapshot.m_EntityPool.begin(), snapshot.m_EntityPool.end(), snapshot.m_FreeList);
+		}
+
+		// 清空重插的池会触发信号，信号处理（比如 owning group 重排被拥有的池）可能改动别的池，
+		// 所以这些池在当前线程逐个恢复；恢复过程中原本对得上的池可能被重排，重新检查直到稳定
+		const uint32_t typeCount = (uint32_t)m_SnapshotTypes.size();
+		std::vector<std::pair<uint32_t, Ref<const SnapshotPool>>> inPlace;
+		inPlace.reserve(typeCount);
+		for (uint32_t i = 0; i < typeCount; i++)
+		{
+			const SnapshotComponentType& type = m_SnapshotTypes[i];
+			Ref<const SnapshotPool> pool = snapshot.FindPool(type.Type);
+			if (pool)
+				inPlace.push_back({ i, pool });
+			else if (!rebuild)
+				m_Registry.storage(type.Type)->clear();
+		}
+		for (bool restored = true; restored;)
+		{
+			restored = false;
+			for (size_t i = 0; i < inPlace.size();)
+			{
+				const SnapshotComponentType& type = m_SnapshotTypes[inPlace[i].first];
+				if (type.MatchesPool(m_Registry, *inPlace[i].second))
+				{
+					i++;
+					continue;
+				}
+				type.Restore(m_Registry, *inPlace[i].second, false);
+				inPlace.erase(inPlace.begin() + i);
+				restored = true;
+			}
+		}
+
+		// 剩下的池只原地覆盖组件，不触发信号，互不影响，可以并行
+		JobSystem::ParallelFor((uint32_t)inPlace.size(), 1, [&](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t i = begin; i < end; i++)
+				m_SnapshotTypes[inPlace[i].first].Restore(m_Registry, *inPlace[i].second, false);
+		});
+
+		m_TransformSystem.Attach(m_Registry);
+		m_TransformSystem.Reset(m_Registry);
+		m_RestoreCount++;
+	}
+
+	Entity Scene::GetParent(Entity child)
+	{
+		const RelationshipComponent* relationship = m_Registry.try_get<RelationshipComponent>(child.GetHandle());
+		if (!relationship || relationship->Parent == entt::null)
+			return {};
+		return { relationship->Parent, this };
+	}
+
+	void Scene::DetachFromParent(entt::entity child)
+	{
+		RelationshipComponent* relationship = m_Registry.try_get<RelationshipComponent>(child);
+		if (!relationship || relationship->Parent == entt::null)
+			return;
+
+		RelationshipComponent& parent = m_Registry.get<RelationshipComponent>(relationship->Parent);
+		if (parent.FirstChild == child)
+			parent.FirstChild = relationship->NextSibling;
+		if (parent.LastChild == child)
+			parent.LastChild = relationship->PrevSibling;
+		parent.ChildCount--;
+		if (relationship->PrevSibling != entt::null)
+			m_Registry.get<RelationshipComponent>(relationship->PrevSibling).NextSibling = relationship->NextSibling;
+		if (relationship->NextSibling != entt::null)
+			m_Registry.get<RelationshipComponent>(relationship->NextSibling).PrevSibling = relationship->PrevSibling;
+
+		relationship->Parent = entt::null;
+		relationship->PrevSibling = entt::null;
+		relationship->NextSibling = entt::null;
+	}
 	
 	Entity Scene::CreateEntity(const std::string& name)
 	{
+		HZ_MEMORY_TAG(Scene);
 		Entity entity = { m_Registry.create(),this };
 		entity.AddComponent<TransformComponent>();
 		auto& tag = entity.AddComponent<TagComponent>();
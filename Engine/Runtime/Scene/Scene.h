@@ -2,6 +2,9 @@
 
 #include "entt.hpp"
 #include "Component.h"
+#include "SceneSnapshot.h"
+#include "Systems/SystemScheduler.h"
+#include "Systems/TransformSystem.h"
 namespace Hazel {
 	
 	class Entity;
@@ -13,15 +16,56 @@ namespace Hazel {
 		~Scene();
 
 		Entity CreateEntity(const std::string& name = "");
+		// 执行注册到 GetSystems() 的所有系统，互不冲突的系统并行
 		void OnUpdate(float ts);
 
+		// 把 child 挂到 parent 下面，parent 为空实体时变回根节点
+		// 两者都要有 TransformComponent；parent 是 child 自己或其后代时返回 false
+		bool SetParent(Entity child, Entity parent);
+		Entity GetParent(Entity child);
+
+		TransformSystem& GetTransformSystem() { return m_TransformSystem; }
+		// 场景自带 "Transform" 系统（SystemStage::Transform），其他系统在这里注册
+		SystemScheduler& GetSystems() { return m_Systems; }
+
+		// 进入播放模式 / 撤销检查点用的快照，只包含注册过的组件类型（内置组件构造时已注册）
+		// previous 不为空时做增量快照：和它相比没有变化的组件池直接共享，不再拷贝
+		Ref<SceneSnapshot> CreateSnapshot(const SceneSnapshot* previous = nullptr);
+		// 恢复到快照时的实体和组件，尽量复用现有的组件池：成员没变的池原地覆盖，不触发信号；
+		// 其余的池清空后重新插入，会触发销毁 / 构造信号（TransformSystem 的监听在恢复期间断开）
+		// 没注册的组件类型在实体集合变化时会被清空
+		void RestoreSnapshot(const SceneSnapshot& snapshot);
+		// 每次 RestoreSnapshot 加一；原地覆盖的池没有信号，靠信号维护缓存的（层级面板）用它判断要不要整体重建
+		inline uint32_t GetRestoreCount() const { return m_RestoreCount; }
+
+		template<typename T>
+		void RegisterSnapshotComponent()
+		{
+			entt::id_type type = entt::type_hash<T>::value();
+			for (const SnapshotComponentType& registered : m_SnapshotTypes)
+			{
+				if (registered.Type == type)
+					return;
+			}
+			// 先把池建好，拍快照时各个池可以并行访问
+			m_Registry.storage<T>();
+			m_SnapshotTypes.push_back(SnapshotComponentType::Create<T>());
+		}
 
 		// TEMP
 		entt::registry& Reg() { return m_Registry; }
 	private:
+		void DetachFromParent(entt::entity child);
+	private:
+		// registry 析构时还会触发 on_destroy 信号，系统要比 registry 活得久，所以先声明
+		TransformSystem m_TransformSystem;
+		SystemScheduler m_Systems;
 		entt::registry m_Registry;
+		std::vector<SnapshotComponentType> m_SnapshotTypes;
+		uint32_t m_RestoreCount = 0;
 
 		friend class Entity;
 		friend class SceneHierarchyPanel;
+		friend class SceneSerializer;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,793 @@
+#include "hzpch.h"
+#include "SceneSerializer.h"
+#include "Scene.h"
+
+#include "Runtime/Core/Containers/FlatHashMap.h"
+#include "Runtime/Core/Serialization/MappedFile.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Core/Time/FrameTimer.h"
+
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace Hazel
+{
+	// 二进制场景文件（小端）
+	//
+	//	FileHeader
+	//	块数据：每块 uint32_t 实体下标[Count]，然后 Record[Count]，各自 16 字节对齐
+	//	ChunkHeader[ChunkCount]
+	//	StringEntry[StringCount] + 字符数据
+	//
+	// 实体下标是实体在文件里的编号 0..EntityCount-1，实体之间的引用（Relationship）也用下标
+	// 记录结构只在这里定义，和运行时组件的内存布局无关，组件加字段时升 s_BinaryVersion
+	namespace
+	{
+		constexpr char s_SceneMagic[8] = { 'H', 'Z', 'S', 'C', 'E', 'N', 'E', '\0' };
+		constexpr uint64_t s_ChunkAlignment = 16;
+		constexpr uint32_t s_NullIndex = UINT32_MAX;
+		// 加载时记录转换成组件按这个粒度分给 JobSystem
+		constexpr uint32_t s_LoadBatchSize = 16384;
+
+		enum class ChunkType : uint32_t
+		{
+			Tag = 1,
+			Transform,
+			Relationship,
+			SpriteRenderer,
+			MeshFilter,
+			MeshRenderer
+		};
+
+		struct FileHeader
+		{
+			char Magic[8];
+			uint32_t Version;
+			uint32_t EntityCount;
+			uint32_t ChunkCount;
+			uint32_t StringCount;
+			uint64_t ChunkTableOffset;
+			uint64_t StringTableOffset;
+			uint64_t StringDataOffset;
+			uint64_t StringDataSize;
+		};
+
+		struct ChunkHeader
+		{
+			uint32_t Type;
+			uint32_t Count;
+			uint32_t RecordSize;
+			uint32_t Reserved;
+			uint64_t IndexOffset;
+			uint64_t RecordOffset;
+		};
+
+		struct StringEntry
+		{
+			uint32_t Offset;
+			uint32_t Length;
+		};
+
+		struct TagRecord
+		{
+			uint32_t String;
+		};
+
+		constexpr uint32_t s_TransformUseQuaternion = 1;
+
+		struct TransformRecord
+		{
+			float Translation[3];
+			float Rotation[3];
+			float Scale[3];
+			// w, x, y, z
+			float Orientation[4];
+			uint32_t Flags;
+		};
+
+		struct RelationshipRecord
+		{
+			uint32_t Parent;
+			uint32_t FirstChild;
+			uint32_t LastChild;
+			uint32_t PrevSibling;
+			uint32_t NextSibling;
+			uint32_t ChildCount;
+		};
+
+		struct SpriteRendererRecord
+		{
+			float Color[4];
+		};
+
+		struct AssetRecord
+		{
+			uint32_t Index;
+		};
+
+		static_assert(std::is_trivially_copyable_v<TransformRecord> && sizeof(TransformRecord) == 56, "TransformRecord layout changed");
+		static_assert(sizeof(RelationshipRecord) == 24, "RelationshipRecord layout changed");
+		static_assert(sizeof(ChunkHeader) == 32, "ChunkHeader layout changed");
+
+		uint64_t AlignOffset(uint64_t offset)
+		{
+			return (offset + s_ChunkAlignment - 1) & ~(s_ChunkAlignment - 1);
+		}
+
+		FILE* OpenFile(const std::string& filepath, const char* mode)
+		{
+#ifdef HZ_PLATFORM_WINDOWS
+			FILE* file = nullptr;
+			fopen_s(&file, filepath.c_str(), mode);
+			return file;
+#else
+			return std::fopen(filepath.c_str(), mode);
+#endif
+		}
+
+		// 文本格式里的字符串：加引号写出，\ 和 " 前加反斜杠，\n \r \t 照 C 转义，
+		// 其它控制字符写成定长三位八进制 \ooo（后面紧跟数字也不会读错），保证一个组件始终只占一行
+		void WriteQuotedString(FILE* file, const std::string& value)
+		{
+			std::fputc('"', file);
+			for (char c : value)
+			{
+				switch (c)
+				{
+				case '"':  std::fputs("\\\"", file); break;
+				case '\\': std::fputs("\\\\", file); break;
+				case '\n': std::fputs("\\n", file); break;
+				case '\r': std::fputs("\\r", file); break;
+				case '\t': std::fputs("\\t", file); break;
+				default:
+					if ((unsigned char)c < 0x20 || c == 0x7f)
+						std::fprintf(file, "\\%03o", (unsigned char)c);
+					else
+						std::fputc(c, file);
+					break;
+				}
+			}
+			std::fputc('"', file);
+		}
+
+		// 保存时共用：实体编号、字符串表、资源下标
+		class SceneWriter
+		{
+		public:
+			SceneWriter(entt::registry& registry, SceneAssetTable* assets)
+				: m_Assets(assets)
+			{
+				registry.each([this](entt::entity entity)
+				{
+					uint32_t slot = (uint32_t)entt::to_entity(entity);
+					if (slot >= m_EntityToIndex.size())
+						m_EntityToIndex.resize(slot + 1, s_NullIndex);
+					m_EntityToIndex[slot] = (uint32_t)m_Entities.size();
+					m_Entities.push_back(entity);
+				});
+
+				if (m_Assets)
+				{
+					for (uint32_t i = 0; i < (uint32_t)m_Assets->Meshes.size(); i++)
+						m_MeshIndices.try_emplace(m_Assets->Meshes[i].get(), i);
+					for (uint32_t i = 0; i < (uint32_t)m_Assets->Materials.size(); i++)
+						m_MaterialIndices.try_emplace(m_Assets->Materials[i].get(), i);
+				}
+			}
+
+			inline const std::vector<entt::entity>& GetEntities() const { return m_Entities; }
+			inline bool HasAssets() const { return m_Assets != nullptr; }
+
+			uint32_t ToIndex(entt::entity entity) const
+			{
+				if (entity == entt::null)
+					return s_NullIndex;
+				uint32_t slot = (uint32_t)entt::to_entity(entity);
+				return slot < m_EntityToIndex.size() ? m_EntityToIndex[slot] : s_NullIndex;
+			}
+
+			uint32_t AddString(const std::string& value)
+			{
+				auto [it, inserted] = m_StringIndices.try_emplace(value, (uint32_t)m_Strings.size());
+				if (inserted)
+				{
+					m_Strings.push_back({ (uint32_t)m_StringData.size(), (uint32_t)value.size() });
+					m_StringData.append(value);
+				}
+				return it->second;
+			}
+
+			uint32_t AddMesh(const Ref<Mesh>& mesh)
+			{
+				return AddAsset(mesh, m_Assets->Meshes, m_MeshIndices);
+			}
+
+			uint32_t AddMaterial(const Ref<Material>& material)
+			{
+				return AddAsset(material, m_Assets->Materials, m_MaterialIndices);
+			}
+
+			const std::vector<StringEntry>& GetStrings() const { return m_Strings; }
+			const std::string& GetStringData() const { return m_StringData; }
+		private:
+			template<typename T>
+			static uint32_t AddAsset(const Ref<T>& asset, std::vector<Ref<T>>& table, FlatHashMap<const void*, uint32_t>& indices)
+			{
+				if (!asset)
+					return s_NullIndex;
+				auto [it, inserted] = indices.try_emplace(asset.get(), (uint32_t)table.size());
+				if (inserted)
+					table.push_back(asset);
+				return it->second;
+			}
+		private:
+			SceneAssetTable* m_Assets;
+
+			std::vector<entt::entity> m_Entities;
+			// entt::to_entity(entity) -> 文件里的实体下标
+			std::vector<uint32_t> m_EntityToIndex;
+
+			FlatHashMap<std::string, uint32_t> m_StringIndices;
+			std::vector<StringEntry> m_Strings;
+			std::string m_StringData;
+
+			FlatHashMap<const void*, uint32_t> m_MeshIndices;
+			FlatHashMap<const void*, uint32_t> m_MaterialIndices;
+		};
+
+		class BinaryBuilder
+		{
+		public:
+			BinaryBuilder()
+			{
+				m_Buffer.resize(AlignOffset(sizeof(FileHeader)), 0);
+			}
+
+			template<typename T>
+			uint64_t Append(const T* data, size_t count)
+			{
+				uint64_t offset = AlignOffset(m_Buffer.size());
+				m_Buffer.resize(offset + sizeof(T) * count, 0);
+				if (count > 0)
+					std::memcpy(m_Buffer.data() + offset, data, sizeof(T) * count);
+				return offset;
+			}
+
+			// 遍历组件池，每个组件转换成一条记录
+			template<typename Component, typename Record, typename Convert>
+			void AddChunk(entt::registry& registry, const SceneWriter& writer, ChunkType type, Convert&& convert)
+			{
+				auto view = registry.view<Component>();
+				if (view.size() == 0)
+					return;
+
+				std::vector<uint32_t> indices;
+				std::vector<Record> records;
+				indices.reserve(view.size());
+				records.reserve(view.size());
+				for (auto [entity, component] : view.each())
+				{
+					indices.push_back(writer.ToIndex(entity));
+					convert(component, records.emplace_back());
+				}
+
+				ChunkHeader chunk = {};
+				chunk.Type = (uint32_t)type;
+				chunk.Count = (uint32_t)records.size();
+				chunk.RecordSize = (uint32_t)sizeof(Record);
+				chunk.IndexOffset = Append(indices.data(), indices.size());
+				chunk.RecordOffset = Append(records.data(), records.size());
+				m_Chunks.push_back(chunk);
+			}
+
+			std::vector<uint8_t>& Finish(const SceneWriter& writer)
+			{
+				FileHeader header = {};
+				std::memcpy(header.Magic, s_SceneMagic, sizeof(s_SceneMagic));
+				header.Version = SceneSerializer::s_BinaryVersion;
+				header.EntityCount = (uint32_t)writer.GetEntities().size();
+				header.ChunkCount = (uint32_t)m_Chunks.size();
+				header.ChunkTableOffset = Append(m_Chunks.data(), m_Chunks.size());
+				header.StringCount = (uint32_t)writer.GetStrings().size();
+				header.StringTableOffset = Append(writer.GetStrings().data(), writer.GetStrings().size());
+				header.StringDataSize = writer.GetStringData().size();
+				header.StringDataOffset = Append(writer.GetStringData().data(), writer.GetStringData().size());
+				std::memcpy(m_Buffer.data(), &header, sizeof(header));
+				return m_Buffer;
+			}
+		private:
+			std::vector<uint8_t> m_Buffer;
+			std::vector<ChunkHeader> m_Chunks;
+		};
+
+		uint32_t GetRecordSize(ChunkType type)
+		{
+			switch (type)
+			{
+			case ChunkType::Tag:				return sizeof(TagRecord);
+			case ChunkType::Transform:			return sizeof(TransformRecord);
+			case ChunkType::Relationship:		return sizeof(RelationshipRecord);
+			case ChunkType::SpriteRenderer:		return sizeof(SpriteRendererRecord);
+			case ChunkType::MeshFilter:			return sizeof(AssetRecord);
+			case ChunkType::MeshRenderer:		return sizeof(AssetRecord);
+			default:							return 0;
+			}
+		}
+
+		bool InRange(uint64_t offset, uint64_t size, size_t fileSize)
+		{
+			return offset <= fileSize && size <= fileSize - offset;
+		}
+
+		// Relationship 的链接必须和加载后 TransformSystem / Scene::SetParent 维护的结构一致：
+		// 链接的实体都有 Relationship 和 Transform，子节点链表的 Parent 都指向所有者、前后指针对得上、
+		// 个数等于 ChildCount，Parent 链上没有环。不一致的文件会让层级遍历访问不存在的组件或者死循环
+		bool ValidateHierarchy(const std::vector<const RelationshipRecord*>& relationships, const std::vector<uint8_t>& hasTransform)
+		{
+			const uint32_t entityCount = (uint32_t)relationships.size();
+			auto linkable = [&](uint32_t index) { return index == s_NullIndex || (relationships[index] && hasTransform[index]); };
+
+			uint64_t parentedCount = 0;
+			uint64_t childCount = 0;
+			for (uint32_t e = 0; e < entityCount; e++)
+			{
+				const RelationshipRecord* r = relationships[e];
+				if (!r)
+					continue;
+				if (!hasTransform[e] || !linkable(r->Parent) || !linkable(r->FirstChild) || !linkable(r->LastChild)
+					|| !linkable(r->PrevSibling) || !linkable(r->NextSibling))
+				{
+					return false;
+				}
+				if (r->Parent == s_NullIndex && (r->PrevSibling != s_NullIndex || r->NextSibling != s_NullIndex))
+					return false;
+				parentedCount += r->Parent != s_NullIndex ? 1 : 0;
+
+				// 最多走 ChildCount 步，兄弟链表有环时个数或前后指针对不上
+				uint32_t previous = s_NullIndex;
+				uint32_t child = r->FirstChild;
+				for (uint32_t i = 0; i < r->ChildCount; i++)
+				{
+					if (child == s_NullIndex || !relationships[child] || relationships[child]->Parent != e || relationships[child]->PrevSibling != previous)
+						return false;
+					previous = child;
+					child = relationships[child]->NextSibling;
+				}
+				if (child != s_NullIndex || previous != r->LastChild)
+					return false;
+				childCount += r->ChildCount;
+			}
+			// 每个有父节点的实体都恰好出现在父节点的链表里一次
+			if (parentedCount != childCount)
+				return false;
+
+			// Parent 链不能成环：0 未检查，1 正在检查的路径上，2 已确认能走到根
+			std::vector<uint8_t> state(entityCount, 0);
+			std::vector<uint32_t> path;
+			for (uint32_t e = 0; e < entityCount; e++)
+			{
+				path.clear();
+				uint32_t node = e;
+				while (node != s_NullIndex && relationships[node] && state[node] == 0)
+				{
+					state[node] = 1;
+					path.push_back(node);
+					node = relationships[node]->Parent;
+				}
+				if (node != s_NullIndex && state[node] == 1)
+					return false;
+				for (uint32_t visited : path)
+					state[visited] = 2;
+			}
+			return true;
+		}
+
+		// 加载前完整检查一遍，之后插入组件时不再做任何检查
+		bool ValidateFile(const uint8_t* data, size_t size, const std::string& filepath)
+		{
+			if (size < sizeof(FileHeader))
+			{
+				HZ_CORE_ERROR("SceneSerializer: {0} is too small to be a scene file", filepath);
+				return false;
+			}
+
+			const FileHeader& header = *reinterpret_cast<const FileHeader*>(data);
+			if (std::memcmp(header.Magic, s_SceneMagic, sizeof(s_SceneMagic)) != 0)
+			{
+				HZ_CORE_ERROR("SceneSerializer: {0} is not a binary scene file", filepath);
+				return false;
+			}
+			if (header.Version != SceneSerializer::s_BinaryVersion)
+			{
+				HZ_CORE_ERROR("SceneSerializer: {0} has version {1}, expected {2}", filepath, header.Version, SceneSerializer::s_BinaryVersion);
+				return false;
+			}
+			if (!InRange(header.ChunkTableOffset, (uint64_t)header.ChunkCount * sizeof(ChunkHeader), size)
+				|| !InRange(header.StringTableOffset, (uint64_t)header.StringCount * sizeof(StringEntry), size)
+				|| !InRange(header.StringDataOffset, header.StringDataSize, size)
+				|| header.ChunkTableOffset % s_ChunkAlignment != 0 || header.StringTableOffset % s_ChunkAlignment != 0)
+			{
+				HZ_CORE_ERROR("SceneSerializer: {0} has a truncated table", filepath);
+				return false;
+			}
+
+			const StringEntry* strings = reinterpret_cast<const StringEntry*>(data + header.StringTableOffset);
+			for (uint32_t i = 0; i < header.StringCount; i++)
+			{
+				if (!InRange(strings[i].Offset, strings[i].Length, header.StringDataSize))
+				{
+					HZ_CORE_ERROR("SceneSerializer: {0} has a corrupt string table", filepath);
+					return false;
+				}
+			}
+
+			auto validIndex = [&](uint32_t index) { return index < header.EntityCount; };
+			auto validReference = [&](uint32_t index) { return index == s_NullIndex || index < header.EntityCount; };
+
+			std::vector<uint8_t> seen(header.EntityCount);
+			std::vector<const RelationshipRecord*> relationshipOf(header.EntityCount, nullptr);
+			std::vector<uint8_t> hasTransform(header.EntityCount, 0);
+			uint32_t seenTypes = 0;
+			const ChunkHeader* chunks = reinterpret_cast<const ChunkHeader*>(data + header.ChunkTableOffset);
+			for (uint32_t c = 0; c < header.ChunkCount; c++)
+			{
+				const ChunkHeader& chunk = chunks[c];
+				uint32_t recordSize = GetRecordSize((ChunkType)chunk.Type);
+				if (recordSize == 0)
+					continue;
+
+				if (chunk.RecordSize != recordSize || chunk.Count > header.EntityCount
+					|| chunk.IndexOffset % s_ChunkAlignment != 0 || chunk.RecordOffset % s_ChunkAlignment != 0
+					|| !InRange(chunk.IndexOffset, (uint64_t)chunk.Count * sizeof(uint32_t), size)
+					|| !InRange(chunk.RecordOffset, (uint64_t)chunk.Count * recordSize, size))
+				{
+					HZ_CORE_ERROR("SceneSerializer: {0} has a corrupt chunk {1}", filepath, c);
+					return false;
+				}
+				// 同一种组件两个块会对同一个实体插入两次
+				if (seenTypes & (1u << chunk.Type))
+				{
+					HZ_CORE_ERROR("SceneSerializer: {0} has more than one chunk of type {1}", filepath, chunk.Type);
+					return false;
+				}
+				seenTypes |= 1u << chunk.Type;
+
+				// 每个实体在一个块里最多出现一次
+				std::fill(seen.begin(), seen.end(), (uint8_t)0);
+				const uint32_t* indices = reinterpret_cast<const uint32_t*>(data + chunk.IndexOffset);
+				bool valid = true;
+				for (uint32_t i = 0; i < chunk.Count && valid; i++)
+				{
+					valid = validIndex(indices[i]) && !seen[indices[i]];
+					if (valid)
+						seen[indices[i]] = 1;
+				}
+
+				const uint8_t* records = data + chunk.RecordOffset;
+				if ((ChunkType)chunk.Type == ChunkType::Transform)
+				{
+					for (uint32_t i = 0; i < chunk.Count && valid; i++)
+						hasTransform[indices[i]] = 1;
+				}
+				else if ((ChunkType)chunk.Type == ChunkType::Tag)
+				{
+					const TagRecord* tags = reinterpret_cast<const TagRecord*>(records);
+					for (uint32_t i = 0; i < chunk.Count && valid; i++)
+						valid = tags[i].String < header.StringCount;
+				}
+				else if ((ChunkType)chunk.Type == ChunkType::Relationship)
+				{
+					const RelationshipRecord* relationships = reinterpret_cast<const RelationshipRecord*>(records);
+					for (uint32_t i = 0; i < chunk.Count && valid; i++)
+					{
+						const RelationshipRecord& r = relationships[i];
+						valid = validReference(r.Parent) && validReference(r.FirstChild) && validReference(r.LastChild)
+							&& validReference(r.PrevSibling) && validReference(r.NextSibling);
+						if (valid)
+							relationshipOf[indices[i]] = &r;
+					}
+				}
+
+				if (!valid)
+				{
+					HZ_CORE_ERROR("SceneSerializer: {0} has an invalid reference in chunk {1}", filepath, c);
+					return false;
+				}
+			}
+
+			if (!ValidateHierarchy(relationshipOf, hasTransform))
+			{
+				HZ_CORE_ERROR("SceneSerializer: {0} has an inconsistent parent/child hierarchy", filepath);
+				return false;
+			}
+			return true;
+		}
+
+		// 记录 -> 组件的转换分块并行，插入 registry 在调用线程上一次完成
+		template<typename Component, typename Record, typename Convert>
+		void InsertChunk(entt::registry& registry, const uint8_t* data, const ChunkHeader& chunk,
+			const std::vector<entt::entity>& entities, Convert&& convert)
+		{
+			const uint32_t* indices = reinterpret_cast<const uint32_t*>(data + chunk.IndexOffset);
+			const Record* records = reinterpret_cast<const Record*>(data + chunk.RecordOffset);
+
+			std::vector<entt::entity> targets(chunk.Count);
+			std::vector<Component> components(chunk.Count);
+			JobSystem::ParallelFor(chunk.Count, s_LoadBatchSize, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					targets[i] = entities[indices[i]];
+					convert(records[i], components[i]);
+				}
+			});
+
+			auto& storage = registry.storage<Component>();
+			storage.reserve(storage.size() + chunk.Count);
+			registry.insert<Component>(targets.begin(), targets.end(), std::make_move_iterator(components.begin()));
+		}
+
+		template<typename T>
+		Ref<T> ResolveAsset(const std::vector<Ref<T>>* table, uint32_t index, std::atomic<bool>& missing)
+		{
+			if (index == s_NullIndex)
+				return nullptr;
+			if (!table || index >= table->size())
+			{
+				missing.store(true, std::memory_order_relaxed);
+				return nullptr;
+			}
+			return (*table)[index];
+		}
+	}
+
+	bool SceneSerializer::SerializeBinary(Scene& scene, const std::string& filepath, SceneAssetTable* assets)
+	{
+		HZ_PROFILE_FUNCTION();
+		HZ_MEMORY_TAG(Scene);
+		entt::registry& registry = scene.m_Registry;
+		SceneWriter writer(registry, assets);
+		BinaryBuilder builder;
+
+		builder.AddChunk<TagComponent, TagRecord>(registry, writer, ChunkType::Tag,
+			[&](const TagComponent& tag, TagRecord& record)
+		{
+			record.String = writer.AddString(tag.Tag);
+		});
+
+		builder.AddChunk<TransformComponent, TransformRecord>(registry, writer, ChunkType::Transform,
+			[](const TransformComponent& transform, TransformRecord& record)
+		{
+			std::memcpy(record.Translation, &transform.Translation.x, sizeof(record.Translation));
+			std::memcpy(record.Rotation, &transform.Rotation.x, sizeof(record.Rotation));
+			std::memcpy(record.Scale, &transform.Scale.x, sizeof(record.Scale));
+			record.Orientation[0] = transform.Orientation.w;
+			record.Orientation[1] = transform.Orientation.x;
+			record.Orientation[2] = transform.Orientation.y;
+			record.Orientation[3] = transform.Orientation.z;
+			record.Flags = transform.UseQuaternion ? s_TransformUseQuaternion : 0;
+		});
+
+		builder.AddChunk<RelationshipComponent, RelationshipRecord>(registry, writer, ChunkType::Relationship,
+			[&](const RelationshipComponent& relationship, RelationshipRecord& record)
+		{
+			record.Parent = writer.ToIndex(relationship.Parent);
+			record.FirstChild = writer.ToIndex(relationship.FirstChild);
+			record.LastChild = writer.ToIndex(relationship.LastChild);
+			record.PrevSibling = writer.ToIndex(relationship.PrevSibling);
+			record.NextSibling = writer.ToIndex(relationship.NextSibling);
+			record.ChildCount = relationship.ChildCount;
+		});
+
+		builder.AddChunk<SpriteRendererComponent, SpriteRendererRecord>(registry, writer, ChunkType::SpriteRenderer,
+			[](const SpriteRendererComponent& sprite, SpriteRendererRecord& record)
+		{
+			std::memcpy(record.Color, &sprite.Color.x, sizeof(record.Color));
+		});
+
+		if (writer.HasAssets())
+		{
+			builder.AddChunk<MeshFilterComponent, AssetRecord>(registry, writer, ChunkType::MeshFilter,
+				[&](const MeshFilterComponent& meshFilter, AssetRecord& record)
+			{
+				record.Index = writer.AddMesh(meshFilter.mesh);
+			});
+			builder.AddChunk<MeshRendererComponent, AssetRecord>(registry, writer, ChunkType::MeshRenderer,
+				[&](const MeshRendererComponent& meshRenderer, AssetRecord& record)
+			{
+				record.Index = writer.AddMaterial(meshRenderer.material);
+			});
+		}
+
+		// 字符串表在所有块写完之后才完整，最后写
+		const std::vector<uint8_t>& buffer = builder.Finish(writer);
+
+		FILE* file = OpenFile(filepath, "wb");
+		if (!file)
+		{
+			HZ_CORE_ERROR("SceneSerializer: Cannot open file {0} for writing", filepath);
+			return false;
+		}
+		size_t written = fwrite(buffer.data(), 1, buffer.size(), file);
+		fclose(file);
+		if (written != buffer.size())
+		{
+			HZ_CORE_ERROR("SceneSerializer: Failed to write {0}", filepath);
+			return false;
+		}
+		return true;
+	}
+
+	bool SceneSerializer::DeserializeBinary(Scene& scene, const std::string& filepath, const SceneAssetTable* assets,
+		SceneLoadStats* stats)
+	{
+		HZ_PROFILE_FUNCTION();
+		HZ_MEMORY_TAG(Scene);
+		uint64_t startNs = Clock::NowNanoseconds();
+
+		MappedFile file;
+		if (!file.Open(filepath))
+		{
+			HZ_CORE_ERROR("SceneSerializer: Cannot open file {0}", filepath);
+			return false;
+		}
+		const uint8_t* data = file.GetData();
+		if (!ValidateFile(data, file.GetSize(), filepath))
+			return false;
+		uint64_t mappedNs = Clock::NowNanoseconds();
+
+		const FileHeader& header = *reinterpret_cast<const FileHeader*>(data);
+		const ChunkHeader* chunks = reinterpret_cast<const ChunkHeader*>(data + header.ChunkTableOffset);
+		const StringEntry* strings = reinterpret_cast<const StringEntry*>(data + header.StringTableOffset);
+		const char* stringData = reinterpret_cast<const char*>(data + header.StringDataOffset);
+
+		entt::registry& registry = scene.m_Registry;
+		std::vector<entt::entity> entities(header.EntityCount);
+		registry.create(entities.begin(), entities.end());
+		uint64_t createdNs = Clock::NowNanoseconds();
+
+		std::atomic<bool> missingAsset{ false };
+		bool hasRelationships = false;
+		uint32_t componentCount = 0;
+		for (uint32_t c = 0; c < header.ChunkCount; c++)
+		{
+			const ChunkHeader& chunk = chunks[c];
+			switch ((ChunkType)chunk.Type)
+			{
+			case ChunkType::Tag:
+				InsertChunk<TagComponent, TagRecord>(registry, data, chunk, entities,
+					[&](const TagRecord& record, TagComponent& tag)
+				{
+					const StringEntry& entry = strings[record.String];
+					tag.Tag.assign(stringData + entry.Offset, entry.Length);
+				});
+				break;
+			case ChunkType::Transform:
+				InsertChunk<TransformComponent, TransformRecord>(registry, data, chunk, entities,
+					[](const TransformRecord& record, TransformComponent& transform)
+				{
+					transform.Translation = { record.Translation[0], record.Translation[1], record.Translation[2] };
+					transform.Rotation = { record.Rotation[0], record.Rotation[1], record.Rotation[2] };
+					transform.Scale = { record.Scale[0], record.Scale[1], record.Scale[2] };
+					transform.Orientation = glm::quat(record.Orientation[0], record.Orientation[1], record.Orientation[2], record.Orientation[3]);
+					transform.UseQuaternion = (record.Flags & s_TransformUseQuaternion) != 0;
+					transform.Dirty = true;
+				});
+				break;
+			case ChunkType::Relationship:
+				hasRelationships = true;
+				InsertChunk<RelationshipComponent, RelationshipRecord>(registry, data, chunk, entities,
+					[&](const RelationshipRecord& record, RelationshipComponent& relationship)
+				{
+					auto toEntity = [&](uint32_t index) { return index == s_NullIndex ? entt::null : entities[index]; };
+					relationship.Parent = toEntity(record.Parent);
+					relationship.FirstChild = toEntity(record.FirstChild);
+					relationship.LastChild = toEntity(record.LastChild);
+					relationship.PrevSibling = toEntity(record.PrevSibling);
+					relationship.NextSibling = toEntity(record.NextSibling);
+					relationship.ChildCount = record.ChildCount;
+				});
+				break;
+			case ChunkType::SpriteRenderer:
+				InsertChunk<SpriteRendererComponent, SpriteRendererRecord>(registry, data, chunk, entities,
+					[](const SpriteRendererRecord& record, SpriteRendererComponent& sprite)
+				{
+					sprite.Color = { record.Color[0], record.Color[1], record.Color[2], record.Color[3] };
+				});
+				break;
+			case ChunkType::MeshFilter:
+				InsertChunk<MeshFilterComponent, AssetRecord>(registry, data, chunk, entities,
+					[&](const AssetRecord& record, MeshFilterComponent& meshFilter)
+				{
+					meshFilter.mesh = ResolveAsset(assets ? &assets->Meshes : nullptr, record.Index, missingAsset);
+				});
+				break;
+			case ChunkType::MeshRenderer:
+				InsertChunk<MeshRendererComponent, AssetRecord>(registry, data, chunk, entities,
+					[&](const AssetRecord& record, MeshRendererComponent& meshRenderer)
+				{
+					meshRenderer.material = ResolveAsset(assets ? &assets->Materials : nullptr, record.Index, missingAsset);
+				});
+				break;
+			default:
+				HZ_CORE_WARN("SceneSerializer: {0} skipping unknown chunk type {1}", filepath, chunk.Type);
+				continue;
+			}
+			componentCount += chunk.Count;
+		}
+
+		if (missingAsset.load(std::memory_order_relaxed))
+			HZ_CORE_WARN("SceneSerializer: {0} references assets that are not in the asset table, left empty", filepath);
+		if (hasRelationships)
+			scene.GetTransformSystem().MarkHierarchyChanged();
+
+		if (stats)
+		{
+			uint64_t endNs = Clock::NowNanoseconds();
+			stats->EntityCount = header.EntityCount;
+			stats->ComponentCount = componentCount;
+			stats->MapMs = (double)(mappedNs - startNs) / 1e6;
+			stats->CreateMs = (double)(createdNs - mappedNs) / 1e6;
+			stats->ComponentsMs = (double)(endNs - createdNs) / 1e6;
+			stats->TotalMs = (double)(endNs - startNs) / 1e6;
+		}
+		return true;
+	}
+
+	bool SceneSerializer::SerializeText(Scene& scene, const std::string& filepath, SceneAssetTable* assets)
+	{
+		HZ_PROFILE_FUNCTION();
+		entt::registry& registry = scene.m_Registry;
+		SceneWriter writer(registry, assets);
+
+		FILE* file = OpenFile(filepath, "w");
+		if (!file)
+		{
+			HZ_CORE_ERROR("SceneSerializer: Cannot open file {0} for writing", filepath);
+			return false;
+		}
+
+		const std::vector<entt::entity>& entities = writer.GetEntities();
+		fprintf(file, "# Hazel scene, %u entities, binary version %u\n", (uint32_t)entities.size(), s_BinaryVersion);
+		for (uint32_t i = 0; i < (uint32_t)entities.size(); i++)
+		{
+			entt::entity entity = entities[i];
+			fprintf(file, "entity %u\n", i);
+			if (const TagComponent* tag = registry.try_get<TagComponent>(entity))
+			{
+				fprintf(file, "  Tag ");
+				WriteQuotedString(file, tag->Tag);
+				fprintf(file, "\n");
+			}
+			if (const TransformComponent* t = registry.try_get<TransformComponent>(entity))
+			{
+				fprintf(file, "  Transform t=(%g, %g, %g) r=(%g, %g, %g) s=(%g, %g, %g)",
+					t->Translation.x, t->Translation.y, t->Translation.z,
+					t->Rotation.x, t->Rotation.y, t->Rotation.z,
+					t->Scale.x, t->Scale.y, t->Scale.z);
+				if (t->UseQuaternion)
+					fprintf(file, " q=(%g, %g, %g, %g)", t->Orientation.w, t->Orientation.x, t->Orientation.y, t->Orientation.z);
+				fprintf(file, "\n");
+			}
+			if (const RelationshipComponent* relationship = registry.try_get<RelationshipComponent>(entity))
+			{
+				if (relationship->Parent != entt::null)
+					fprintf(file, "  Parent %u\n", writer.ToIndex(relationship->Parent));
+			}
+			if (const SpriteRendererComponent* sprite = registry.try_get<SpriteRendererComponent>(entity))
+				fprintf(file, "  SpriteRenderer color=(%g, %g, %g, %g)\n", sprite->Color.r, sprite->Color.g, sprite->Color.b, sprite->Color.a);
+			if (writer.HasAssets())
+			{
+				if (const MeshFilterComponent* meshFilter = registry.try_get<MeshFilterComponent>(entity))
+					fprintf(file, "  MeshFilter mesh=%d\n", (int32_t)writer.AddMesh(meshFilter->mesh));
+				if (const MeshRendererComponent* meshRenderer = registry.try_get<MeshRendererComponent>(entity))
+					fprintf(file, "  MeshRenderer material=%d\n", (int32_t)writer.AddMaterial(meshRenderer->material));
+			}
+		}
+
+		fclose(file);
+		return true;
+	}
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <string>
+#include <vector>
+
+namespace Hazel
+{
+	class Scene;
+	class Mesh;
+	class Material;
+
+	// MeshFilterComponent / MeshRendererComponent 引用的资源
+	// 还没有资源数据库，场景文件里只存在这张表里的下标：保存时把遇到的资源追加进来，
+	// 加载时由调用者按同样的顺序提供
+	struct SceneAssetTable
+	{
+		std::vector<Ref<Mesh>> Meshes;
+		std::vector<Ref<Material>> Materials;
+	};
+
+	struct SceneLoadStats
+	{
+		uint32_t EntityCount = 0;
+		uint32_t ComponentCount = 0;
+		double MapMs = 0.0;
+		double CreateMs = 0.0;
+		double ComponentsMs = 0.0;
+		double TotalMs = 0.0;
+	};
+
+	// 场景序列化器
+	// - 二进制格式（运行时加载用）：每种组件一个连续的块，块里是实体下标数组和定长记录数组，
+	//   字符串放在单独的字符串表里；所有块 16 字节对齐，可以直接内存映射后读
+	//   加载时一次创建全部实体，再逐块 registry.insert，不逐个解析组件
+	// - 文本格式：一行一个组件，实体下标和二进制格式一致，只用来 diff / 查看，不能读回
+	//   字符串加引号，其中的引号、反斜杠和控制字符按 C 转义写出，不会破坏行结构
+	//
+	// 保存的组件：Tag、Transform、Relationship、SpriteRenderer，
+	// 传入 SceneAssetTable 时还有 MeshFilter、MeshRenderer；WorldTransform 加载后由 TransformSystem 重算
+	class SceneSerializer
+	{
+	public:
+		static constexpr uint32_t s_BinaryVersion = 1;
+
+		static bool SerializeBinary(Scene& scene, const std::string& filepath, SceneAssetTable* assets = nullptr);
+		// 实体追加到 scene 里，不清空已有实体；文件损坏或版本不符时不修改 scene
+		static bool DeserializeBinary(Scene& scene, const std::string& filepath, const SceneAssetTable* assets = nullptr,
+			SceneLoadStats* stats = nullptr);
+
+		static bool SerializeText(Scene& scene, const std::string& filepath, SceneAssetTable* assets = nullptr);
+	};
+}
@@ -0,0 +1,34 @@
+#include "hzpch.h"
+#include "SceneSnapshot.h"
+
+namespace Hazel
+{
+	size_t SceneSnapshot::GetMemoryUsage() const
+	{
+		size_t total = m_EntityPool.size() * sizeof(entt::entity);
+		for (const Ref<const SnapshotPool>& pool : m_Pools)
+			total += pool->MemoryUsage;
+		return total;
+	}
+
+	size_t SceneSnapshot::GetCapturedMemoryUsage() const
+	{
+		size_t total = m_EntityPool.size() * sizeof(entt::entity);
+		for (size_t i = 0; i < m_Pools.size(); i++)
+		{
+			if (m_Captured[i])
+				total += m_Pools[i]->MemoryUsage;
+		}
+		return total;
+	}
+
+	Ref<const SnapshotPool> SceneSnapshot::FindPool(entt::id_type type) const
+	{
+		for (const Ref<const SnapshotPool>& pool : m_Pools)
+		{
+			if (pool->Type == type)
+				return pool;
+		}
+		return nullptr;
+	}
+}
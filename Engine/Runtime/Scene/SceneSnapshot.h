@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "entt.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace Hazel
+{
+	// 一个组件池的拷贝，和组件池的 packed 数组同序；拍好之后不再修改，增量快照之间直接共享
+	struct SnapshotPool
+	{
+		virtual ~SnapshotPool() = default;
+
+		entt::id_type Type = 0;
+		std::vector<entt::entity> Entities;
+		size_t MemoryUsage = 0;
+	};
+
+	template<typename T>
+	struct TypedSnapshotPool : SnapshotPool
+	{
+		std::vector<T> Components;
+	};
+
+	// 可以拍快照的组件类型，由 Scene::RegisterSnapshotComponent<T>() 注册
+	struct SnapshotComponentType
+	{
+		entt::id_type Type = 0;
+		// previous 是上一个快照里同类型的池，内容没变时直接返回它
+		Ref<const SnapshotPool> (*Capture)(entt::registry& registry, const Ref<const SnapshotPool>& previous) = nullptr;
+		// rebuilt 为 true 时实体池刚重建过，所有组件池都是空的
+		void (*Restore)(entt::registry& registry, const SnapshotPool& pool, bool rebuilt) = nullptr;
+		// 池里的实体和顺序和快照一致，Restore 只会原地覆盖组件、不触发信号
+		bool (*MatchesPool)(entt::registry& registry, const SnapshotPool& pool) = nullptr;
+
+		template<typename T>
+		static SnapshotComponentType Create();
+	};
+
+	// Scene::CreateSnapshot 的结果：实体池 + 已注册组件的所有组件池
+	// 可以多次 Restore，也可以作为下一次增量快照的 previous
+	class SceneSnapshot
+	{
+	public:
+		inline uint32_t GetEntityCount() const { return (uint32_t)m_EntityPool.size(); }
+		inline size_t GetPoolCount() const { return m_Pools.size(); }
+		// 这次快照实际拷贝的池数，其余和 previous 共享
+		inline uint32_t GetCapturedPoolCount() const { return m_CapturedPoolCount; }
+
+		// 全部池 / 只算这次拷贝的池（撤销历史实际多占的内存）
+		size_t GetMemoryUsage() const;
+		size_t GetCapturedMemoryUsage() const;
+
+		Ref<const SnapshotPool> FindPool(entt::id_type type) const;
+	private:
+		// registry.data() 的拷贝和空闲链表头，恢复时 registry.assign 回去
+		std::vector<entt::entity> m_EntityPool;
+		entt::entity m_FreeList = entt::null;
+
+		std::vector<Ref<const SnapshotPool>> m_Pools;
+		std::vector<bool> m_Captured;
+		uint32_t m_CapturedPoolCount = 0;
+
+		friend class Scene;
+	};
+
+	namespace SnapshotDetail
+	{
+		template<typename T, typename = void>
+		struct HasEquality : std::false_type {};
+
+		template<typename T>
+		struct HasEquality<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>> : std::true_type {};
+
+		// 组件按页存放，func(起始下标, 这一页的指针, 这一页的个数)
+		template<typename T, typename Pages, typename F>
+		inline void ForEachPage(Pages pages, size_t count, F&& func)
+		{
+			constexpr size_t pageSize = entt::component_traits<T>::page_size;
+			for (size_t begin = 0; begin < count; begin += pageSize)
+				func(begin, pages[begin / pageSize], std::min(pageSize, count - begin));
+		}
+
+		// 可平凡拷贝的直接比较内存，其余用 operator==，两样都没有时认为变了
+		template<typename T, typename Pages>
+		bool ComponentsEqual(const std::vector<T>& components, Pages pages, size_t count)
+		{
+			if constexpr (!std::is_trivially_copyable_v<T> && !HasEquality<T>::value)
+			{
+				return false;
+			}
+			else
+			{
+				bool equal = true;
+				ForEachPage<T>(pages, count, [&](size_t begin, const T* page, size_t n)
+				{
+					if (!equal)
+						return;
+					if constexpr (std::is_trivially_copyable_v<T>)
+						equal = std::memcmp(components.data() + begin, page, n * sizeof(T)) == 0;
+					else
+						equal = std::equal(page, page + n, components.begin() + begin);
+				});
+				return equal;
+			}
+		}
+
+		template<typename T>
+		Ref<const SnapshotPool> CapturePool(entt::registry& registry, const Ref<const SnapshotPool>& previous)
+		{
+			static_assert(entt::component_traits<T>::page_size > 0, "Empty components have no pool to snapshot");
+
+			const auto& storage = registry.storage<T>();
+			const size_t count = storage.size();
+			const entt::entity* entities = storage.data();
+
+			if (previous)
+			{
+				const auto& last = static_cast<const TypedSnapshotPool<T>&>(*previous);
+				if (last.Entities.size() == count
+					&& std::memcmp(last.Entities.data(), entities, count * sizeof(entt::entity)) == 0
+					&& ComponentsEqual(last.Components, storage.raw(), count))
+				{
+					return previous;
+				}
+			}
+
+			// 可平凡拷贝的组件 insert 会按页 memmove，其余逐个拷贝构造
+			Ref<TypedSnapshotPool<T>> pool = CreateRef<TypedSnapshotPool<T>>();
+			pool->Type = entt::type_hash<T>::value();
+			pool->Entities.assign(entities, entities + count);
+			pool->Components.reserve(count);
+			ForEachPage<T>(storage.raw(), count, [&](size_t, const T* page, size_t n)
+			{
+				pool->Components.insert(pool->Components.end(), page, page + n);
+			});
+			pool->MemoryUsage = count * (sizeof(entt::entity) + sizeof(T));
+			return pool;
+		}
+
+		template<typename T>
+		bool MatchesPool(entt::registry& registry, const SnapshotPool& pool)
+		{
+			const auto& storage = registry.storage<T>();
+			const size_t count = pool.Entities.size();
+			return storage.size() == count
+				&& std::memcmp(storage.data(), pool.Entities.data(), count * sizeof(entt::entity)) == 0;
+		}
+
+		template<typename T>
+		void RestorePool(entt::registry& registry, const SnapshotPool& base, bool rebuilt)
+		{
+			const auto& pool = static_cast<const TypedSnapshotPool<T>&>(base);
+			auto& storage = registry.storage<T>();
+			const size_t count = pool.Entities.size();
+
+			// 池里的实体和顺序都没变：原地覆盖组件，不动稀疏表
+			if (!rebuilt && MatchesPool<T>(registry, base))
+			{
+				ForEachPage<T>(storage.raw(), count, [&](size_t begin, T* page, size_t n)
+				{
+					std::copy(pool.Components.begin() + begin, pool.Components.begin() + begin + n, page);
+				});
+				return;
+			}
+
+			// 清空后按快照的顺序重新插入，已分配的页继续用
+			storage.clear();
+			storage.insert(pool.Entities.begin(), pool.Entities.end(), pool.Components.begin());
+		}
+	}
+
+	template<typename T>
+	SnapshotComponentType SnapshotComponentType::Create()
+	{
+		SnapshotComponentType type;
+		type.Type = entt::type_hash<T>::value();
+		type.Capture = &SnapshotDetail::CapturePool<T>;
+		type.Restore = &SnapshotDetail::RestorePool<T>;
+		type.MatchesPool = &SnapshotDetail::MatchesPool<T>;
+		return type;
+	}
+}
@@ -0,0 +1,242 @@
+#include "hzpch.h"
+#include "SystemScheduler.h"
+
+#include "Runtime/Core/Time/FrameTimer.h"
+
+namespace Hazel {
+
+	static const char* GetStageName(SystemStage stage)
+	{
+		switch (stage)
+		{
+		case SystemStage::PreUpdate:	return "PreUpdate";
+		case SystemStage::Update:		return "Update";
+		case SystemStage::Transform:	return "Transform";
+		case SystemStage::PostUpdate:	return "PostUpdate";
+		default:						return "Unknown";
+		}
+	}
+
+	static bool Intersects(const std::vector<entt::id_type>& a, const std::vector<entt::id_type>& b)
+	{
+		for (entt::id_type id : a)
+		{
+			if (std::find(b.begin(), b.end(), id) != b.end())
+				return true;
+		}
+		return false;
+	}
+
+	bool SystemAccess::ConflictsWith(const SystemAccess& other) const
+	{
+		if (m_Exclusive || other.m_Exclusive)
+			return true;
+		return Intersects(m_Write, other.m_Write) || Intersects(m_Write, other.m_Read) || Intersects(m_Read, other.m_Write);
+	}
+
+	int32_t SystemScheduler::Find(const std::string& name) const
+	{
+		for (int32_t i = 0; i < (int32_t)m_Systems.size(); i++)
+		{
+			if (m_Systems[i]->Name == name)
+				return i;
+		}
+		return -1;
+	}
+
+	SystemScheduler& SystemScheduler::Add(const std::string& name, const SystemAccess& access, SystemFunc func, SystemStage stage)
+	{
+		HZ_CORE_ASSERT(func, "System needs a function");
+
+		Scope<System> system(new System());
+		system->Name = name;
+		system->Access = access;
+		system->Func = std::move(func);
+		system->Stage = stage;
+		system->Stats.Name = name;
+		system->Stats.Stage = stage;
+
+		int32_t existing = Find(name);
+		if (existing >= 0)
+			m_Systems[existing] = std::move(system);
+		else
+			m_Systems.push_back(std::move(system));
+		m_GraphDirty = true;
+		return *this;
+	}
+
+	bool SystemScheduler::Remove(const std::string& name)
+	{
+		int32_t index = Find(name);
+		if (index < 0)
+			return false;
+		m_Systems.erase(m_Systems.begin() + index);
+		m_GraphDirty = true;
+		return true;
+	}
+
+	bool SystemScheduler::SetEnabled(const std::string& name, bool enabled)
+	{
+		// 关掉的系统仍留在图里，依赖它的系统照常排序
+		int32_t index = Find(name);
+		if (index < 0)
+			return false;
+		m_Systems[index]->Enabled = enabled;
+		return true;
+	}
+
+	void SystemScheduler::BuildGraph()
+	{
+		HZ_PROFILE_FUNCTION();
+		const uint32_t count = (uint32_t)m_Systems.size();
+		m_Order.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_Order[i] = i;
+			m_Systems[i]->Dependents.clear();
+			m_Systems[i]->DependencyCount = 0;
+		}
+		std::stable_sort(m_Order.begin(), m_Order.end(), [this](uint32_t a, uint32_t b)
+		{
+			return m_Systems[a]->Stage < m_Systems[b]->Stage;
+		});
+
+		// 边总是从 m_Order 里靠前的指向靠后的，不会有环，m_Order 本身就是一个拓扑序
+		for (uint32_t a = 0; a < count; a++)
+		{
+			System& first = *m_Systems[m_Order[a]];
+			for (uint32_t b = a + 1; b < count; b++)
+			{
+				System& second = *m_Systems[m_Order[b]];
+				if (first.Access.ConflictsWith(second.Access))
+				{
+					first.Dependents.push_back(m_Order[b]);
+					second.DependencyCount++;
+				}
+			}
+		}
+		m_GraphDirty = false;
+	}
+
+	void SystemScheduler::Run(entt::registry& registry, float deltaTime)
+	{
+		HZ_PROFILE_FUNCTION();
+		if (m_GraphDirty)
+			BuildGraph();
+		if (m_Systems.empty())
+			return;
+
+		SystemContext context{ registry, deltaTime };
+		uint64_t startNs = Clock::NowNanoseconds();
+		if (!m_Parallel || !JobSystem::IsInitialized())
+		{
+			for (uint32_t index : m_Order)
+				Execute(index, context);
+		}
+		else
+		{
+			for (auto& system : m_Systems)
+				system->Remaining.store((int32_t)system->DependencyCount, std::memory_order_relaxed);
+
+			// 依赖的系统在前置系统的任务里提交，计数器先加后减，不会提前归零
+			JobCounter counter;
+			for (uint32_t index : m_Order)
+			{
+				if (m_Systems[index]->DependencyCount == 0)
+					Schedule(index, context, counter);
+			}
+			JobSystem::Wait(counter);
+		}
+
+		m_LastWallMs = (double)(Clock::NowNanoseconds() - startNs) / 1e6;
+		m_TotalWallMs += m_LastWallMs;
+		m_Frames++;
+	}
+
+	void SystemScheduler::Schedule(uint32_t index, SystemContext& context, JobCounter& counter)
+	{
+		JobSystem::Run([this, index, &context, &counter]()
+		{
+			Execute(index, context);
+			for (uint32_t dependent : m_Systems[index]->Dependents)
+			{
+				if (m_Systems[dependent]->Remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+					Schedule(dependent, context, counter);
+			}
+		}, &counter);
+	}
+
+	void SystemScheduler::Execute(uint32_t index, SystemContext& context)
+	{
+		System& system = *m_Systems[index];
+		if (!system.Enabled)
+		{
+			system.Stats.LastMs = 0.0;
+			return;
+		}
+
+		uint64_t startNs = Clock::NowNanoseconds();
+		{
+			// 系统名不是字面量，不能直接交给 Instrumentor，单个系统的耗时见 LogReport
+			HZ_PROFILE_SCOPE("SystemScheduler::Execute");
+			system.Func(context);
+		}
+		double ms = (double)(Clock::NowNanoseconds() - startNs) / 1e6;
+
+		SystemStats& stats = system.Stats;
+		stats.Runs++;
+		stats.LastMs = ms;
+		stats.TotalMs += ms;
+		stats.MaxMs = std::max(stats.MaxMs, ms);
+	}
+
+	double SystemScheduler::GetLastSerialMs() const
+	{
+		double total = 0.0;
+		for (const auto& system : m_Systems)
+			total += system->Stats.LastMs;
+		return total;
+	}
+
+	void SystemScheduler::GetStats(std::vector<SystemStats>& outStats) const
+	{
+		outStats.clear();
+		for (uint32_t index : m_Order)
+			outStats.push_back(m_Systems[index]->Stats);
+	}
+
+	void SystemScheduler::ResetStats()
+	{
+		for (auto& system : m_Systems)
+		{
+			system->Stats.Runs = 0;
+			system->Stats.LastMs = 0.0;
+			system->Stats.MaxMs = 0.0;
+			system->Stats.TotalMs = 0.0;
+		}
+		m_Frames = 0;
+		m_LastWallMs = 0.0;
+		m_TotalWallMs = 0.0;
+	}
+
+	void SystemScheduler::LogReport() const
+	{
+		double serialMs = 0.0;
+		for (const auto& system : m_Systems)
+			serialMs += system->Stats.TotalMs;
+		double frames = m_Frames ? (double)m_Frames : 1.0;
+
+		HZ_CORE_INFO("Systems: {0} systems, {1} frames, avg wall {2:.3f} ms, avg serial {3:.3f} ms, {4}",
+			m_Systems.size(), m_Frames, m_TotalWallMs / frames, serialMs / frames,
+			m_Parallel && JobSystem::IsInitialized() ? "parallel" : "serial");
+		for (uint32_t index : m_Order)
+		{
+			const System& system = *m_Systems[index];
+			const SystemStats& s = system.Stats;
+			HZ_CORE_INFO("  {0:<24} {1:<10} runs {2:>6} avg {3:>7.3f} ms last {4:>7.3f} ms max {5:>7.3f} ms after {6} system(s){7}",
+				s.Name, GetStageName(s.Stage), s.Runs, s.Runs ? s.TotalMs / (double)s.Runs : 0.0, s.LastMs, s.MaxMs,
+				system.DependencyCount, system.Enabled ? "" : " (disabled)");
+		}
+	}
+
+} // namespace Hazel
@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "entt.hpp"
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Hazel {
+
+	// 有冲突的系统之间按阶段排序，同一阶段内按注册顺序
+	// 阶段只决定冲突系统谁先谁后，互不冲突的系统即使阶段不同也可能并行
+	enum class SystemStage : uint8_t
+	{
+		PreUpdate = 0,
+		Update,
+		// Scene 的 TransformSystem 在这里更新 WorldTransformComponent
+		Transform,
+		// 读取本帧最终世界矩阵的系统
+		PostUpdate
+	};
+
+	// 系统声明的组件访问
+	// - 两个系统都只读同一组件可以并行，只要有一方写就必须串行
+	// - 创建 / 销毁实体、增删组件会改动组件池，必须声明 Exclusive，和其他所有系统串行
+	class SystemAccess
+	{
+	public:
+		template<typename... Components>
+		SystemAccess& Read()
+		{
+			(m_Read.push_back(entt::type_hash<Components>::value()), ...);
+			return *this;
+		}
+
+		template<typename... Components>
+		SystemAccess& Write()
+		{
+			(m_Write.push_back(entt::type_hash<Components>::value()), ...);
+			return *this;
+		}
+
+		SystemAccess& Exclusive()
+		{
+			m_Exclusive = true;
+			return *this;
+		}
+
+		bool ConflictsWith(const SystemAccess& other) const;
+	private:
+		std::vector<entt::id_type> m_Read;
+		std::vector<entt::id_type> m_Write;
+		bool m_Exclusive = false;
+	};
+
+	// 系统执行时拿到的上下文
+	struct SystemContext
+	{
+		entt::registry& Registry;
+		float DeltaTime;
+
+		// 把 view 的实体分块交给 JobSystem 并行执行 func(entity, components&...)
+		// 只能修改声明为 Write 的组件，不能增删组件 / 实体
+		template<typename... Components, typename F>
+		void ParallelEach(uint32_t minBatchSize, F&& func)
+		{
+			auto view = Registry.view<Components...>();
+			const entt::sparse_set& leading = view.handle();
+			const entt::entity* entities = leading.data();
+			JobSystem::ParallelFor((uint32_t)leading.size(), minBatchSize, [&](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					entt::entity entity = entities[i];
+					// 多组件 view 的主池里有不满足条件的实体
+					if (sizeof...(Components) > 1 && !view.contains(entity))
+						continue;
+					func(entity, view.template get<Components>(entity)...);
+				}
+			});
+		}
+	};
+
+	struct SystemStats
+	{
+		std::string Name;
+		SystemStage Stage = SystemStage::Update;
+		uint64_t Runs = 0;
+		double LastMs = 0.0;
+		double MaxMs = 0.0;
+		double TotalMs = 0.0;
+	};
+
+	// 每帧执行的 ECS 系统
+	// - 系统按名字注册，声明读写哪些组件；注册的系统变化后重建依赖图
+	//   （有冲突的两个系统之间连一条边，方向按阶段 / 注册顺序），之后每帧复用
+	// - 互不冲突的系统作为 JobSystem 任务并行执行，系统内部可以用 SystemContext::ParallelEach 再分块
+	// - JobSystem 没初始化或 SetParallel(false) 时在调用线程上按拓扑顺序串行执行
+	// - 记录每个系统的耗时，LogReport 打印
+	//
+	//	scheduler.Add("Movement", SystemAccess().Read<VelocityComponent>().Write<TransformComponent>(),
+	//		[](SystemContext& context)
+	//		{
+	//			context.ParallelEach<TransformComponent, VelocityComponent>(256, [&](entt::entity, TransformComponent& t, VelocityComponent& v)
+	//			{
+	//				t.Translation += v.Velocity * context.DeltaTime;
+	//				t.MarkDirty();
+	//			});
+	//		});
+	//	scheduler.Run(registry, ts);
+	class HAZEL_API SystemScheduler
+	{
+	public:
+		using SystemFunc = std::function<void(SystemContext&)>;
+
+		SystemScheduler() = default;
+		SystemScheduler(const SystemScheduler&) = delete;
+		SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+		// 同名系统已存在时替换
+		SystemScheduler& Add(const std::string& name, const SystemAccess& access, SystemFunc func,
+			SystemStage stage = SystemStage::Update);
+		bool Remove(const std::string& name);
+		bool SetEnabled(const std::string& name, bool enabled);
+
+		// 阻塞到本帧所有系统执行完
+		void Run(entt::registry& registry, float deltaTime);
+
+		inline void SetParallel(bool parallel) { m_Parallel = parallel; }
+		inline size_t GetSystemCount() const { return m_Systems.size(); }
+
+		// 上一帧从开始到结束的墙钟时间 / 所有系统耗时之和
+		inline double GetLastWallMs() const { return m_LastWallMs; }
+		double GetLastSerialMs() const;
+
+		void GetStats(std::vector<SystemStats>& outStats) const;
+		void ResetStats();
+		void LogReport() const;
+	private:
+		struct System
+		{
+			std::string Name;
+			SystemAccess Access;
+			SystemFunc Func;
+			SystemStage Stage = SystemStage::Update;
+			bool Enabled = true;
+
+			std::vector<uint32_t> Dependents;
+			uint32_t DependencyCount = 0;
+			std::atomic<int32_t> Remaining{ 0 };
+
+			SystemStats Stats;
+		};
+
+		int32_t Find(const std::string& name) const;
+		void BuildGraph();
+		void Schedule(uint32_t index, SystemContext& context, JobCounter& counter);
+		void Execute(uint32_t index, SystemContext& context);
+	private:
+		std::vector<Scope<System>> m_Systems;
+		// 按阶段 / 注册顺序排好的下标，也是串行执行的顺序
+		std::vector<uint32_t> m_Order;
+		bool m_GraphDirty = true;
+		bool m_Parallel = true;
+
+		uint64_t m_Frames = 0;
+		double m_LastWallMs = 0.0;
+		double m_TotalWallMs = 0.0;
+	};
+
+} // namespace Hazel
@@ -0,0 +1,261 @@
+#include "hzpch.h"
+#include "TransformSystem.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+
+namespace Hazel
+{
+	static constexpr uint32_t s_NoParent = UINT32_MAX;
+	// 一层少于这个数时单线程做，分块的开销比收益大
+	static constexpr uint32_t s_LevelBatchSize = 1024;
+
+	void TransformSystem::Attach(entt::registry& registry)
+	{
+		registry.on_construct<TransformComponent>().connect<&TransformSystem::OnTransformConstruct>();
+		registry.on_destroy<TransformComponent>().connect<&TransformSystem::OnTransformDestroy>();
+		registry.on_destroy<RelationshipComponent>().connect<&TransformSystem::OnRelationshipDestroy>(*this);
+	}
+
+	void TransformSystem::Detach(entt::registry& registry)
+	{
+		registry.on_construct<TransformComponent>().disconnect<&TransformSystem::OnTransformConstruct>();
+		registry.on_destroy<TransformComponent>().disconnect<&TransformSystem::OnTransformDestroy>();
+		registry.on_destroy<RelationshipComponent>().disconnect<&TransformSystem::OnRelationshipDestroy>(*this);
+	}
+
+	void TransformSystem::Reset(entt::registry& registry)
+	{
+		// 恢复出来的 HierarchyIndex 指向的是拍快照时的数组，全部作废
+		for (auto [entity, world] : registry.view<WorldTransformComponent>().each())
+			world.HierarchyIndex = WorldTransformComponent::s_NotInHierarchy;
+		m_Entities.clear();
+		m_Parent.clear();
+		m_LevelStart.clear();
+		MarkHierarchyChanged();
+	}
+
+	void TransformSystem::OnTransformConstruct(entt::registry& registry, entt::entity entity)
+	{
+		registry.emplace_or_replace<WorldTransformComponent>(entity);
+	}
+
+	void TransformSystem::OnTransformDestroy(entt::registry& registry, entt::entity entity)
+	{
+		registry.remove<WorldTransformComponent>(entity);
+	}
+
+	void TransformSystem::OnRelationshipDestroy(entt::registry& registry, entt::entity entity)
+	{
+		// 从父节点的子链表里摘掉，子节点变成根节点
+		// 整棵树一起销毁（registry.clear）时相邻节点可能已经先被删掉了，所以都用 try_get
+		const RelationshipComponent& relationship = registry.get<RelationshipComponent>(entity);
+		if (RelationshipComponent* parent = relationship.Parent != entt::null ? registry.try_get<RelationshipComponent>(relationship.Parent) : nullptr)
+		{
+			if (parent->FirstChild == entity)
+				parent->FirstChild = relationship.NextSibling;
+			if (parent->LastChild == entity)
+				parent->LastChild = relationship.PrevSibling;
+			parent->ChildCount--;
+		}
+		if (RelationshipComponent* prev = relationship.PrevSibling != entt::null ? registry.try_get<RelationshipComponent>(relationship.PrevSibling) : nullptr)
+			prev->NextSibling = relationship.NextSibling;
+		if (RelationshipComponent* next = relationship.NextSibling != entt::null ? registry.try_get<RelationshipComponent>(relationship.NextSibling) : nullptr)
+			next->PrevSibling = relationship.PrevSibling;
+
+		for (entt::entity child = relationship.FirstChild; child != entt::null;)
+		{
+			RelationshipComponent* childRelationship = registry.try_get<RelationshipComponent>(child);
+			if (!childRelationship)
+				break;
+			entt::entity next = childRelationship->NextSibling;
+			childRelationship->Parent = entt::null;
+			childRelationship->PrevSibling = entt::null;
+			childRelationship->NextSibling = entt::null;
+			if (TransformComponent* transform = registry.try_get<TransformComponent>(child))
+				transform->MarkDirty();
+			child = next;
+		}
+		MarkHierarchyChanged();
+	}
+
+	void TransformSystem::RebuildHierarchy(entt::registry& registry)
+	{
+		HZ_PROFILE_FUNCTION();
+		for (entt::entity entity : m_Entities)
+		{
+			if (!registry.valid(entity))
+				continue;
+			if (WorldTransformComponent* world = registry.try_get<WorldTransformComponent>(entity))
+				world->HierarchyIndex = WorldTransformComponent::s_NotInHierarchy;
+		}
+		m_Entities.clear();
+		m_Parent.clear();
+		m_LevelStart.clear();
+
+		// 第 0 层：有子节点的根；没有父也没有子的实体不进层级，走普通路径
+		m_LevelStart.push_back(0);
+		for (auto [entity, relationship] : registry.view<RelationshipComponent>().each())
+		{
+			if (relationship.Parent == entt::null && relationship.FirstChild != entt::null && registry.all_of<TransformComponent>(entity))
+			{
+				m_Entities.push_back(entity);
+				m_Parent.push_back(s_NoParent);
+			}
+		}
+
+		// 广度优先，一层一层展开，同一父节点的子节点连续放
+		uint32_t levelBegin = 0;
+		while (levelBegin < (uint32_t)m_Entities.size())
+		{
+			uint32_t levelEnd = (uint32_t)m_Entities.size();
+			m_LevelStart.push_back(levelEnd);
+			for (uint32_t parentIndex = levelBegin; parentIndex < levelEnd; parentIndex++)
+			{
+				const RelationshipComponent& relationship = registry.get<RelationshipComponent>(m_Entities[parentIndex]);
+				for (entt::entity child = relationship.FirstChild; child != entt::null; child = registry.get<RelationshipComponent>(child).NextSibling)
+				{
+					m_Entities.push_back(child);
+					m_Parent.push_back(parentIndex);
+				}
+			}
+			levelBegin = levelEnd;
+		}
+
+		size_t count = m_Entities.size();
+		m_Local.resize(count);
+		m_World.resize(count);
+		m_Dirty.assign(count, 0);
+		for (uint32_t i = 0; i < (uint32_t)count; i++)
+		{
+			registry.get<WorldTransformComponent>(m_Entities[i]).HierarchyIndex = i;
+			// 下标全变了，局部矩阵要重新算
+			registry.get<TransformComponent>(m_Entities[i]).MarkDirty();
+		}
+		m_HierarchyChanged = false;
+	}
+
+	size_t TransformSystem::UpdateLocalTransforms(entt::registry& registry)
+	{
+		m_ComposeInput.clear();
+		m_ComposeTargets.clear();
+
+		size_t updated = 0;
+		auto view = registry.view<TransformComponent, WorldTransformComponent>();
+		for (auto [entity, transform, world] : view.each())
+		{
+			if (!transform.Dirty)
+				continue;
+
+			transform.Dirty = false;
+			// 层级里的实体先算到局部矩阵数组，世界矩阵在 UpdateHierarchy 里逐层算
+			glm::mat4* target = &world.World;
+			if (world.HierarchyIndex != WorldTransformComponent::s_NotInHierarchy)
+			{
+				target = &m_Local[world.HierarchyIndex];
+				m_Dirty[world.HierarchyIndex] = 1;
+			}
+			else
+			{
+				updated++;
+			}
+
+			if (transform.UseQuaternion)
+			{
+				*target = transform.GetTransform();
+				continue;
+			}
+
+			TransformTRS& trs = m_ComposeInput.emplace_back();
+			trs.Translation = transform.Translation;
+			trs.Rotation = transform.Rotation;
+			trs.Scale = transform.Scale;
+			m_ComposeTargets.push_back(target);
+		}
+
+		size_t count = m_ComposeInput.size();
+		if (m_ComposeOutput.size() < count)
+			m_ComposeOutput.resize(count);
+		SimdMath::ComposeTRS(m_ComposeInput.data(), m_ComposeOutput.data(), count);
+		for (size_t i = 0; i < count; i++)
+			*m_ComposeTargets[i] = m_ComposeOutput[i];
+		return updated;
+	}
+
+	size_t TransformSystem::UpdateHierarchy(entt::registry& registry)
+	{
+		if (m_Entities.empty())
+			return 0;
+
+		HZ_PROFILE_FUNCTION();
+		std::atomic<size_t> updated{ 0 };
+		for (uint32_t level = 0; level + 1 < (uint32_t)m_LevelStart.size(); level++)
+		{
+			uint32_t levelBegin = m_LevelStart[level];
+			uint32_t levelCount = m_LevelStart[level + 1] - levelBegin;
+			JobSystem::ParallelFor(levelCount, s_LevelBatchSize, [&](uint32_t begin, uint32_t end)
+			{
+				size_t localUpdated = 0;
+				begin += levelBegin;
+				end += levelBegin;
+				for (uint32_t i = begin; i < end;)
+				{
+					uint32_t parent = m_Parent[i];
+					uint32_t runEnd = i + 1;
+					while (runEnd < end && m_Parent[runEnd] == parent)
+						runEnd++;
+
+					if (parent == s_NoParent)
+					{
+						for (uint32_t k = i; k < runEnd; k++)
+						{
+							if (m_Dirty[k])
+								m_World[k] = m_Local[k];
+						}
+					}
+					else if (m_Dirty[parent])
+					{
+						// 父节点变了，整段子节点都要跟着更新
+						SimdMath::MultiplyMatrices(m_World[parent], &m_Local[i], &m_World[i], runEnd - i);
+						std::fill(m_Dirty.begin() + i, m_Dirty.begin() + runEnd, (uint8_t)1);
+					}
+					else
+					{
+						for (uint32_t k = i; k < runEnd; k++)
+						{
+							if (m_Dirty[k])
+								SimdMath::MultiplyMatrices(m_World[parent], &m_Local[k], &m_World[k], 1);
+						}
+					}
+
+					// 只读 registry 的稀疏表，多个线程同时 get 是安全的
+					for (uint32_t k = i; k < runEnd; k++)
+					{
+						if (m_Dirty[k])
+						{
+							registry.get<WorldTransformComponent>(m_Entities[k]).World = m_World[k];
+							localUpdated++;
+						}
+					}
+					i = runEnd;
+				}
+				updated.fetch_add(localUpdated, std::memory_order_relaxed);
+			});
+		}
+
+		// 子节点读的是父节点这一帧的标记，所有层做完才能清
+		std::fill(m_Dirty.begin(), m_Dirty.end(), (uint8_t)0);
+		return updated.load(std::memory_order_relaxed);
+	}
+
+	size_t TransformSystem::Update(entt::registry& registry)
+	{
+		HZ_PROFILE_FUNCTION();
+		if (m_HierarchyChanged)
+			RebuildHierarchy(registry);
+
+		size_t updated = UpdateLocalTransforms(registry);
+		updated += UpdateHierarchy(registry);
+
+		HZ_PERF_COUNTER_ADD(TransformsUpdated, updated);
+		return updated;
+	}
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Math/SimdMath.h"
+#include "Runtime/Scene/Component.h"
+#include "entt.hpp"
+
+#include <vector>
+
+namespace Hazel
+{
+	// 维护 WorldTransformComponent，每个 Scene 一个
+	// - 只重算 Dirty 的 TransformComponent，大部分实体不动时每帧只是扫一遍标记
+	// - 欧拉角的实体收集起来一次交给 SimdMath::ComposeTRS，四元数的逐个计算
+	// - 有父子关系的实体按深度广度优先排成 SoA 数组（局部矩阵、世界矩阵、父节点下标、脏标记），
+	//   逐层线性更新：同一层之间没有依赖，大的层用 JobSystem::ParallelFor 分块；
+	//   同一个父节点的子节点相邻，父节点变化时整段用 SimdMath::MultiplyMatrices 批量相乘，
+	//   父节点没变时只算自己脏了的子节点
+	// - 层级结构（Scene::SetParent、销毁带关系的实体）变化后下一次 Update 重建数组
+	class HAZEL_API TransformSystem
+	{
+	public:
+		TransformSystem() = default;
+		TransformSystem(const TransformSystem&) = delete;
+		TransformSystem& operator=(const TransformSystem&) = delete;
+
+		// 连接 registry 的信号，Scene 构造时调用一次；Scene::RestoreSnapshot 期间临时断开
+		void Attach(entt::registry& registry);
+		void Detach(entt::registry& registry);
+		// 组件被整池替换之后调用（恢复快照），丢掉层级数组，下一次 Update 重建
+		void Reset(entt::registry& registry);
+
+		// Scene::OnUpdate 里调用；之后读 WorldTransformComponent 的系统拿到的都是本帧的值
+		// 返回重算了世界矩阵的实体数（包括因为父节点变化被带着更新的）
+		size_t Update(entt::registry& registry);
+
+		inline void MarkHierarchyChanged() { m_HierarchyChanged = true; m_HierarchyVersion++; }
+		// 每次层级结构变化加一，编辑器的层级面板用来判断缓存的行是否过期
+		inline uint32_t GetHierarchyVersion() const { return m_HierarchyVersion; }
+
+		inline size_t GetHierarchySize() const { return m_Entities.size(); }
+		inline uint32_t GetHierarchyDepth() const { return m_LevelStart.empty() ? 0 : (uint32_t)m_LevelStart.size() - 1; }
+	private:
+		static void OnTransformConstruct(entt::registry& registry, entt::entity entity);
+		static void OnTransformDestroy(entt::registry& registry, entt::entity entity);
+		void OnRelationshipDestroy(entt::registry& registry, entt::entity entity);
+
+		void RebuildHierarchy(entt::registry& registry);
+		size_t UpdateLocalTransforms(entt::registry& registry);
+		size_t UpdateHierarchy(entt::registry& registry);
+	private:
+		// 按深度排序，第 d 层是 [m_LevelStart[d], m_LevelStart[d + 1])，同一父节点的子节点相邻
+		std::vector<entt::entity> m_Entities;
+		std::vector<uint32_t> m_Parent;			// 父节点下标，根节点为 UINT32_MAX
+		std::vector<glm::mat4> m_Local;
+		std::vector<glm::mat4> m_World;
+		std::vector<uint8_t> m_Dirty;
+		std::vector<uint32_t> m_LevelStart;
+		bool m_HierarchyChanged = true;
+		uint32_t m_HierarchyVersion = 0;
+
+		// 局部矩阵批量计算用，每帧复用
+		std::vector<TransformTRS> m_ComposeInput;
+		std::vector<glm::mat4> m_ComposeOutput;
+		std::vector<glm::mat4*> m_ComposeTargets;
+	};
+}
@@ -23,15 +23,17 @@
 #include <filesystem>
 #include <mutex>
 #include "Runtime/Debug/Instrumentor.h"
+#include "Runtime/Debug/PerfCounters.h"
+#include "Runtime/Core/Memory/MemoryTracker.h"
 
 #include "boost/uuid/uuid.hpp"
 #include "Runtime/Core/Utility/Unique.h"
 
 
-#include "Platform/D3D12/d3dx12.h"
-#include "Platform/D3D12/d3dUtil.h"
-
 #ifdef HZ_PLATFORM_WINDOWS
+	#include "Platform/D3D12/d3dx12.h"
+	#include "Platform/D3D12/d3dUtil.h"
+
 	#include <Windows.h>
 #endif
 
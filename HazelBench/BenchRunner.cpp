@@ -0,0 +1,296 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Core/Time/FrameTimer.h"
+#include "Runtime/Core/Memory/Allocator/FrameArena.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace Hazel { namespace Bench {
+
+	// cap so a mis-calibrated benchmark can not run for minutes per sample
+	static constexpr uint64_t s_MaxIterations = 1ull << 30;
+
+	static const char* GetConfigurationName()
+	{
+#if defined(HZ_DIST)
+		return "Dist";
+#elif defined(HZ_RELEASE)
+		return "Release";
+#elif defined(HZ_DEBUG)
+		return "Debug";
+#else
+		return "Unknown";
+#endif
+	}
+
+	static const char* GetPlatformName()
+	{
+#if defined(HZ_PLATFORM_WINDOWS)
+		return "Windows";
+#elif defined(HZ_PLATFORM_LINUX)
+		return "Linux";
+#else
+		return "Unknown";
+#endif
+	}
+
+	static double TimeRun(Benchmark& benchmark, uint64_t iterations)
+	{
+		Clock::TimePoint start = Clock::Now();
+		benchmark.Run(iterations);
+		return Clock::ElapsedSeconds(start, Clock::Now()) * 1e9;
+	}
+
+	static double Percentile(const std::vector<double>& sorted, double p)
+	{
+		if (sorted.empty())
+			return 0.0;
+		double rank = p * (double)(sorted.size() - 1);
+		size_t lo = (size_t)rank;
+		size_t hi = std::min(lo + 1, sorted.size() - 1);
+		double t = rank - (double)lo;
+		return sorted[lo] + (sorted[hi] - sorted[lo]) * t;
+	}
+
+	static void WriteJsonString(FILE* file, const std::string& text)
+	{
+		fputc('"', file);
+		for (char c : text)
+		{
+			switch (c)
+			{
+			case '"':  fputs("\\\"", file); break;
+			case '\\': fputs("\\\\", file); break;
+			case '\n': fputs("\\n", file); break;
+			case '\t': fputs("\\t", file); break;
+			default:
+				if ((unsigned char)c < 0x20)
+					fprintf(file, "\\u%04x", (unsigned)c);
+				else
+					fputc(c, file);
+				break;
+			}
+		}
+		fputc('"', file);
+	}
+
+	void AdvanceFrame()
+	{
+		static uint64_t s_FrameIndex = 0;
+		FrameArena::Get().BeginFrame(++s_FrameIndex);
+	}
+
+	// ---------------- BenchOptions ----------------
+
+	bool BenchOptions::Parse(int argc, char** argv, BenchOptions& out)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const char* arg = argv[i];
+			auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+
+			if (strcmp(arg, "--list") == 0)
+				out.ListOnly = true;
+			else if (strcmp(arg, "--verbose") == 0)
+				out.Verbose = true;
+			else if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0)
+				return false;
+			else
+			{
+				const char* value = next();
+				if (!value)
+				{
+					fprintf(stderr, "missing value for %s\n", arg);
+					return false;
+				}
+
+				if (strcmp(arg, "--warmup") == 0)
+					out.WarmupSamples = (uint32_t)strtoul(value, nullptr, 10);
+				else if (strcmp(arg, "--samples") == 0)
+					out.Samples = std::max(1u, (uint32_t)strtoul(value, nullptr, 10));
+				else if (strcmp(arg, "--iterations") == 0)
+					out.Iterations = strtoull(value, nullptr, 10);
+				else if (strcmp(arg, "--min-sample-ms") == 0)
+					out.MinSampleMs = std::max(0.1, atof(value));
+				else if (strcmp(arg, "--filter") == 0)
+					out.Filter = value;
+				else if (strcmp(arg, "--json") == 0)
+					out.JsonPath = value;
+				else if (strcmp(arg, "--resources") == 0)
+					out.ResourceDir = value;
+				else
+				{
+					fprintf(stderr, "unknown option %s\n", arg);
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	void BenchOptions::PrintUsage(const char* exe)
+	{
+		printf("usage: %s [options]\n", exe);
+		printf("  --warmup N         untimed samples before measuring (default 3)\n");
+		printf("  --samples N        measured samples per benchmark (default 15)\n");
+		printf("  --iterations N     iterations per sample, 0 = calibrate (default 0)\n");
+		printf("  --min-sample-ms X  calibration target for one sample (default 20)\n");
+		printf("  --filter S         only run benchmarks whose name contains S\n");
+		printf("  --json PATH        write results as JSON\n");
+		printf("  --resources DIR    engine Resource directory (default ./Resource)\n");
+		printf("  --list             print benchmark names and exit\n");
+		printf("  --verbose          keep engine trace/info logs\n");
+	}
+
+	// ---------------- BenchRunner ----------------
+
+	void BenchRunner::Add(Scope<Benchmark> benchmark)
+	{
+		m_Benchmarks.push_back(std::move(benchmark));
+	}
+
+	size_t BenchRunner::RunAll()
+	{
+		m_Results.clear();
+		for (auto& benchmark : m_Benchmarks)
+		{
+			if (!m_Options.Filter.empty() && benchmark->GetName().find(m_Options.Filter) == std::string::npos)
+				continue;
+
+			if (m_Options.ListOnly)
+			{
+				printf("%s\n", benchmark->GetName().c_str());
+				continue;
+			}
+
+			printf("running %s ...\n", benchmark->GetName().c_str());
+			fflush(stdout);
+			m_Results.push_back(RunOne(*benchmark));
+		}
+		return m_Results.size();
+	}
+
+	uint64_t BenchRunner::Calibrate(Benchmark& benchmark)
+	{
+		const double targetNs = m_Options.MinSampleMs * 1e6;
+
+		uint64_t iterations = 1;
+		for (;;)
+		{
+			double elapsedNs = TimeRun(benchmark, iterations);
+			if (elapsedNs >= targetNs || iterations >= s_MaxIterations)
+				return iterations;
+
+			// aim a bit past the target, but never grow more than 10x per step
+			double scale = elapsedNs > 0.0 ? targetNs * 1.2 / elapsedNs : 10.0;
+			scale = std::min(10.0, std::max(2.0, scale));
+			iterations = std::min(s_MaxIterations, (uint64_t)((double)iterations * scale));
+		}
+	}
+
+	BenchResult BenchRunner::RunOne(Benchmark& benchmark)
+	{
+		BenchResult result;
+		result.Name = benchmark.GetName();
+		result.ItemsPerIteration = std::max<uint64_t>(1, benchmark.GetItemsPerIteration());
+
+		if (!benchmark.Setup())
+		{
+			result.Skipped = true;
+			benchmark.Teardown();
+			return result;
+		}
+
+		uint64_t iterations = m_Options.Iterations > 0 ? m_Options.Iterations : Calibrate(benchmark);
+
+		for (uint32_t i = 0; i < m_Options.WarmupSamples; i++)
+			benchmark.Run(iterations);
+
+		const double items = (double)iterations * (double)result.ItemsPerIteration;
+		std::vector<double> samples;
+		samples.reserve(m_Options.Samples);
+		for (uint32_t i = 0; i < m_Options.Samples; i++)
+			samples.push_back(TimeRun(benchmark, iterations) / items);
+
+		benchmark.Teardown();
+
+		std::sort(samples.begin(), samples.end());
+		double sum = 0.0;
+		for (double s : samples)
+			sum += s;
+		double mean = sum / (double)samples.size();
+		double variance = 0.0;
+		for (double s : samples)
+			variance += (s - mean) * (s - mean);
+
+		result.Iterations = iterations;
+		result.Samples = (uint32_t)samples.size();
+		result.MinNs = samples.front();
+		result.MaxNs = samples.back();
+		result.MedianNs = Percentile(samples, 0.5);
+		result.P95Ns = Percentile(samples, 0.95);
+		result.MeanNs = mean;
+		result.StdDevNs = samples.size() > 1 ? std::sqrt(variance / (double)(samples.size() - 1)) : 0.0;
+		return result;
+	}
+
+	void BenchRunner::PrintSummary() const
+	{
+		printf("\n%-44s %12s %12s %12s %12s %8s\n", "benchmark", "median ns", "min ns", "p95 ns", "stddev ns", "iters");
+		for (const BenchResult& r : m_Results)
+		{
+			if (r.Skipped)
+			{
+				printf("%-44s %12s\n", r.Name.c_str(), "skipped");
+				continue;
+			}
+			printf("%-44s %12.1f %12.1f %12.1f %12.1f %8llu\n", r.Name.c_str(),
+				r.MedianNs, r.MinNs, r.P95Ns, r.StdDevNs, (unsigned long long)r.Iterations);
+		}
+	}
+
+	bool BenchRunner::WriteJson(const std::string& path) const
+	{
+		FILE* file = fopen(path.c_str(), "wb");
+		if (!file)
+		{
+			HZ_CORE_ERROR("HazelBench: cannot open {0} for writing", path);
+			return false;
+		}
+
+		time_t now = time(nullptr);
+		char timestamp[32] = {};
+		strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+
+		fprintf(file, "{\n");
+		fprintf(file, "  \"timestamp\": \"%s\",\n", timestamp);
+		fprintf(file, "  \"configuration\": \"%s\",\n", GetConfigurationName());
+		fprintf(file, "  \"platform\": \"%s\",\n", GetPlatformName());
+		fprintf(file, "  \"warmup_samples\": %u,\n", m_Options.WarmupSamples);
+		fprintf(file, "  \"unit\": \"ns_per_item\",\n");
+		fprintf(file, "  \"benchmarks\": [\n");
+		for (size_t i = 0; i < m_Results.size(); i++)
+		{
+			const BenchResult& r = m_Results[i];
+			fprintf(file, "    { \"name\": ");
+			WriteJsonString(file, r.Name);
+			if (r.Skipped)
+				fprintf(file, ", \"skipped\": true");
+			else
+				fprintf(file, ", \"skipped\": false, \"iterations\": %llu, \"items_per_iteration\": %llu, \"samples\": %u, "
+					"\"min\": %.3f, \"median\": %.3f, \"mean\": %.3f, \"p95\": %.3f, \"max\": %.3f, \"stddev\": %.3f",
+					(unsigned long long)r.Iterations, (unsigned long long)r.ItemsPerIteration, r.Samples,
+					r.MinNs, r.MedianNs, r.MeanNs, r.P95Ns, r.MaxNs, r.StdDevNs);
+			fprintf(file, " }%s\n", i + 1 < m_Results.size() ? "," : "");
+		}
+		fprintf(file, "  ]\n}\n");
+		fclose(file);
+		return true;
+	}
+
+} }
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Runtime/Core/Core.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Hazel { namespace Bench {
+
+	// keeps the optimizer from dropping a result that is otherwise unused
+	template<typename T>
+	inline void DoNotOptimize(const T& value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+#else
+		const volatile char* p = reinterpret_cast<const volatile char*>(&value);
+		(void)*p;
+#endif
+	}
+
+	// starts a new FrameArena frame; benchmarks that use frame scratch memory call this every
+	// few hundred iterations so the arena is recycled like in the real main loop
+	void AdvanceFrame();
+
+	// One measured operation. The runner calls Setup once, Run(n) for every warmup and
+	// measured sample, then Teardown. Setup/Teardown are never timed.
+	class Benchmark
+	{
+	public:
+		Benchmark(const std::string& name, uint64_t itemsPerIteration = 1)
+			: m_Name(name), m_ItemsPerIteration(itemsPerIteration) {}
+		virtual ~Benchmark() = default;
+
+		// return false when the benchmark cannot run in this environment (missing resources ...),
+		// it is reported as skipped instead of failing the whole run
+		virtual bool Setup() { return true; }
+		virtual void Run(uint64_t iterations) = 0;
+		virtual void Teardown() {}
+
+		inline const std::string& GetName() const { return m_Name; }
+		// work items done by one iteration (e.g. events per frame), results are reported per item
+		inline uint64_t GetItemsPerIteration() const { return m_ItemsPerIteration; }
+	private:
+		std::string m_Name;
+		uint64_t m_ItemsPerIteration;
+	};
+
+	struct BenchOptions
+	{
+		uint32_t WarmupSamples = 3;
+		uint32_t Samples = 15;
+		// iterations per sample, 0 = calibrate until one sample takes at least MinSampleMs
+		uint64_t Iterations = 0;
+		double MinSampleMs = 20.0;
+		// substring match on the benchmark name, empty runs everything
+		std::string Filter;
+		std::string JsonPath;
+		std::string ResourceDir = "Resource";
+		bool ListOnly = false;
+		bool Verbose = false;
+
+		// --warmup N --samples N --iterations N --min-sample-ms X --filter S --json PATH
+		// --resources DIR --list --verbose
+		static bool Parse(int argc, char** argv, BenchOptions& out);
+		static void PrintUsage(const char* exe);
+	};
+
+	struct BenchResult
+	{
+		std::string Name;
+		bool Skipped = false;
+		uint64_t Iterations = 0;		// per sample
+		uint64_t ItemsPerIteration = 1;
+		uint32_t Samples = 0;
+
+		// nanoseconds per item over the measured samples
+		double MinNs = 0.0;
+		double MedianNs = 0.0;
+		double MeanNs = 0.0;
+		double P95Ns = 0.0;
+		double MaxNs = 0.0;
+		double StdDevNs = 0.0;
+	};
+
+	class BenchRunner
+	{
+	public:
+		BenchRunner(const BenchOptions& options) : m_Options(options) {}
+
+		void Add(Scope<Benchmark> benchmark);
+
+		// runs every benchmark matching the filter, returns the number of results
+		size_t RunAll();
+
+		void PrintSummary() const;
+		bool WriteJson(const std::string& path) const;
+
+		inline const BenchOptions& GetOptions() const { return m_Options; }
+		inline const std::vector<BenchResult>& GetResults() const { return m_Results; }
+	private:
+		BenchResult RunOne(Benchmark& benchmark);
+		uint64_t Calibrate(Benchmark& benchmark);
+	private:
+		BenchOptions m_Options;
+		std::vector<Scope<Benchmark>> m_Benchmarks;
+		std::vector<BenchResult> m_Results;
+	};
+
+} }
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Runtime/Graphics/Shader/Shader.h"
+
+#include <array>
+#include <string>
+#include <vector>
+
+// Shader / reflection stand-ins so Material and pipeline code can run without a GPU backend.
+// The layout mirrors a typical lit shader: per object (b0, VS), material (b1, VS+PS, shared),
+// pass (b2, PS) plus a few textures; the same block shows up in two stages on purpose so the
+// de-duplication in GetAllRegisterBlockRefs is exercised.
+namespace Hazel { namespace Bench {
+
+	class BenchShaderReflection : public ShaderReflection
+	{
+	public:
+		BenchShaderReflection()
+		{
+			ShaderRegisterBlock perObject{ "PerObject", 0, 0, 128, ShaderStage::Vertex,
+				{ { "u_ObjectToWorld", 64, 0 }, { "u_WorldToObject", 64, 64 } } };
+
+			ShaderRegisterBlock material{ "MaterialConstants", 1, 0, 64, ShaderStage::Vertex,
+				{ { "u_BaseColor", 16, 0 }, { "u_EmissionColor", 16, 16 }, { "u_TilingOffset", 16, 32 },
+				  { "u_NormalScale", 8, 48 }, { "u_Roughness", 4, 56 }, { "u_Metallic", 4, 60 } } };
+
+			ShaderRegisterBlock pass{ "PassConstants", 2, 0, 96, ShaderStage::Pixel,
+				{ { "u_ViewProjection", 64, 0 }, { "u_CameraPosition", 12, 64 }, { "u_Time", 4, 76 },
+				  { "u_LightDirection", 12, 80 }, { "u_Exposure", 4, 92 } } };
+
+			StageResourceInfo& vs = m_Stages[(uint32_t)ShaderStage::Vertex];
+			vs.stage = ShaderStage::Vertex;
+			vs.registerBlocks = { perObject, material };
+
+			material.Stage = ShaderStage::Pixel;
+			StageResourceInfo& ps = m_Stages[(uint32_t)ShaderStage::Pixel];
+			ps.stage = ShaderStage::Pixel;
+			ps.registerBlocks = { material, pass };
+			ps.resourceBindings = {
+				{ "u_AlbedoMap", ResourceType::ShaderResource, 0, 0, ShaderStage::Pixel },
+				{ "u_NormalMap", ResourceType::ShaderResource, 1, 0, ShaderStage::Pixel },
+				{ "u_MetallicRoughnessMap", ResourceType::ShaderResource, 2, 0, ShaderStage::Pixel },
+				{ "u_LinearSampler", ResourceType::Sampler, 0, 0, ShaderStage::Pixel },
+			};
+
+			for (StageResourceInfo& stage : m_Stages)
+				for (const ShaderRegisterBlock& block : stage.registerBlocks)
+					for (const ShaderParameter& param : block.Parameters)
+						stage.parameters[param.Name] = param;
+		}
+
+		virtual std::vector<StageResourceInfo> ReflectStageResources() override
+		{
+			std::vector<StageResourceInfo> result;
+			for (ShaderStage stage : GetAvailableStages())
+				result.push_back(m_Stages[(uint32_t)stage]);
+			return result;
+		}
+
+		virtual StageResourceInfo* GetStageResources(ShaderStage stage) const override
+		{
+			return HasStage(stage) ? const_cast<StageResourceInfo*>(&m_Stages[(uint32_t)stage]) : nullptr;
+		}
+
+		virtual bool HasStage(ShaderStage stage) const override
+		{
+			return stage == ShaderStage::Vertex || stage == ShaderStage::Pixel;
+		}
+
+		virtual std::vector<ShaderStage> GetAvailableStages() const override
+		{
+			return { ShaderStage::Vertex, ShaderStage::Pixel };
+		}
+
+		virtual BufferLayout ReflectVertexInputLayout() override { return BufferLayout(); }
+
+		virtual Ref<ShaderRegisterBlock> GetRegisterBlockByName(ShaderStage stage, const std::string& name) override
+		{
+			const StageResourceInfo* info = GetStageResources(stage);
+			const ShaderRegisterBlock* block = info ? info->GetRegisterBlock(name) : nullptr;
+			return block ? CreateRef<ShaderRegisterBlock>(*block) : nullptr;
+		}
+
+		virtual Ref<ShaderRegisterBlock> GetRegisterBlockByBindPoint(ShaderStage stage, uint32_t bindPoint, uint32_t space = 0) override
+		{
+			const StageResourceInfo* info = GetStageResources(stage);
+			const ShaderRegisterBlock* block = info ? info->GetRegisterBlock(bindPoint, space) : nullptr;
+			return block ? CreateRef<ShaderRegisterBlock>(*block) : nullptr;
+		}
+
+		virtual Ref<ShaderParameter> GetParameterByName(ShaderStage stage, const std::string& name) override
+		{
+			const StageResourceInfo* info = GetStageResources(stage);
+			const ShaderParameter* param = info ? info->GetParameter(name) : nullptr;
+			return param ? CreateRef<ShaderParameter>(*param) : nullptr;
+		}
+	private:
+		std::array<StageResourceInfo, (size_t)ShaderStage::Count> m_Stages;
+	};
+
+	class BenchShader : public Shader
+	{
+	public:
+		BenchShader() : m_Reflection(CreateRef<BenchShaderReflection>()) {}
+
+		virtual void Bind() const override {}
+		virtual void UnBind() const override {}
+
+		virtual void SetInt(const std::string& name, int value) override {}
+		virtual void SetFloat(const std::string& name, float value) override {}
+		virtual void SetFloat2(const std::string& name, const glm::vec2& value) override {}
+		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override {}
+		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override {}
+		virtual void SetMat4(const std::string& name, const glm::mat4& value) override {}
+		virtual void SetMat3(const std::string& name, const glm::mat3& value) override {}
+
+		virtual const std::string& GetName() const override { return m_Name; }
+		virtual const BufferLayout& GetInputLayout() const override { return m_InputLayout; }
+		virtual Ref<ShaderReflection> GetReflection() const override { return m_Reflection; }
+
+		virtual const void* GetByteCode() const override { return nullptr; }
+		virtual size_t GetByteCodeSize() const override { return 0; }
+	private:
+		std::string m_Name = "BenchLit";
+		BufferLayout m_InputLayout;
+		Ref<ShaderReflection> m_Reflection;
+	};
+
+} }
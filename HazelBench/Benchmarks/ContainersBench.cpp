@@ -0,0 +1,285 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Core/Containers/FlatHashMap.h"
+#include "Runtime/Core/Containers/SmallVector.h"
+#include "Runtime/Core/Containers/SlotMap.h"
+#include "Runtime/Core/Containers/SPSCQueue.h"
+#include "Runtime/Core/Containers/MPMCQueue.h"
+
+#include <random>
+#include <unordered_map>
+
+// Core/Containers against the std containers they replace. Every pair runs the same workload,
+// the names differ only in the last component (/std vs /Flat, /Small ...).
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_LookupsPerIteration = 256;
+
+	// material style lookup: a handful of short uniform names, every lookup hits
+	template<typename Map>
+	class StringMapFindBench : public Benchmark
+	{
+	public:
+		StringMapFindBench(const std::string& name) : Benchmark(name, s_LookupsPerIteration) {}
+
+		virtual bool Setup() override
+		{
+			static const char* s_Names[] = { "gWorldViewProj", "gWorld", "baseColor", "roughness", "metallic",
+				"emissive", "normalScale", "occlusion", "uvScale", "uvOffset", "alphaCutoff", "tint" };
+			for (uint32_t i = 0; i < sizeof(s_Names) / sizeof(s_Names[0]); i++)
+				m_Map[s_Names[i]] = i;
+			std::mt19937 rng(7);
+			for (uint32_t i = 0; i < s_LookupsPerIteration; i++)
+				m_Keys.push_back(s_Names[rng() % (sizeof(s_Names) / sizeof(s_Names[0]))]);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			uint32_t sum = 0;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (const std::string& key : m_Keys)
+				{
+					auto found = m_Map.find(key);
+					if (found != m_Map.end())
+						sum += found->second;
+				}
+			}
+			DoNotOptimize(sum);
+		}
+	private:
+		Map m_Map;
+		std::vector<std::string> m_Keys;
+	};
+
+	// large integer keyed table (resource ids), half of the lookups miss
+	template<typename Map>
+	class IntMapFindBench : public Benchmark
+	{
+	public:
+		static constexpr uint32_t s_KeyCount = 16384;
+
+		IntMapFindBench(const std::string& name) : Benchmark(name, s_LookupsPerIteration) {}
+
+		virtual bool Setup() override
+		{
+			std::mt19937_64 rng(11);
+			for (uint32_t i = 0; i < s_KeyCount; i++)
+			{
+				uint64_t key = rng();
+				m_Map[key] = i;
+				if (i % 64 == 0)
+					m_Keys.push_back(key);
+			}
+			while (m_Keys.size() < s_LookupsPerIteration)
+				m_Keys.push_back(rng());
+			std::shuffle(m_Keys.begin(), m_Keys.end(), rng);
+			m_Keys.resize(s_LookupsPerIteration);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			uint64_t sum = 0;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint64_t key : m_Keys)
+				{
+					auto found = m_Map.find(key);
+					if (found != m_Map.end())
+						sum += found->second;
+				}
+			}
+			DoNotOptimize(sum);
+		}
+	private:
+		Map m_Map;
+		std::vector<uint64_t> m_Keys;
+	};
+
+	// create / destroy churn, like the view cache when resources stream in and out
+	template<typename Map>
+	class IntMapChurnBench : public Benchmark
+	{
+	public:
+		static constexpr uint32_t s_LiveCount = 1024;
+
+		IntMapChurnBench(const std::string& name) : Benchmark(name, s_LookupsPerIteration * 2) {}
+
+		virtual bool Setup() override
+		{
+			for (uint64_t i = 0; i < s_LiveCount; i++)
+				m_Map[i * 0x9E3779B97F4A7C15ull] = i;
+			m_Next = s_LiveCount;
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint32_t i = 0; i < s_LookupsPerIteration; i++)
+				{
+					m_Map.erase((m_Next - s_LiveCount) * 0x9E3779B97F4A7C15ull);
+					m_Map[m_Next * 0x9E3779B97F4A7C15ull] = m_Next;
+					m_Next++;
+				}
+			}
+			DoNotOptimize(m_Map.size());
+		}
+
+		virtual void Teardown() override { m_Map.clear(); }
+	private:
+		Map m_Map;
+		uint64_t m_Next = 0;
+	};
+
+	// short lived lists of 1~4 elements, e.g. the views of one resource
+	template<typename Vector>
+	class ShortVectorBench : public Benchmark
+	{
+	public:
+		ShortVectorBench(const std::string& name) : Benchmark(name, s_LookupsPerIteration) {}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			uint64_t sum = 0;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint32_t i = 0; i < s_LookupsPerIteration; i++)
+				{
+					Vector values;
+					for (uint32_t j = 0; j <= (i & 3); j++)
+						values.push_back(i + j);
+					sum += values.back();
+				}
+			}
+			DoNotOptimize(sum);
+		}
+	};
+
+	struct SlotPayload
+	{
+		float Position[3];
+		uint32_t Flags;
+	};
+
+	// handle lookups into a table with holes, then one full iteration
+	class SlotMapBench : public Benchmark
+	{
+	public:
+		static constexpr uint32_t s_Count = 8192;
+
+		SlotMapBench() : Benchmark("Containers/HandleTable/LookupIterate/SlotMap", s_LookupsPerIteration + s_Count / 2) {}
+
+		virtual bool Setup() override
+		{
+			std::vector<SlotMapHandle> all;
+			for (uint32_t i = 0; i < s_Count; i++)
+				all.push_back(m_Map.Insert(SlotPayload{ { (float)i, 0.0f, 0.0f }, i }));
+			for (uint32_t i = 0; i < s_Count; i += 2)
+				m_Map.Remove(all[i]);
+			std::mt19937 rng(3);
+			for (uint32_t i = 0; i < s_LookupsPerIteration; i++)
+				m_Handles.push_back(all[(rng() % (s_Count / 2)) * 2 + 1]);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			float sum = 0.0f;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (SlotMapHandle handle : m_Handles)
+					sum += m_Map.Get(handle)->Position[0];
+				for (const SlotPayload& payload : m_Map)
+					sum += payload.Position[0];
+			}
+			DoNotOptimize(sum);
+		}
+	private:
+		SlotMap<SlotPayload> m_Map;
+		std::vector<SlotMapHandle> m_Handles;
+	};
+
+	// what the slot map replaces: ids in a node based map
+	class HandleMapBench : public Benchmark
+	{
+	public:
+		static constexpr uint32_t s_Count = 8192;
+
+		HandleMapBench() : Benchmark("Containers/HandleTable/LookupIterate/std", s_LookupsPerIteration + s_Count / 2) {}
+
+		virtual bool Setup() override
+		{
+			for (uint32_t i = 1; i < s_Count; i += 2)
+				m_Map[i] = SlotPayload{ { (float)i, 0.0f, 0.0f }, i };
+			std::mt19937 rng(3);
+			for (uint32_t i = 0; i < s_LookupsPerIteration; i++)
+				m_Handles.push_back((rng() % (s_Count / 2)) * 2 + 1);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			float sum = 0.0f;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint64_t handle : m_Handles)
+					sum += m_Map.find(handle)->second.Position[0];
+				for (const auto& [id, payload] : m_Map)
+					sum += payload.Position[0];
+			}
+			DoNotOptimize(sum);
+		}
+	private:
+		std::unordered_map<uint64_t, SlotPayload> m_Map;
+		std::vector<uint64_t> m_Handles;
+	};
+
+	// uncontended push / pop cost, the queue is drained every batch
+	template<typename Queue>
+	class QueueRoundTripBench : public Benchmark
+	{
+	public:
+		QueueRoundTripBench(const std::string& name) : Benchmark(name, s_LookupsPerIteration), m_Queue(s_LookupsPerIteration) {}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			uint64_t sum = 0;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint64_t i = 0; i < s_LookupsPerIteration; i++)
+				{
+					uint64_t value = i;
+					m_Queue.TryPush(std::move(value));
+				}
+				uint64_t value;
+				while (m_Queue.TryPop(value))
+					sum += value;
+			}
+			DoNotOptimize(sum);
+		}
+	private:
+		Queue m_Queue;
+	};
+
+	void RegisterContainerBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new StringMapFindBench<std::unordered_map<std::string, uint32_t>>("Containers/HashMap/FindString/std")));
+		runner.Add(Scope<Benchmark>(new StringMapFindBench<FlatHashMap<std::string, uint32_t>>("Containers/HashMap/FindString/Flat")));
+		runner.Add(Scope<Benchmark>(new IntMapFindBench<std::unordered_map<uint64_t, uint64_t>>("Containers/HashMap/FindInt/std")));
+		runner.Add(Scope<Benchmark>(new IntMapFindBench<FlatHashMap<uint64_t, uint64_t>>("Containers/HashMap/FindInt/Flat")));
+		runner.Add(Scope<Benchmark>(new IntMapChurnBench<std::unordered_map<uint64_t, uint64_t>>("Containers/HashMap/InsertErase/std")));
+		runner.Add(Scope<Benchmark>(new IntMapChurnBench<FlatHashMap<uint64_t, uint64_t>>("Containers/HashMap/InsertErase/Flat")));
+		runner.Add(Scope<Benchmark>(new ShortVectorBench<std::vector<uint32_t>>("Containers/ShortVector/PushBack/std")));
+		runner.Add(Scope<Benchmark>(new ShortVectorBench<SmallVector<uint32_t, 4>>("Containers/ShortVector/PushBack/Small")));
+		runner.Add(Scope<Benchmark>(new HandleMapBench()));
+		runner.Add(Scope<Benchmark>(new SlotMapBench()));
+		runner.Add(Scope<Benchmark>(new QueueRoundTripBench<MPMCQueue<uint64_t>>("Containers/Queue/RoundTrip/MPMC")));
+		runner.Add(Scope<Benchmark>(new QueueRoundTripBench<SPSCQueue<uint64_t>>("Containers/Queue/RoundTrip/SPSC")));
+	}
+
+} }
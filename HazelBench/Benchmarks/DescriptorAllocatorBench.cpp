@@ -0,0 +1,96 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Platform/Null/NullDescriptorAllocator.h"
+
+// Descriptor allocate / free patterns. The Null allocator uses the same free list strategy as
+// D3D12DescriptorAllocator, so this measures the bookkeeping without touching a device.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_AllocationsPerIteration = 64;
+
+	// mostly single SRVs with the occasional table, roughly what a material / render target load does
+	static constexpr uint32_t s_AllocationSizes[] = { 1, 1, 1, 4, 1, 1, 8, 1, 2, 1, 1, 4, 1, 1, 1, 16 };
+
+	// allocate a burst, free every other one, allocate again (free list reuse), then release all
+	class PersistentDescriptorBench : public Benchmark
+	{
+	public:
+		PersistentDescriptorBench() : Benchmark("DescriptorAllocator/AllocateFree", s_AllocationsPerIteration * 2) {}
+
+		virtual bool Setup() override
+		{
+			m_Allocator = Scope<NullDescriptorAllocator>(new NullDescriptorAllocator(DescriptorHeapType::CbvSrvUav, 4096));
+			m_Allocations.resize(s_AllocationsPerIteration);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			constexpr uint32_t sizeCount = (uint32_t)(sizeof(s_AllocationSizes) / sizeof(s_AllocationSizes[0]));
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint32_t i = 0; i < s_AllocationsPerIteration; i++)
+					m_Allocations[i] = m_Allocator->Allocate(s_AllocationSizes[i % sizeCount]);
+
+				for (uint32_t i = 0; i < s_AllocationsPerIteration; i += 2)
+					m_Allocator->Free(m_Allocations[i]);
+				for (uint32_t i = 0; i < s_AllocationsPerIteration; i += 2)
+					m_Allocations[i] = m_Allocator->Allocate(s_AllocationSizes[i % sizeCount]);
+
+				for (uint32_t i = 0; i < s_AllocationsPerIteration; i++)
+					m_Allocator->Free(m_Allocations[i]);
+				// the free list is not coalesced, start every iteration from the same state
+				m_Allocator->Reset();
+			}
+			DoNotOptimize(m_Allocations.back());
+		}
+
+		virtual void Teardown() override
+		{
+			m_Allocations.clear();
+			m_Allocator.reset();
+		}
+	private:
+		Scope<NullDescriptorAllocator> m_Allocator;
+		std::vector<DescriptorAllocation> m_Allocations;
+	};
+
+	// per frame transient descriptors: linear allocation, one reset per frame
+	class FrameDescriptorBench : public Benchmark
+	{
+	public:
+		FrameDescriptorBench() : Benchmark("DescriptorAllocator/FrameLinear", s_AllocationsPerIteration) {}
+
+		virtual bool Setup() override
+		{
+			m_Allocator = Scope<NullFrameDescriptorAllocator>(new NullFrameDescriptorAllocator(DescriptorHeapType::CbvSrvUav, 4096));
+			m_Allocator->Initialize();
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			constexpr uint32_t sizeCount = (uint32_t)(sizeof(s_AllocationSizes) / sizeof(s_AllocationSizes[0]));
+			DescriptorAllocation last;
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				for (uint32_t i = 0; i < s_AllocationsPerIteration; i++)
+					last = m_Allocator->Allocate(s_AllocationSizes[i % sizeCount]);
+				m_Allocator->Reset();
+			}
+			DoNotOptimize(last);
+		}
+
+		virtual void Teardown() override { m_Allocator.reset(); }
+	private:
+		Scope<NullFrameDescriptorAllocator> m_Allocator;
+	};
+
+	void RegisterDescriptorAllocatorBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new PersistentDescriptorBench()));
+		runner.Add(Scope<Benchmark>(new FrameDescriptorBench()));
+	}
+
+} }
@@ -0,0 +1,209 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Core/Core.h"
+#include "Runtime/Core/Events/Event.h"
+#include "Runtime/Core/Events/ApplicationEvent.h"
+#include "Runtime/Core/Events/KeyEvent.h"
+#include "Runtime/Core/Events/MouseEvent.h"
+#include "Runtime/Core/Events/EventDispatchTable.h"
+#include "Runtime/Core/Layer/Layer.h"
+#include "Runtime/Core/Layer/LayerStack.h"
+
+// Compares the old EventDispatcher + std::bind path of Application::OnEvent with the
+// EventDispatchTable path, 10k mixed events per frame walked through the same layer setup.
+// Results are per event.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_EventsPerFrame = 10000;
+	static constexpr uint32_t s_LayerCount = 4;
+
+	static uint64_t s_Sink = 0;
+
+	// === std::function path ===
+	class LegacyLayer : public Layer
+	{
+	public:
+		LegacyLayer() : Layer("LegacyLayer") {}
+
+		virtual void OnEvent(Event& e) override
+		{
+			EventDispatcher dispatcher(e);
+			dispatcher.Dispatch<MouseScrolledEvent>(HZ_BIND_EVENT_FN(LegacyLayer::OnMouseScrolled));
+			dispatcher.Dispatch<WindowResizeEvent>(HZ_BIND_EVENT_FN(LegacyLayer::OnWindowResized));
+		}
+	private:
+		bool OnMouseScrolled(MouseScrolledEvent& e) { s_Sink += (uint64_t)e.GetYOffset(); return false; }
+		bool OnWindowResized(WindowResizeEvent& e) { s_Sink += e.GetWidth(); return false; }
+	};
+
+	class LegacyApp
+	{
+	public:
+		LegacyApp()
+		{
+			for (uint32_t i = 0; i < s_LayerCount; i++)
+				m_LayerStack.PushLayer(new LegacyLayer());
+		}
+
+		void OnEvent(Event& e)
+		{
+			EventDispatcher dispatcher(e);
+			dispatcher.Dispatch<WindowCloseEvent>(std::bind(&LegacyApp::OnWindowClose, this, std::placeholders::_1));
+			dispatcher.Dispatch<WindowResizeEvent>(std::bind(&LegacyApp::OnWindowResize, this, std::placeholders::_1));
+			dispatcher.Dispatch<MouseButtonPressedEvent>(std::bind(&LegacyApp::OnMouseButtonPressed, this, std::placeholders::_1));
+			dispatcher.Dispatch<AppActiveEvent>(std::bind(&LegacyApp::OnAppActiveStateChange, this, std::placeholders::_1));
+
+			for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); )
+			{
+				(*--it)->OnEvent(e);
+				if (e.Handled)
+					break;
+			}
+		}
+	private:
+		bool OnWindowClose(WindowCloseEvent& e) { s_Sink++; return false; }
+		bool OnWindowResize(WindowResizeEvent& e) { s_Sink += e.GetHeight(); return false; }
+		bool OnMouseButtonPressed(MouseButtonPressedEvent& e) { s_Sink += e.GetMouseButton(); return false; }
+		bool OnAppActiveStateChange(AppActiveEvent& e) { s_Sink++; return false; }
+	private:
+		LayerStack m_LayerStack;
+	};
+
+	// === EventDispatchTable path ===
+	class TableLayer : public Layer
+	{
+	public:
+		TableLayer() : Layer("TableLayer") {}
+
+		virtual void OnAttach() override
+		{
+			m_EventHandlers.Bind<&TableLayer::OnMouseScrolled>(this);
+			m_EventHandlers.Bind<&TableLayer::OnWindowResized>(this);
+		}
+	private:
+		bool OnMouseScrolled(MouseScrolledEvent& e) { s_Sink += (uint64_t)e.GetYOffset(); return false; }
+		bool OnWindowResized(WindowResizeEvent& e) { s_Sink += e.GetWidth(); return false; }
+	};
+
+	class TableApp
+	{
+	public:
+		TableApp()
+		{
+			m_EventHandlers.Bind<&TableApp::OnWindowClose>(this);
+			m_EventHandlers.Bind<&TableApp::OnWindowResize>(this);
+			m_EventHandlers.Bind<&TableApp::OnMouseButtonPressed>(this);
+			m_EventHandlers.Bind<&TableApp::OnAppActiveStateChange>(this);
+
+			for (uint32_t i = 0; i < s_LayerCount; i++)
+			{
+				Layer* layer = new TableLayer();
+				m_LayerStack.PushLayer(layer);
+				layer->OnAttach();
+			}
+		}
+
+		void OnEvent(Event& e)
+		{
+			m_EventHandlers.Dispatch(e);
+
+			for (auto it = m_LayerStack.end(); it != m_LayerStack.begin(); )
+			{
+				(*--it)->OnEvent(e);
+				if (e.Handled)
+					break;
+			}
+		}
+	private:
+		bool OnWindowClose(WindowCloseEvent& e) { s_Sink++; return false; }
+		bool OnWindowResize(WindowResizeEvent& e) { s_Sink += e.GetHeight(); return false; }
+		bool OnMouseButtonPressed(MouseButtonPressedEvent& e) { s_Sink += e.GetMouseButton(); return false; }
+		bool OnAppActiveStateChange(AppActiveEvent& e) { s_Sink++; return false; }
+	private:
+		EventDispatchTable m_EventHandlers;
+		LayerStack m_LayerStack;
+	};
+
+	// a typical input heavy mix: mostly mouse moves, some keys, scrolls and clicks
+	struct EventSet
+	{
+		std::vector<MouseMovedEvent> Moves;
+		std::vector<KeyPressedEvent> Keys;
+		std::vector<MouseScrolledEvent> Scrolls;
+		std::vector<MouseButtonPressedEvent> Clicks;
+		std::vector<WindowResizeEvent> Resizes;
+		std::vector<Event*> Order;
+
+		EventSet()
+		{
+			Moves.reserve(s_EventsPerFrame);
+			Keys.reserve(s_EventsPerFrame);
+			Scrolls.reserve(s_EventsPerFrame);
+			Clicks.reserve(s_EventsPerFrame);
+			Resizes.reserve(s_EventsPerFrame);
+			Order.reserve(s_EventsPerFrame);
+
+			for (uint32_t i = 0; i < s_EventsPerFrame; i++)
+			{
+				switch (i % 10)
+				{
+				case 0: case 1: case 2: case 3: case 4: case 5:
+					Moves.emplace_back((float)i, (float)i); Order.push_back(&Moves.back()); break;
+				case 6: case 7:
+					Keys.emplace_back((int)(i % 128), 0); Order.push_back(&Keys.back()); break;
+				case 8:
+					Scrolls.emplace_back(0.0f, 1.0f); Order.push_back(&Scrolls.back()); break;
+				default:
+					if (i % 100 == 9) { Resizes.emplace_back(1280u, 720u, false, false); Order.push_back(&Resizes.back()); }
+					else { Clicks.emplace_back(0); Order.push_back(&Clicks.back()); }
+					break;
+				}
+			}
+		}
+	};
+
+	// one iteration = one frame worth of events walked through the app and its layers
+	template<typename App>
+	class EventDispatchBench : public Benchmark
+	{
+	public:
+		EventDispatchBench(const std::string& name) : Benchmark(name, s_EventsPerFrame) {}
+
+		virtual bool Setup() override
+		{
+			m_Events = Scope<EventSet>(new EventSet());
+			m_App = Scope<App>(new App());
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t frame = 0; frame < iterations; frame++)
+			{
+				for (Event* e : m_Events->Order)
+				{
+					e->Handled = false;
+					m_App->OnEvent(*e);
+				}
+			}
+			DoNotOptimize(s_Sink);
+		}
+
+		virtual void Teardown() override
+		{
+			m_App.reset();
+			m_Events.reset();
+		}
+	private:
+		Scope<EventSet> m_Events;
+		Scope<App> m_App;
+	};
+
+	void RegisterEventDispatchBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new EventDispatchBench<LegacyApp>("EventDispatch/EventDispatcher+bind")));
+		runner.Add(Scope<Benchmark>(new EventDispatchBench<TableApp>("EventDispatch/EventDispatchTable")));
+	}
+
+} }
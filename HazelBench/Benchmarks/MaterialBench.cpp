@@ -0,0 +1,100 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+#include "BenchShader.h"
+
+#include "Runtime/Graphics/Material/Material.h"
+
+// Material property writes and the property -> constant buffer copy done before every draw.
+namespace Hazel { namespace Bench {
+
+	class MaterialCreateBench : public Benchmark
+	{
+	public:
+		MaterialCreateBench() : Benchmark("Material/Create") {}
+
+		virtual bool Setup() override
+		{
+			m_Shader = CreateRef<BenchShader>();
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				Ref<Material> material = Material::Create(m_Shader);
+				DoNotOptimize(material);
+				if ((i & 255) == 255)
+					AdvanceFrame();
+			}
+		}
+
+		virtual void Teardown() override { m_Shader.reset(); }
+	private:
+		Ref<Shader> m_Shader;
+	};
+
+	// three writes per iteration: a vec4, a float and a matrix, like a per-object material update
+	class MaterialSetBench : public Benchmark
+	{
+	public:
+		MaterialSetBench() : Benchmark("Material/Set", 3) {}
+
+		virtual bool Setup() override
+		{
+			m_Material = Material::Create(CreateRef<BenchShader>());
+			return m_Material->HasProperty("u_BaseColor");
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				float t = (float)(i & 1023);
+				m_Material->Set("u_BaseColor", glm::vec4(t, 0.5f, 0.25f, 1.0f));
+				m_Material->Set("u_Roughness", t * 0.001f);
+				m_Material->Set("u_ObjectToWorld", glm::mat4(t));
+			}
+		}
+
+		virtual void Teardown() override { m_Material.reset(); }
+	private:
+		Ref<Material> m_Material;
+	};
+
+	class MaterialSyncBench : public Benchmark
+	{
+	public:
+		MaterialSyncBench() : Benchmark("Material/SyncToRawData") {}
+
+		virtual bool Setup() override
+		{
+			m_Material = Material::Create(CreateRef<BenchShader>());
+			return m_Material->HasPropertyBlock(1);
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				m_Material->Set("u_Metallic", (float)(i & 1023) * 0.001f);
+				m_Material->SyncToRawData();
+				if ((i & 255) == 255)
+					AdvanceFrame();
+			}
+			DoNotOptimize(m_Material->GetPropertyBlock(1)->RawData[15]);
+		}
+
+		virtual void Teardown() override { m_Material.reset(); }
+	private:
+		Ref<Material> m_Material;
+	};
+
+	void RegisterMaterialBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new MaterialCreateBench()));
+		runner.Add(Scope<Benchmark>(new MaterialSetBench()));
+		runner.Add(Scope<Benchmark>(new MaterialSyncBench()));
+	}
+
+} }
@@ -0,0 +1,74 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Graphics/Mesh/Mesh.h"
+
+#include <cctype>
+
+// Mesh::LoadMesh on every model under Resource/Resources/Models (assimp import + vertex stream
+// split + buffer creation on the Null backend). One benchmark per file.
+namespace Hazel { namespace Bench {
+
+	class MeshLoadBench : public Benchmark
+	{
+	public:
+		MeshLoadBench(const std::string& name, const std::string& path)
+			: Benchmark(name), m_Path(path) {}
+
+		virtual bool Setup() override
+		{
+			if (!std::filesystem::exists(m_Path))
+				return false;
+			// make sure the file actually imports, otherwise we would time the error path
+			Ref<Mesh> mesh = Mesh::Create();
+			return mesh->LoadMesh(m_Path);
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				Ref<Mesh> mesh = Mesh::Create();
+				bool loaded = mesh->LoadMesh(m_Path);
+				DoNotOptimize(loaded);
+			}
+		}
+	private:
+		std::string m_Path;
+	};
+
+	void RegisterMeshBenches(BenchRunner& runner)
+	{
+		std::filesystem::path modelDir = std::filesystem::path(runner.GetOptions().ResourceDir) / "Resources" / "Models";
+
+		std::vector<std::filesystem::path> models;
+		std::error_code error;
+		if (std::filesystem::is_directory(modelDir, error))
+		{
+			for (const auto& entry : std::filesystem::recursive_directory_iterator(modelDir, error))
+			{
+				if (!entry.is_regular_file())
+					continue;
+				std::string extension = entry.path().extension().string();
+				std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+				if (extension == ".obj" || extension == ".fbx")
+					models.push_back(entry.path());
+			}
+		}
+		std::sort(models.begin(), models.end());
+
+		// still list the benchmark so a missing resource directory shows up as skipped
+		if (models.empty())
+		{
+			runner.Add(Scope<Benchmark>(new MeshLoadBench("Mesh/LoadMesh", modelDir.string())));
+			return;
+		}
+
+		for (const auto& model : models)
+		{
+			std::string name = "Mesh/LoadMesh/" + std::filesystem::relative(model, modelDir, error).generic_string();
+			runner.Add(Scope<Benchmark>(new MeshLoadBench(name, model.string())));
+		}
+	}
+
+} }
@@ -0,0 +1,125 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+#include "BenchShader.h"
+
+#include "Platform/Null/NullPipelineStateManager.h"
+
+// Pipeline description hashing (shared by the D3D12 and Null backends) and the cache lookup
+// that every draw goes through.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_DescCount = 64;
+
+	// exposes the protected hash so it can be timed on its own
+	class BenchPipelineStateManager : public NullPipelineStateManager
+	{
+	public:
+		using NullPipelineStateManager::HashPipelineDesc;
+	};
+
+	// a spread of states similar to what a frame with opaque, transparent and shadow passes uses
+	static std::vector<GraphicsPipelineDesc> MakePipelineDescs(const std::vector<Ref<Shader>>& shaders)
+	{
+		std::vector<GraphicsPipelineDesc> descs;
+		descs.reserve(s_DescCount);
+		for (uint32_t i = 0; i < s_DescCount; i++)
+		{
+			GraphicsPipelineDesc desc;
+			desc.SetShader(shaders[i % shaders.size()]);
+			desc.SetRasterizerState((i & 1) ? RasterizerStateDesc::NoCull() : RasterizerStateDesc::Default());
+			desc.SetBlendState((i & 2) ? BlendStateDesc::AlphaBlend() : BlendStateDesc::Opaque());
+			desc.SetDepthStencilState((i & 4) ? DepthStencilStateDesc::ReadOnly() : DepthStencilStateDesc::Default());
+			desc.rasterizerState.depthBias = (float)(i / 8);
+			desc.colorFormat = (i & 8) ? GraphicsPipelineDesc::TextureFormat::RGBA16F : GraphicsPipelineDesc::TextureFormat::RGBA8;
+			descs.push_back(desc);
+		}
+		return descs;
+	}
+
+	class PipelineHashBench : public Benchmark
+	{
+	public:
+		PipelineHashBench() : Benchmark("PipelineState/HashPipelineDesc", s_DescCount) {}
+
+		virtual bool Setup() override
+		{
+			for (uint32_t i = 0; i < 8; i++)
+				m_Shaders.push_back(CreateRef<BenchShader>());
+			m_Descs = MakePipelineDescs(m_Shaders);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			uint64_t hash = 0;
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (const GraphicsPipelineDesc& desc : m_Descs)
+					hash ^= m_Manager.HashPipelineDesc(desc);
+			}
+			DoNotOptimize(hash);
+		}
+
+		virtual void Teardown() override
+		{
+			m_Descs.clear();
+			m_Shaders.clear();
+		}
+	private:
+		BenchPipelineStateManager m_Manager;
+		std::vector<Ref<Shader>> m_Shaders;
+		std::vector<GraphicsPipelineDesc> m_Descs;
+	};
+
+	// every lookup hits, this is the steady state cost of GetOrCreatePipeline per draw
+	class PipelineCacheHitBench : public Benchmark
+	{
+	public:
+		PipelineCacheHitBench() : Benchmark("PipelineState/GetOrCreatePipeline(hit)", s_DescCount) {}
+
+		virtual bool Setup() override
+		{
+			for (uint32_t i = 0; i < 8; i++)
+				m_Shaders.push_back(CreateRef<BenchShader>());
+			m_Descs = MakePipelineDescs(m_Shaders);
+
+			m_Manager = Scope<BenchPipelineStateManager>(new BenchPipelineStateManager());
+			// keep the pipelines alive, the cache only holds weak references
+			for (const GraphicsPipelineDesc& desc : m_Descs)
+				m_Pipelines.push_back(m_Manager->GetOrCreatePipeline(desc));
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (const GraphicsPipelineDesc& desc : m_Descs)
+				{
+					Ref<IGraphicsPipeline> pipeline = m_Manager->GetOrCreatePipeline(desc);
+					DoNotOptimize(pipeline);
+				}
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			m_Pipelines.clear();
+			m_Manager.reset();
+			m_Descs.clear();
+			m_Shaders.clear();
+		}
+	private:
+		Scope<BenchPipelineStateManager> m_Manager;
+		std::vector<Ref<IGraphicsPipeline>> m_Pipelines;
+		std::vector<Ref<Shader>> m_Shaders;
+		std::vector<GraphicsPipelineDesc> m_Descs;
+	};
+
+	void RegisterPipelineStateBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new PipelineHashBench()));
+		runner.Add(Scope<Benchmark>(new PipelineCacheHitBench()));
+	}
+
+} }
@@ -0,0 +1,118 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Platform/Null/NullBuffer.h"
+#include "Platform/Null/NullCommandList.h"
+#include "Platform/Null/NullRHIStats.h"
+#include "Platform/Null/NullVertexArray.h"
+
+// Cost of the per-draw RHI calls through the interfaces against the same calls on the concrete
+// Null types, which is what a static dispatch build (--rhi-static) compiles the hot path to.
+// Both variants do identical work inside the Null backend, the difference is the dispatch.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_DrawsPerIteration = 256;
+	static constexpr uint32_t s_MeshCount = 16;
+	static constexpr uint32_t s_BufferCount = 256;
+
+	// the same recording loop is instantiated once with the interface and once with the final type
+	template<typename CommandListT>
+	static void RecordDraws(CommandListT& cmdList, const std::vector<Ref<VertexArray>>& meshes)
+	{
+		cmdList.Reset();
+		for (uint32_t i = 0; i < s_DrawsPerIteration; i++)
+		{
+			// a few draws per mesh, like a sorted queue
+			cmdList.SetVertexArray(meshes[(i / 4) % meshes.size()]);
+			cmdList.DrawIndexed(36);
+		}
+		cmdList.Close();
+	}
+
+	// Static = true records through NullCommandList (direct calls), false through CommandList (virtual calls)
+	template<bool Static>
+	class CommandListDispatchBench : public Benchmark
+	{
+	public:
+		CommandListDispatchBench(const std::string& name) : Benchmark(name, s_DrawsPerIteration) {}
+
+		virtual bool Setup() override
+		{
+			m_CommandList = CreateRef<NullCommandList>();
+			for (uint32_t i = 0; i < s_MeshCount; i++)
+				m_Meshes.push_back(CreateRef<NullVertexArray>());
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				if (Static)
+					RecordDraws(static_cast<NullCommandList&>(*m_CommandList), m_Meshes);
+				else
+					RecordDraws(*m_CommandList, m_Meshes);
+				DoNotOptimize(m_CommandList->GetCommandCount());
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			m_Meshes.clear();
+			m_CommandList.reset();
+			NullRHIStats::Reset();
+		}
+	private:
+		Ref<CommandList> m_CommandList;
+		std::vector<Ref<VertexArray>> m_Meshes;
+	};
+
+	// interface -> backend buffer conversion that every draw did in SceneViewLayer before RHICast
+	template<bool Static>
+	class BufferCastBench : public Benchmark
+	{
+	public:
+		BufferCastBench(const std::string& name) : Benchmark(name, s_BufferCount) {}
+
+		virtual bool Setup() override
+		{
+			float vertices[12] = {};
+			for (uint32_t i = 0; i < s_BufferCount; i++)
+				m_Buffers.push_back(CreateRef<NullVertexBuffer>(vertices, (uint32_t)sizeof(vertices), 12));
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			size_t bytes = 0;
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				for (const Ref<VertexBuffer>& buffer : m_Buffers)
+				{
+					const NullVertexBuffer* nullBuffer = Static
+						? static_cast<const NullVertexBuffer*>(buffer.get())
+						: dynamic_cast<const NullVertexBuffer*>(buffer.get());
+					bytes += nullBuffer->GetData().size();
+				}
+			}
+			DoNotOptimize(bytes);
+		}
+
+		virtual void Teardown() override
+		{
+			m_Buffers.clear();
+			NullRHIStats::Reset();
+		}
+	private:
+		std::vector<Ref<VertexBuffer>> m_Buffers;
+	};
+
+	void RegisterRHIDispatchBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new CommandListDispatchBench<false>("RHI/RecordDraws/Virtual")));
+		runner.Add(Scope<Benchmark>(new CommandListDispatchBench<true>("RHI/RecordDraws/Static")));
+		runner.Add(Scope<Benchmark>(new BufferCastBench<false>("RHI/BufferCast/dynamic_cast")));
+		runner.Add(Scope<Benchmark>(new BufferCastBench<true>("RHI/BufferCast/static_cast")));
+	}
+
+} }
@@ -0,0 +1,116 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Scene/Scene.h"
+#include "Runtime/Scene/Entity.h"
+#include "Runtime/Scene/SceneSerializer.h"
+
+#include <filesystem>
+#include <random>
+
+// Building the same scene through Scene::CreateEntity + AddComponent one entity at a time against
+// SceneSerializer::DeserializeBinary from a memory-mapped file. Both include destroying the scene,
+// results are per entity so 1M entities is the reported time * 1e6.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_SceneEntityCount = 100000;
+
+	struct SceneEntityDesc
+	{
+		glm::vec3 Translation;
+		glm::vec3 Rotation;
+		glm::vec4 Color;
+	};
+
+	class SceneLoadBench : public Benchmark
+	{
+	public:
+		SceneLoadBench(const std::string& name, bool binary)
+			: Benchmark(name, s_SceneEntityCount), m_Binary(binary) {}
+
+		virtual bool Setup() override
+		{
+			std::mt19937 rng(37);
+			std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+			m_Descs.resize(s_SceneEntityCount);
+			for (SceneEntityDesc& desc : m_Descs)
+			{
+				desc.Translation = glm::vec3(unit(rng), unit(rng), unit(rng)) * 500.0f;
+				desc.Rotation = glm::vec3(0.0f, unit(rng) * 180.0f, 0.0f);
+				desc.Color = glm::vec4(unit(rng), unit(rng), unit(rng), 1.0f);
+			}
+
+			if (m_Binary)
+			{
+				Scope<Scene> scene = BuildScene();
+				m_Path = (std::filesystem::temp_directory_path() / "HazelBenchScene.hzscene").string();
+				if (!SceneSerializer::SerializeBinary(*scene, m_Path))
+					return false;
+
+				// a loader that rejects the file would otherwise be timed as a fast no-op
+				Scene loaded;
+				if (!SceneSerializer::DeserializeBinary(loaded, m_Path)
+					|| loaded.Reg().view<TransformComponent>().size() != s_SceneEntityCount)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				Scope<Scene> scene;
+				if (m_Binary)
+				{
+					scene.reset(new Scene());
+					bool loaded = SceneSerializer::DeserializeBinary(*scene, m_Path);
+					HZ_CORE_ASSERT(loaded, "SceneLoadBench: DeserializeBinary failed");
+				}
+				else
+				{
+					scene = BuildScene();
+				}
+				DoNotOptimize(scene->Reg().view<TransformComponent>().size());
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			m_Descs.clear();
+			if (!m_Path.empty())
+			{
+				std::error_code error;
+				std::filesystem::remove(m_Path, error);
+				m_Path.clear();
+			}
+		}
+	private:
+		Scope<Scene> BuildScene() const
+		{
+			Scope<Scene> scene(new Scene());
+			for (const SceneEntityDesc& desc : m_Descs)
+			{
+				Entity entity = scene->CreateEntity("Entity");
+				TransformComponent& transform = entity.GetComponent<TransformComponent>();
+				transform.Translation = desc.Translation;
+				transform.Rotation = desc.Rotation;
+				entity.AddComponent<SpriteRendererComponent>(desc.Color);
+			}
+			return scene;
+		}
+	private:
+		bool m_Binary;
+		std::vector<SceneEntityDesc> m_Descs;
+		std::string m_Path;
+	};
+
+	void RegisterSceneSerializerBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new SceneLoadBench("Scene/Load/CreateEntity(100k)", false)));
+		runner.Add(Scope<Benchmark>(new SceneLoadBench("Scene/Load/Binary(100k)", true)));
+	}
+
+} }
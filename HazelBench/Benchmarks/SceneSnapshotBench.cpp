@@ -0,0 +1,123 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Scene/Scene.h"
+#include "Runtime/Scene/Entity.h"
+
+#include <random>
+
+// Saving a scene before play mode and bringing it back afterwards.
+// PerEntityCopy copies every entity into a second Scene through CreateEntity/AddComponent (what an
+// editor without snapshots does), Snapshot copies whole pools, Incremental re-snapshots after moving
+// a few entities so only the Transform pool is copied, Restore writes a snapshot back over a scene
+// whose transforms were changed. Results are per entity.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_SnapshotEntityCount = 100000;
+	static constexpr uint32_t s_SnapshotMovedCount = 100;
+
+	enum class SnapshotBenchMode
+	{
+		PerEntityCopy,
+		Snapshot,
+		Incremental,
+		Restore
+	};
+
+	class SceneSnapshotBench : public Benchmark
+	{
+	public:
+		SceneSnapshotBench(const std::string& name, SnapshotBenchMode mode)
+			: Benchmark(name, s_SnapshotEntityCount), m_Mode(mode) {}
+
+		virtual bool Setup() override
+		{
+			std::mt19937 rng(41);
+			std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+			m_Scene.reset(new Scene());
+			m_Entities.clear();
+			m_Entities.reserve(s_SnapshotEntityCount);
+			for (uint32_t i = 0; i < s_SnapshotEntityCount; i++)
+			{
+				Entity entity = m_Scene->CreateEntity("Entity");
+				entity.GetComponent<TransformComponent>().Translation = glm::vec3(unit(rng), unit(rng), unit(rng)) * 500.0f;
+				entity.AddComponent<SpriteRendererComponent>(glm::vec4(unit(rng), unit(rng), unit(rng), 1.0f));
+				m_Entities.push_back(entity);
+			}
+			m_Scene->OnUpdate(0.0f);
+
+			m_Baseline = m_Scene->CreateSnapshot();
+			return m_Baseline->GetEntityCount() >= s_SnapshotEntityCount;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				switch (m_Mode)
+				{
+				case SnapshotBenchMode::PerEntityCopy:
+				{
+					Scope<Scene> copy(new Scene());
+					for (Entity entity : m_Entities)
+					{
+						Entity target = copy->CreateEntity(entity.GetComponent<TagComponent>().Tag);
+						target.GetComponent<TransformComponent>() = entity.GetComponent<TransformComponent>();
+						target.AddComponent<SpriteRendererComponent>(entity.GetComponent<SpriteRendererComponent>());
+					}
+					DoNotOptimize(copy->Reg().view<TransformComponent>().size());
+					break;
+				}
+				case SnapshotBenchMode::Snapshot:
+				{
+					Ref<SceneSnapshot> snapshot = m_Scene->CreateSnapshot();
+					DoNotOptimize(snapshot->GetMemoryUsage());
+					break;
+				}
+				case SnapshotBenchMode::Incremental:
+				{
+					MoveEntities((float)i);
+					Ref<SceneSnapshot> snapshot = m_Scene->CreateSnapshot(m_Baseline.get());
+					DoNotOptimize(snapshot->GetCapturedMemoryUsage());
+					break;
+				}
+				case SnapshotBenchMode::Restore:
+				{
+					MoveEntities((float)i);
+					m_Scene->RestoreSnapshot(*m_Baseline);
+					DoNotOptimize(m_Scene->Reg().view<TransformComponent>().size());
+					break;
+				}
+				}
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			m_Baseline.reset();
+			m_Entities.clear();
+			m_Scene.reset();
+		}
+	private:
+		void MoveEntities(float offset)
+		{
+			const uint32_t stride = s_SnapshotEntityCount / s_SnapshotMovedCount;
+			for (uint32_t i = 0; i < s_SnapshotEntityCount; i += stride)
+				m_Entities[i].GetComponent<TransformComponent>().Translation.x += offset + 1.0f;
+		}
+	private:
+		SnapshotBenchMode m_Mode;
+		Scope<Scene> m_Scene;
+		std::vector<Entity> m_Entities;
+		Ref<SceneSnapshot> m_Baseline;
+	};
+
+	void RegisterSceneSnapshotBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new SceneSnapshotBench("Scene/Snapshot/PerEntityCopy(100k)", SnapshotBenchMode::PerEntityCopy)));
+		runner.Add(Scope<Benchmark>(new SceneSnapshotBench("Scene/Snapshot/Snapshot(100k)", SnapshotBenchMode::Snapshot)));
+		runner.Add(Scope<Benchmark>(new SceneSnapshotBench("Scene/Snapshot/Incremental(100k)", SnapshotBenchMode::Incremental)));
+		runner.Add(Scope<Benchmark>(new SceneSnapshotBench("Scene/Snapshot/Restore(100k)", SnapshotBenchMode::Restore)));
+	}
+
+} }
@@ -0,0 +1,69 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+#include "BenchShader.h"
+
+// Register block collection, called by Material on creation and on every SyncToRawData.
+namespace Hazel { namespace Bench {
+
+	class GetAllRegisterBlocksBench : public Benchmark
+	{
+	public:
+		GetAllRegisterBlocksBench() : Benchmark("ShaderReflection/GetAllRegisterBlocks") {}
+
+		virtual bool Setup() override
+		{
+			m_Reflection = CreateRef<BenchShaderReflection>();
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				std::vector<ShaderRegisterBlock> blocks = m_Reflection->GetAllRegisterBlocks();
+				DoNotOptimize(blocks.data());
+				if ((i & 255) == 255)
+					AdvanceFrame();
+			}
+		}
+
+		virtual void Teardown() override { m_Reflection.reset(); }
+	private:
+		Ref<ShaderReflection> m_Reflection;
+	};
+
+	// the pointer-only variant used on the hot paths, scratch comes from the FrameArena
+	class GetAllRegisterBlockRefsBench : public Benchmark
+	{
+	public:
+		GetAllRegisterBlockRefsBench() : Benchmark("ShaderReflection/GetAllRegisterBlockRefs") {}
+
+		virtual bool Setup() override
+		{
+			m_Reflection = CreateRef<BenchShaderReflection>();
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				FrameVector<const ShaderRegisterBlock*> blocks = m_Reflection->GetAllRegisterBlockRefs();
+				DoNotOptimize(blocks.data());
+				if ((i & 255) == 255)
+					AdvanceFrame();
+			}
+		}
+
+		virtual void Teardown() override { m_Reflection.reset(); }
+	private:
+		Ref<ShaderReflection> m_Reflection;
+	};
+
+	void RegisterShaderReflectionBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new GetAllRegisterBlocksBench()));
+		runner.Add(Scope<Benchmark>(new GetAllRegisterBlockRefsBench()));
+	}
+
+} }
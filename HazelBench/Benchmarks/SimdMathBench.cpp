@@ -0,0 +1,337 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Core/Math/SimdMath.h"
+#include "Runtime/Scene/Component.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+// SimdMath batch kernels against the per-object glm code they replace. Setup also checks the
+// kernels against glm: the matrix / bounds / culling kernels must match bit for bit, ComposeTRS
+// (polynomial sin/cos) within s_TrsTolerance. A failed check logs an error and skips the pair.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_MathCount = 16384;
+	static constexpr float s_TrsTolerance = 2e-6f;
+
+	// one shared random data set, built on first use
+	struct MathBenchData
+	{
+		std::vector<TransformComponent> Transforms;
+		std::vector<TransformTRS> TRS;
+		std::vector<glm::mat4> Parents;
+		std::vector<glm::mat4> World;
+		std::vector<BoundingSphere> Spheres;
+		std::vector<AABB> Boxes;
+		Frustum CameraFrustum;
+
+		static const MathBenchData& Get()
+		{
+			static MathBenchData s_Data;
+			return s_Data;
+		}
+	private:
+		MathBenchData()
+		{
+			std::mt19937 rng(17);
+			std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+			Transforms.resize(s_MathCount);
+			for (TransformComponent& transform : Transforms)
+			{
+				transform.Translation = { unit(rng) * 500.0f, unit(rng) * 50.0f, unit(rng) * 500.0f };
+				transform.Rotation = { unit(rng) * 180.0f, unit(rng) * 3600.0f, unit(rng) * 180.0f };
+				transform.Scale = glm::vec3(1.0f) + glm::vec3(unit(rng), unit(rng), unit(rng)) * 0.5f;
+
+				TransformTRS trs;
+				trs.Translation = transform.Translation;
+				trs.Rotation = transform.Rotation;
+				trs.Scale = transform.Scale;
+				TRS.push_back(trs);
+				World.push_back(transform.GetTransform());
+
+				TransformComponent parent;
+				parent.Translation = { unit(rng) * 10.0f, unit(rng) * 10.0f, unit(rng) * 10.0f };
+				parent.Rotation.y = unit(rng) * 180.0f;
+				Parents.push_back(parent.GetTransform());
+
+				BoundingSphere sphere;
+				sphere.Center = { unit(rng), unit(rng), unit(rng) };
+				sphere.Radius = 1.5f + unit(rng);
+				Spheres.push_back(sphere);
+
+				AABB box;
+				box.Min = glm::vec3(-1.0f) + glm::vec3(unit(rng), unit(rng), unit(rng)) * 0.5f;
+				box.Max = glm::vec3(1.0f) + glm::vec3(unit(rng), unit(rng), unit(rng)) * 0.5f;
+				Boxes.push_back(box);
+			}
+
+			glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 20.0f, 0.0f), glm::vec3(1.0f, 19.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+			glm::mat4 projection = glm::perspectiveZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+			CameraFrustum = Frustum(projection * view);
+		}
+	};
+
+	static bool SameMatrix(const glm::mat4& a, const glm::mat4& b, float tolerance)
+	{
+		for (int col = 0; col < 4; col++)
+		{
+			for (int row = 0; row < 4; row++)
+			{
+				// translation is in world units, compare it relative to its magnitude
+				float scale = col == 3 ? std::max(1.0f, std::abs(b[col][row])) : 1.0f;
+				if (std::abs(a[col][row] - b[col][row]) > tolerance * scale)
+					return false;
+			}
+		}
+		return true;
+	}
+
+	// SoA scratch for the culling pairs, sized once in Setup
+	struct BoundsScratch
+	{
+		std::vector<float> Data[6];
+		std::vector<uint32_t> Visible;
+
+		void Resize(size_t count)
+		{
+			for (std::vector<float>& component : Data)
+				component.resize(count);
+			Visible.resize(count);
+		}
+
+		SphereSoA Spheres() { return { Data[0].data(), Data[1].data(), Data[2].data(), Data[3].data() }; }
+		BoxSoA Boxes() { return { Data[0].data(), Data[1].data(), Data[2].data(), Data[3].data(), Data[4].data(), Data[5].data() }; }
+	};
+
+	class ComposeTRSBench : public Benchmark
+	{
+	public:
+		ComposeTRSBench(const std::string& name, bool simd) : Benchmark(name, s_MathCount), m_Simd(simd) {}
+
+		virtual bool Setup() override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			m_Out.resize(s_MathCount);
+			SimdMath::ComposeTRS(data.TRS.data(), m_Out.data(), s_MathCount);
+			for (uint32_t i = 0; i < s_MathCount; i++)
+			{
+				if (!SameMatrix(m_Out[i], data.World[i], s_TrsTolerance))
+				{
+					HZ_CORE_ERROR("SimdMath::ComposeTRS ({0}) differs from TransformComponent::GetTransform at {1}", SimdMath::GetInstructionSet(), i);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				if (m_Simd)
+				{
+					SimdMath::ComposeTRS(data.TRS.data(), m_Out.data(), s_MathCount);
+				}
+				else
+				{
+					for (uint32_t i = 0; i < s_MathCount; i++)
+						m_Out[i] = data.Transforms[i].GetTransform();
+				}
+				DoNotOptimize(m_Out.data());
+			}
+		}
+	private:
+		bool m_Simd;
+		std::vector<glm::mat4> m_Out;
+	};
+
+	// parent * local for every object, what a transform hierarchy does per level
+	class MultiplyMatricesBench : public Benchmark
+	{
+	public:
+		MultiplyMatricesBench(const std::string& name, bool simd) : Benchmark(name, s_MathCount), m_Simd(simd) {}
+
+		virtual bool Setup() override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			m_Out.resize(s_MathCount);
+			SimdMath::MultiplyMatrices(data.Parents.data(), data.World.data(), m_Out.data(), s_MathCount);
+			for (uint32_t i = 0; i < s_MathCount; i++)
+			{
+				if (!SameMatrix(m_Out[i], data.Parents[i] * data.World[i], 0.0f))
+				{
+					HZ_CORE_ERROR("SimdMath::MultiplyMatrices ({0}) differs from glm at {1}", SimdMath::GetInstructionSet(), i);
+					return false;
+				}
+			}
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				if (m_Simd)
+				{
+					SimdMath::MultiplyMatrices(data.Parents.data(), data.World.data(), m_Out.data(), s_MathCount);
+				}
+				else
+				{
+					for (uint32_t i = 0; i < s_MathCount; i++)
+						m_Out[i] = data.Parents[i] * data.World[i];
+				}
+				DoNotOptimize(m_Out.data());
+			}
+		}
+	private:
+		bool m_Simd;
+		std::vector<glm::mat4> m_Out;
+	};
+
+	// world space bounds + frustum test, the same work Culling::CullScene does per object
+	class CullSpheresBench : public Benchmark
+	{
+	public:
+		CullSpheresBench(const std::string& name, bool simd) : Benchmark(name, s_MathCount), m_Simd(simd) {}
+
+		virtual bool Setup() override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			m_Scratch.Resize(s_MathCount);
+			SphereSoA spheres = m_Scratch.Spheres();
+			SimdMath::TransformSpheres(data.World.data(), data.Spheres.data(), spheres, s_MathCount);
+			size_t visibleCount = SimdMath::CullSpheres(data.CameraFrustum, spheres, s_MathCount, m_Scratch.Visible.data());
+
+			size_t expected = 0;
+			for (uint32_t i = 0; i < s_MathCount; i++)
+			{
+				BoundingSphere world = data.Spheres[i].Transformed(data.World[i]);
+				if (world.Center.x != spheres.CenterX[i] || world.Center.y != spheres.CenterY[i]
+					|| world.Center.z != spheres.CenterZ[i] || world.Radius != spheres.Radius[i])
+				{
+					HZ_CORE_ERROR("SimdMath::TransformSpheres ({0}) differs from BoundingSphere::Transformed at {1}", SimdMath::GetInstructionSet(), i);
+					return false;
+				}
+				if (data.CameraFrustum.Intersects(world))
+				{
+					if (expected >= visibleCount || m_Scratch.Visible[expected] != i)
+					{
+						HZ_CORE_ERROR("SimdMath::CullSpheres ({0}) differs from Frustum::Intersects at {1}", SimdMath::GetInstructionSet(), i);
+						return false;
+					}
+					expected++;
+				}
+			}
+			return expected == visibleCount;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				size_t visibleCount = 0;
+				if (m_Simd)
+				{
+					SphereSoA spheres = m_Scratch.Spheres();
+					SimdMath::TransformSpheres(data.World.data(), data.Spheres.data(), spheres, s_MathCount);
+					visibleCount = SimdMath::CullSpheres(data.CameraFrustum, spheres, s_MathCount, m_Scratch.Visible.data());
+				}
+				else
+				{
+					for (uint32_t i = 0; i < s_MathCount; i++)
+					{
+						if (data.CameraFrustum.Intersects(data.Spheres[i].Transformed(data.World[i])))
+							m_Scratch.Visible[visibleCount++] = i;
+					}
+				}
+				DoNotOptimize(visibleCount);
+			}
+		}
+	private:
+		bool m_Simd;
+		BoundsScratch m_Scratch;
+	};
+
+	class CullBoxesBench : public Benchmark
+	{
+	public:
+		CullBoxesBench(const std::string& name, bool simd) : Benchmark(name, s_MathCount), m_Simd(simd) {}
+
+		virtual bool Setup() override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			m_Scratch.Resize(s_MathCount);
+			BoxSoA boxes = m_Scratch.Boxes();
+			SimdMath::TransformAABBs(data.World.data(), data.Boxes.data(), boxes, s_MathCount);
+			size_t visibleCount = SimdMath::CullBoxes(data.CameraFrustum, boxes, s_MathCount, m_Scratch.Visible.data());
+
+			std::vector<AABB> worldBoxes(s_MathCount);
+			SimdMath::TransformAABBs(data.World.data(), data.Boxes.data(), worldBoxes.data(), s_MathCount);
+
+			size_t expected = 0;
+			for (uint32_t i = 0; i < s_MathCount; i++)
+			{
+				AABB world = data.Boxes[i].Transformed(data.World[i]);
+				if (world.Min != worldBoxes[i].Min || world.Max != worldBoxes[i].Max)
+				{
+					HZ_CORE_ERROR("SimdMath::TransformAABBs ({0}) differs from AABB::Transformed at {1}", SimdMath::GetInstructionSet(), i);
+					return false;
+				}
+				if (data.CameraFrustum.Intersects(world))
+				{
+					if (expected >= visibleCount || m_Scratch.Visible[expected] != i)
+					{
+						HZ_CORE_ERROR("SimdMath::CullBoxes ({0}) differs from Frustum::Intersects at {1}", SimdMath::GetInstructionSet(), i);
+						return false;
+					}
+					expected++;
+				}
+			}
+			return expected == visibleCount;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			const MathBenchData& data = MathBenchData::Get();
+			for (uint64_t it = 0; it < iterations; it++)
+			{
+				size_t visibleCount = 0;
+				if (m_Simd)
+				{
+					BoxSoA boxes = m_Scratch.Boxes();
+					SimdMath::TransformAABBs(data.World.data(), data.Boxes.data(), boxes, s_MathCount);
+					visibleCount = SimdMath::CullBoxes(data.CameraFrustum, boxes, s_MathCount, m_Scratch.Visible.data());
+				}
+				else
+				{
+					for (uint32_t i = 0; i < s_MathCount; i++)
+					{
+						if (data.CameraFrustum.Intersects(data.Boxes[i].Transformed(data.World[i])))
+							m_Scratch.Visible[visibleCount++] = i;
+					}
+				}
+				DoNotOptimize(visibleCount);
+			}
+		}
+	private:
+		bool m_Simd;
+		BoundsScratch m_Scratch;
+	};
+
+	void RegisterSimdMathBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new ComposeTRSBench("Math/ComposeTRS/glm", false)));
+		runner.Add(Scope<Benchmark>(new ComposeTRSBench("Math/ComposeTRS/Simd", true)));
+		runner.Add(Scope<Benchmark>(new MultiplyMatricesBench("Math/MultiplyMatrices/glm", false)));
+		runner.Add(Scope<Benchmark>(new MultiplyMatricesBench("Math/MultiplyMatrices/Simd", true)));
+		runner.Add(Scope<Benchmark>(new CullSpheresBench("Math/CullSpheres/glm", false)));
+		runner.Add(Scope<Benchmark>(new CullSpheresBench("Math/CullSpheres/Simd", true)));
+		runner.Add(Scope<Benchmark>(new CullBoxesBench("Math/CullBoxes/glm", false)));
+		runner.Add(Scope<Benchmark>(new CullBoxesBench("Math/CullBoxes/Simd", true)));
+	}
+
+} }
@@ -0,0 +1,117 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Scene/Component.h"
+#include "Runtime/Scene/Systems/SystemScheduler.h"
+
+#include <random>
+
+// One frame of a small simulation (four systems over the same entities) run by SystemScheduler,
+// on the main thread only (what Scene::OnUpdate did before) and with the JobSystem running:
+// Integrate || Regen, then Damping || Bounds, each system split further with ParallelEach.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_SimulationEntityCount = 65536;
+	static constexpr uint32_t s_SimulationBatchSize = 1024;
+
+	struct BenchVelocity { glm::vec3 Value = glm::vec3(0.0f); };
+	struct BenchHealth { float Value = 100.0f; float Regen = 1.0f; };
+	struct BenchBounds { glm::vec3 Min = glm::vec3(0.0f); glm::vec3 Max = glm::vec3(0.0f); };
+
+	class SystemSchedulerBench : public Benchmark
+	{
+	public:
+		SystemSchedulerBench(const std::string& name, bool parallel)
+			: Benchmark(name, s_SimulationEntityCount), m_Parallel(parallel) {}
+
+		virtual bool Setup() override
+		{
+			// the bench process does not start the JobSystem, only the parallel variant needs it
+			if (m_Parallel && !JobSystem::IsInitialized())
+			{
+				JobSystem::Initialize();
+				m_OwnsJobSystem = true;
+			}
+			if (!m_Parallel && JobSystem::IsInitialized())
+				return false;
+
+			std::mt19937 rng(31);
+			std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+			for (uint32_t i = 0; i < s_SimulationEntityCount; i++)
+			{
+				entt::entity entity = m_Registry.create();
+				m_Registry.emplace<TransformComponent>(entity, glm::vec3(unit(rng), unit(rng), unit(rng)) * 100.0f);
+				m_Registry.emplace<BenchVelocity>(entity, glm::vec3(unit(rng), unit(rng), unit(rng)));
+				m_Registry.emplace<BenchHealth>(entity);
+				m_Registry.emplace<BenchBounds>(entity);
+			}
+
+			m_Scheduler.Add("Integrate", SystemAccess().Read<BenchVelocity>().Write<TransformComponent>(), [](SystemContext& context)
+			{
+				context.ParallelEach<TransformComponent, BenchVelocity>(s_SimulationBatchSize,
+					[&](entt::entity, TransformComponent& transform, BenchVelocity& velocity)
+				{
+					transform.Translation += velocity.Value * context.DeltaTime;
+					transform.Rotation.y += 10.0f * context.DeltaTime;
+				});
+			});
+			m_Scheduler.Add("Regen", SystemAccess().Write<BenchHealth>(), [](SystemContext& context)
+			{
+				context.ParallelEach<BenchHealth>(s_SimulationBatchSize, [&](entt::entity, BenchHealth& health)
+				{
+					health.Value = std::min(100.0f, health.Value + health.Regen * context.DeltaTime);
+				});
+			});
+			m_Scheduler.Add("Damping", SystemAccess().Write<BenchVelocity>(), [](SystemContext& context)
+			{
+				context.ParallelEach<BenchVelocity>(s_SimulationBatchSize, [&](entt::entity, BenchVelocity& velocity)
+				{
+					velocity.Value *= 0.999f;
+				});
+			});
+			m_Scheduler.Add("Bounds", SystemAccess().Read<TransformComponent>().Write<BenchBounds>(), [](SystemContext& context)
+			{
+				context.ParallelEach<TransformComponent, BenchBounds>(s_SimulationBatchSize,
+					[&](entt::entity, TransformComponent& transform, BenchBounds& bounds)
+				{
+					glm::vec3 extent = transform.Scale * 0.5f;
+					bounds.Min = transform.Translation - extent;
+					bounds.Max = transform.Translation + extent;
+				});
+			});
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			for (uint64_t i = 0; i < iterations; i++)
+				m_Scheduler.Run(m_Registry, 1.0f / 60.0f);
+			DoNotOptimize(m_Registry.get<BenchBounds>(m_Registry.view<BenchBounds>().front()).Max);
+		}
+
+		virtual void Teardown() override
+		{
+			if (m_OwnsJobSystem)
+			{
+				// per-system timings of the run, visible with --verbose
+				m_Scheduler.LogReport();
+				JobSystem::Shutdown();
+				m_OwnsJobSystem = false;
+			}
+			m_Registry.clear();
+		}
+	private:
+		bool m_Parallel;
+		bool m_OwnsJobSystem = false;
+		entt::registry m_Registry;
+		SystemScheduler m_Scheduler;
+	};
+
+	void RegisterSystemSchedulerBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new SystemSchedulerBench("Scene/Systems/MainThread", false)));
+		runner.Add(Scope<Benchmark>(new SystemSchedulerBench("Scene/Systems/Parallel", true)));
+	}
+
+} }
@@ -0,0 +1,202 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Scene/Scene.h"
+#include "Runtime/Scene/Entity.h"
+#include "Runtime/Scene/Systems/TransformSystem.h"
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+
+#include <cmath>
+#include <random>
+
+// World matrix cost per frame: rebuilding every matrix with GetTransform (what consumers did before
+// the cache) against TransformSystem::Update with a share of the entities moving, flat and as a deep
+// parent/child tree. The tree variants run with the JobSystem started so large levels are updated in
+// parallel, and check once in Setup that Update produces the same world matrices as the recursive walk.
+namespace Hazel { namespace Bench {
+
+	static constexpr uint32_t s_TransformCount = 16384;
+
+	class TransformBench : public Benchmark
+	{
+	public:
+		// dirtyEvery = 0 rebuilds every matrix through GetTransform, UINT32_MAX leaves everything static,
+		// otherwise every dirtyEvery-th entity is marked dirty before each Update
+		TransformBench(const std::string& name, uint32_t dirtyEvery)
+			: Benchmark(name, s_TransformCount), m_DirtyEvery(dirtyEvery) {}
+
+		virtual bool Setup() override
+		{
+			m_Scene = CreateRef<Scene>();
+			entt::registry& registry = m_Scene->Reg();
+			std::mt19937 rng(23);
+			std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+			for (uint32_t i = 0; i < s_TransformCount; i++)
+			{
+				entt::entity entity = registry.create();
+				TransformComponent& transform = registry.emplace<TransformComponent>(entity);
+				transform.Translation = { unit(rng) * 500.0f, unit(rng) * 50.0f, unit(rng) * 500.0f };
+				transform.Rotation = { 0.0f, unit(rng) * 180.0f, 0.0f };
+				transform.Scale = glm::vec3(1.0f + unit(rng) * 0.5f);
+				m_Entities.push_back(entity);
+			}
+			m_Scene->GetTransformSystem().Update(registry);
+			return true;
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			entt::registry& registry = m_Scene->Reg();
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				if (m_DirtyEvery == 0)
+				{
+					for (auto [entity, transform, world] : registry.view<TransformComponent, WorldTransformComponent>().each())
+						world.World = transform.GetTransform();
+				}
+				else
+				{
+					for (size_t e = 0; m_DirtyEvery != UINT32_MAX && e < m_Entities.size(); e += m_DirtyEvery)
+						registry.get<TransformComponent>(m_Entities[e]).MarkDirty();
+					m_Scene->GetTransformSystem().Update(registry);
+				}
+				DoNotOptimize(registry.get<WorldTransformComponent>(m_Entities.back()).World);
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			m_Entities.clear();
+			m_Scene.reset();
+		}
+	private:
+		uint32_t m_DirtyEvery;
+		Ref<Scene> m_Scene;
+		std::vector<entt::entity> m_Entities;
+	};
+
+	// the same entity count as a tree: s_HierarchyBranching children per node, filled breadth first,
+	// so the depth is log(count) and a dirty node near the root drags its whole subtree along
+	static constexpr uint32_t s_HierarchyBranching = 4;
+
+	class TransformHierarchyBench : public Benchmark
+	{
+	public:
+		// dirtyEvery = 0 walks the tree recursively multiplying parent * GetTransform() for every node,
+		// otherwise every dirtyEvery-th node (in creation order) is marked dirty before each Update
+		TransformHierarchyBench(const std::string& name, uint32_t dirtyEvery)
+			: Benchmark(name, s_TransformCount), m_DirtyEvery(dirtyEvery) {}
+
+		virtual bool Setup() override
+		{
+			// the bench process does not start the JobSystem; without it the per-level ParallelFor runs inline
+			if (!JobSystem::IsInitialized())
+			{
+				JobSystem::Initialize();
+				m_OwnsJobSystem = true;
+			}
+
+			m_Scene = CreateRef<Scene>();
+			std::mt19937 rng(29);
+			std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+			for (uint32_t i = 0; i < s_TransformCount; i++)
+			{
+				Entity entity = m_Scene->CreateEntity();
+				TransformComponent& transform = entity.GetComponent<TransformComponent>();
+				transform.Translation = { unit(rng) * 10.0f, unit(rng) * 2.0f, unit(rng) * 10.0f };
+				transform.Rotation = { 0.0f, unit(rng) * 180.0f, 0.0f };
+				if (i > 0)
+					m_Scene->SetParent(entity, m_Entities[(i - 1) / s_HierarchyBranching]);
+				m_Entities.push_back(entity);
+			}
+			m_Scene->GetTransformSystem().Update(m_Scene->Reg());
+			return MatchesRecursive();
+		}
+
+		virtual void Run(uint64_t iterations) override
+		{
+			entt::registry& registry = m_Scene->Reg();
+			for (uint64_t i = 0; i < iterations; i++)
+			{
+				if (m_DirtyEvery == 0)
+				{
+					UpdateRecursive(registry, m_Entities[0].GetHandle(), glm::mat4(1.0f));
+				}
+				else
+				{
+					for (size_t e = 0; e < m_Entities.size(); e += m_DirtyEvery)
+						m_Entities[e].GetComponent<TransformComponent>().MarkDirty();
+					m_Scene->GetTransformSystem().Update(registry);
+				}
+				DoNotOptimize(m_Entities.back().GetComponent<WorldTransformComponent>().World);
+			}
+		}
+
+		virtual void Teardown() override
+		{
+			m_Entities.clear();
+			m_Scene.reset();
+			if (m_OwnsJobSystem)
+			{
+				JobSystem::Shutdown();
+				m_OwnsJobSystem = false;
+			}
+		}
+	private:
+		// TransformSystem::Update and the recursive walk have to agree before either is timed
+		bool MatchesRecursive()
+		{
+			entt::registry& registry = m_Scene->Reg();
+			std::vector<glm::mat4> cached;
+			cached.reserve(m_Entities.size());
+			for (Entity entity : m_Entities)
+				cached.push_back(entity.GetComponent<WorldTransformComponent>().World);
+
+			UpdateRecursive(registry, m_Entities[0].GetHandle(), glm::mat4(1.0f));
+			for (size_t e = 0; e < m_Entities.size(); e++)
+			{
+				const glm::mat4& expected = m_Entities[e].GetComponent<WorldTransformComponent>().World;
+				for (int column = 0; column < 4; column++)
+				{
+					for (int row = 0; row < 4; row++)
+					{
+						float a = cached[e][column][row];
+						float b = expected[column][row];
+						if (std::abs(a - b) > 1e-3f * (1.0f + std::abs(b)))
+							return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		// the pointer-chasing depth-first walk a naive scene graph does every frame
+		static void UpdateRecursive(entt::registry& registry, entt::entity entity, const glm::mat4& parentWorld)
+		{
+			glm::mat4 world = parentWorld * registry.get<TransformComponent>(entity).GetTransform();
+			registry.get<WorldTransformComponent>(entity).World = world;
+			for (entt::entity child = registry.get<RelationshipComponent>(entity).FirstChild; child != entt::null;)
+			{
+				UpdateRecursive(registry, child, world);
+				child = registry.get<RelationshipComponent>(child).NextSibling;
+			}
+		}
+	private:
+		uint32_t m_DirtyEvery;
+		bool m_OwnsJobSystem = false;
+		Ref<Scene> m_Scene;
+		std::vector<Entity> m_Entities;
+	};
+
+	void RegisterTransformBenches(BenchRunner& runner)
+	{
+		runner.Add(Scope<Benchmark>(new TransformBench("Transform/GetTransform(all)", 0)));
+		runner.Add(Scope<Benchmark>(new TransformBench("Transform/UpdateWorld(all dirty)", 1)));
+		runner.Add(Scope<Benchmark>(new TransformBench("Transform/UpdateWorld(10% dirty)", 10)));
+		runner.Add(Scope<Benchmark>(new TransformBench("Transform/UpdateWorld(static)", UINT32_MAX)));
+		runner.Add(Scope<Benchmark>(new TransformHierarchyBench("Transform/Hierarchy/Recursive(all)", 0)));
+		runner.Add(Scope<Benchmark>(new TransformHierarchyBench("Transform/Hierarchy/Update(all dirty)", 1)));
+		runner.Add(Scope<Benchmark>(new TransformHierarchyBench("Transform/Hierarchy/Update(10% dirty)", 10)));
+	}
+
+} }
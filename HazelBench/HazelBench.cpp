@@ -0,0 +1,93 @@
+#include "hzpch.h"
+#include "BenchRunner.h"
+#include "Stress/StressHarness.h"
+
+#include "Runtime/Core/Memory/Allocator/FrameArena.h"
+#include "Runtime/Graphics/RenderAPI.h"
+#include "Platform/Null/NullRenderAPIManager.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace Hazel { namespace Bench {
+	void RegisterEventDispatchBenches(BenchRunner& runner);
+	void RegisterMaterialBenches(BenchRunner& runner);
+	void RegisterShaderReflectionBenches(BenchRunner& runner);
+	void RegisterPipelineStateBenches(BenchRunner& runner);
+	void RegisterDescriptorAllocatorBenches(BenchRunner& runner);
+	void RegisterMeshBenches(BenchRunner& runner);
+	void RegisterContainerBenches(BenchRunner& runner);
+	void RegisterSimdMathBenches(BenchRunner& runner);
+	void RegisterRHIDispatchBenches(BenchRunner& runner);
+	void RegisterTransformBenches(BenchRunner& runner);
+	void RegisterSystemSchedulerBenches(BenchRunner& runner);
+	void RegisterSceneSerializerBenches(BenchRunner& runner);
+	void RegisterSceneSnapshotBenches(BenchRunner& runner);
+} }
+
+// Micro benchmarks for engine hot paths, no window / device is created: RHI objects go to the
+// Null backend. Run before and after an engine change with --json and diff the medians.
+// "HazelBench stress ..." runs the large scene harness instead (see Stress/StressHarness.h).
+int main(int argc, char** argv)
+{
+	// "stress" switches to the harness, which parses the remaining arguments itself
+	const bool stressMode = argc > 1 && strcmp(argv[1], "stress") == 0;
+
+	Hazel::Bench::BenchOptions options;
+	if (!stressMode && !Hazel::Bench::BenchOptions::Parse(argc, argv, options))
+	{
+		Hazel::Bench::BenchOptions::PrintUsage(argv[0]);
+		return 1;
+	}
+
+	Hazel::Log::Init();
+	// load paths log per object, that would end up in the numbers
+	if (!options.Verbose)
+		Hazel::Log::SetLevel(spdlog::level::warn);
+
+	Hazel::FrameArena::Get().Initialize(Hazel::FrameArenaConfig());
+	Hazel::RenderAPI::SetAPI(Hazel::RenderAPI::API::Null);
+	Hazel::RenderAPIManager::Register<Hazel::NullRenderAPIManager>();
+	Hazel::RenderAPIManager::getInstance();
+
+	int exitCode = 0;
+	if (stressMode)
+	{
+		exitCode = Hazel::Bench::RunStressHarness(argc - 1, argv + 1);
+	}
+	else
+	{
+		Hazel::Bench::BenchRunner runner(options);
+		Hazel::Bench::RegisterEventDispatchBenches(runner);
+		Hazel::Bench::RegisterMaterialBenches(runner);
+		Hazel::Bench::RegisterShaderReflectionBenches(runner);
+		Hazel::Bench::RegisterPipelineStateBenches(runner);
+		Hazel::Bench::RegisterDescriptorAllocatorBenches(runner);
+		Hazel::Bench::RegisterMeshBenches(runner);
+		Hazel::Bench::RegisterContainerBenches(runner);
+		Hazel::Bench::RegisterSimdMathBenches(runner);
+		Hazel::Bench::RegisterRHIDispatchBenches(runner);
+		Hazel::Bench::RegisterTransformBenches(runner);
+		Hazel::Bench::RegisterSystemSchedulerBenches(runner);
+		Hazel::Bench::RegisterSceneSerializerBenches(runner);
+		Hazel::Bench::RegisterSceneSnapshotBenches(runner);
+
+		runner.RunAll();
+
+		if (!options.ListOnly)
+		{
+			runner.PrintSummary();
+			if (!options.JsonPath.empty())
+			{
+				if (runner.WriteJson(options.JsonPath))
+					printf("\nresults written to %s\n", options.JsonPath.c_str());
+				else
+					exitCode = 1;
+			}
+		}
+	}
+
+	Hazel::FrameArena::Get().Shutdown();
+	Hazel::Log::Shutdown();
+	return exitCode;
+}
@@ -0,0 +1,332 @@
+#include "hzpch.h"
+#include "StressHarness.h"
+#include "BenchRunner.h"
+
+#include "Runtime/Core/Threading/JobSystem/JobSystem.h"
+#include "Runtime/Core/Time/FrameTimer.h"
+#include "Runtime/Graphics/Culling/Culling.h"
+#include "Runtime/Graphics/Renderer/RenderQueue.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+namespace Hazel { namespace Bench {
+
+	enum class StressPhase : uint32_t { Update = 0, Cull, Extract, Total, Count };
+
+	static const char* s_PhaseNames[(uint32_t)StressPhase::Count] = { "Update", "Cull", "Extract", "Total" };
+
+	static double ElapsedMs(Clock::TimePoint from, Clock::TimePoint to)
+	{
+		return Clock::ElapsedSeconds(from, to) * 1000.0;
+	}
+
+	static double PercentileMs(const std::vector<double>& sorted, double p)
+	{
+		if (sorted.empty())
+			return 0.0;
+		size_t index = std::min(sorted.size() - 1, (size_t)(p * (double)(sorted.size() - 1) + 0.5));
+		return sorted[index];
+	}
+
+	static std::string ScenarioName(uint32_t entityCount)
+	{
+		return "Stress/" + std::to_string(entityCount);
+	}
+
+	// ---------------- StressOptions ----------------
+
+	bool StressOptions::Parse(int argc, char** argv, StressOptions& out)
+	{
+		for (int i = 1; i < argc; i++)
+		{
+			const char* arg = argv[i];
+			if (strcmp(arg, "--help") == 0 || strcmp(arg, "-h") == 0)
+				return false;
+
+			const char* value = i + 1 < argc ? argv[++i] : nullptr;
+			if (!value)
+			{
+				fprintf(stderr, "missing value for %s\n", arg);
+				return false;
+			}
+
+			if (strcmp(arg, "--entities") == 0)
+			{
+				out.EntityCounts.clear();
+				std::stringstream list(value);
+				std::string item;
+				while (std::getline(list, item, ','))
+				{
+					uint32_t count = (uint32_t)strtoul(item.c_str(), nullptr, 10);
+					if (count > 0)
+						out.EntityCounts.push_back(count);
+				}
+				if (out.EntityCounts.empty())
+				{
+					fprintf(stderr, "--entities needs at least one count\n");
+					return false;
+				}
+			}
+			else if (strcmp(arg, "--frames") == 0)
+				out.Frames = std::max(1u, (uint32_t)strtoul(value, nullptr, 10));
+			else if (strcmp(arg, "--warmup") == 0)
+				out.WarmupFrames = (uint32_t)strtoul(value, nullptr, 10);
+			else if (strcmp(arg, "--meshes") == 0)
+				out.Scene.MeshCount = std::max(1u, (uint32_t)strtoul(value, nullptr, 10));
+			else if (strcmp(arg, "--materials") == 0)
+				out.Scene.MaterialCount = std::max(1u, (uint32_t)strtoul(value, nullptr, 10));
+			else if (strcmp(arg, "--skew") == 0)
+				out.Scene.DistributionSkew = std::max(0.0f, (float)atof(value));
+			else if (strcmp(arg, "--dynamic") == 0)
+				out.Scene.DynamicFraction = (float)atof(value);
+			else if (strcmp(arg, "--seed") == 0)
+				out.Scene.Seed = (uint32_t)strtoul(value, nullptr, 10);
+			else if (strcmp(arg, "--out") == 0)
+				out.OutputPath = value;
+			else if (strcmp(arg, "--baseline") == 0)
+				out.BaselinePath = value;
+			else if (strcmp(arg, "--tolerance") == 0)
+				out.Tolerance = std::max(0.0, atof(value));
+			else if (strcmp(arg, "--workers") == 0)
+				out.Workers = (uint32_t)strtoul(value, nullptr, 10);
+			else
+			{
+				fprintf(stderr, "unknown option %s\n", arg);
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void StressOptions::PrintUsage(const char* exe)
+	{
+		printf("usage: %s stress [options]\n", exe);
+		printf("  --entities N[,N..] entity count per scenario (default 10000,100000)\n");
+		printf("  --frames N         measured frames per scenario (default 60)\n");
+		printf("  --warmup N         untimed frames before measuring (default 5)\n");
+		printf("  --meshes N         distinct meshes (default 16)\n");
+		printf("  --materials N      distinct materials (default 64)\n");
+		printf("  --skew X           Zipf exponent of the mesh/material distribution, 0 = uniform (default 1)\n");
+		printf("  --dynamic X        share of entities moving every frame (default 0.1)\n");
+		printf("  --seed N           scene generation seed (default 1)\n");
+		printf("  --out PATH         write per phase results as CSV (usable as a baseline)\n");
+		printf("  --baseline PATH    compare medians against a previous --out file, exit 1 on regression\n");
+		printf("  --tolerance X      allowed slowdown before a phase counts as regressed (default 0.10)\n");
+		printf("  --workers N        JobSystem worker threads, 0 = hardware threads - 1 (default 0)\n");
+	}
+
+	// ---------------- StressHarness ----------------
+
+	void StressHarness::RunAll()
+	{
+		m_Results.clear();
+		m_WorkerCount = JobSystem::IsInitialized() ? JobSystem::GetWorkerCount() : 0;
+		printf("JobSystem workers: %u\n", m_WorkerCount);
+		for (uint32_t entityCount : m_Options.EntityCounts)
+			RunScenario(entityCount);
+	}
+
+	void StressHarness::RunScenario(uint32_t entityCount)
+	{
+		std::string scenario = ScenarioName(entityCount);
+		printf("running %s ...\n", scenario.c_str());
+		fflush(stdout);
+
+		StressSceneDesc desc = m_Options.Scene;
+		desc.EntityCount = entityCount;
+
+		Clock::TimePoint buildStart = Clock::Now();
+		StressScene stressScene(desc);
+		Scene* scene = stressScene.GetScene();
+		printf("  built in %.1f ms\n", ElapsedMs(buildStart, Clock::Now()));
+
+		std::vector<entt::entity> visible;
+		visible.reserve(entityCount);
+		RenderQueue queue;
+
+		std::vector<double> samples[(uint32_t)StressPhase::Count];
+		for (auto& phase : samples)
+			phase.reserve(m_Options.Frames);
+
+		const float frameTime = 1.0f / 60.0f;
+		uint64_t visibleSum = 0;
+		uint64_t stateChangeSum = 0;
+
+		const uint32_t totalFrames = m_Options.WarmupFrames + m_Options.Frames;
+		for (uint32_t frame = 0; frame < totalFrames; frame++)
+		{
+			AdvanceFrame();
+
+			Clock::TimePoint t0 = Clock::Now();
+			stressScene.Animate((float)frame * frameTime);
+			scene->OnUpdate(frameTime);
+
+			Clock::TimePoint t1 = Clock::Now();
+			visible.clear();
+			Culling::CullScene(stressScene.GetViewProjection(), scene, visible);
+
+			Clock::TimePoint t2 = Clock::Now();
+			queue.Clear();
+			queue.Extract(scene, visible);
+			uint32_t stateChanges = queue.Sort();
+			Clock::TimePoint t3 = Clock::Now();
+
+			DoNotOptimize(queue.GetItems().data());
+			if (frame < m_Options.WarmupFrames)
+				continue;
+
+			samples[(uint32_t)StressPhase::Update].push_back(ElapsedMs(t0, t1));
+			samples[(uint32_t)StressPhase::Cull].push_back(ElapsedMs(t1, t2));
+			samples[(uint32_t)StressPhase::Extract].push_back(ElapsedMs(t2, t3));
+			samples[(uint32_t)StressPhase::Total].push_back(ElapsedMs(t0, t3));
+			visibleSum += visible.size();
+			stateChangeSum += stateChanges;
+		}
+
+		printf("  avg visible %llu / %u, avg state changes %llu\n",
+			(unsigned long long)(visibleSum / m_Options.Frames), entityCount,
+			(unsigned long long)(stateChangeSum / m_Options.Frames));
+
+		for (uint32_t phase = 0; phase < (uint32_t)StressPhase::Count; phase++)
+		{
+			std::vector<double>& phaseSamples = samples[phase];
+			std::sort(phaseSamples.begin(), phaseSamples.end());
+			double sum = 0.0;
+			for (double s : phaseSamples)
+				sum += s;
+
+			StressPhaseResult result;
+			result.Scenario = scenario;
+			result.Phase = s_PhaseNames[phase];
+			result.MedianMs = PercentileMs(phaseSamples, 0.5);
+			result.P95Ms = PercentileMs(phaseSamples, 0.95);
+			result.MeanMs = phaseSamples.empty() ? 0.0 : sum / (double)phaseSamples.size();
+			m_Results.push_back(result);
+		}
+	}
+
+	void StressHarness::PrintSummary() const
+	{
+		printf("\n%-24s %-10s %12s %12s %12s\n", "scenario", "phase", "median ms", "p95 ms", "mean ms");
+		for (const StressPhaseResult& r : m_Results)
+			printf("%-24s %-10s %12.3f %12.3f %12.3f\n", r.Scenario.c_str(), r.Phase.c_str(), r.MedianMs, r.P95Ms, r.MeanMs);
+	}
+
+	bool StressHarness::WriteResults(const std::string& path) const
+	{
+		FILE* file = fopen(path.c_str(), "wb");
+		if (!file)
+		{
+			HZ_CORE_ERROR("HazelBench: cannot open {0} for writing", path);
+			return false;
+		}
+
+		fprintf(file, "scenario,phase,median_ms,p95_ms,mean_ms,workers\n");
+		for (const StressPhaseResult& r : m_Results)
+			fprintf(file, "%s,%s,%.4f,%.4f,%.4f,%u\n", r.Scenario.c_str(), r.Phase.c_str(), r.MedianMs, r.P95Ms, r.MeanMs, m_WorkerCount);
+		fclose(file);
+		return true;
+	}
+
+	int StressHarness::CompareToBaseline(const std::string& path) const
+	{
+		std::ifstream input(path);
+		if (!input.is_open())
+		{
+			HZ_CORE_ERROR("HazelBench: cannot read baseline {0}", path);
+			return -1;
+		}
+
+		// scenario/phase -> baseline median
+		std::unordered_map<std::string, double> baseline;
+		std::string line;
+		std::getline(input, line);	// header
+		while (std::getline(input, line))
+		{
+			std::stringstream row(line);
+			std::string scenario, phase, median, p95, mean, workers;
+			if (!std::getline(row, scenario, ',') || !std::getline(row, phase, ',') || !std::getline(row, median, ','))
+				continue;
+
+			// timings with a different number of workers aren't comparable, files without the column predate it
+			if (!std::getline(row, p95, ',') || !std::getline(row, mean, ',') || !std::getline(row, workers, ',')
+				|| (uint32_t)strtoul(workers.c_str(), nullptr, 10) != m_WorkerCount)
+			{
+				HZ_CORE_ERROR("HazelBench: baseline {0} was recorded with {1} JobSystem workers, this run has {2}; record a new baseline",
+					path, workers.empty() ? std::string("unknown") : workers, m_WorkerCount);
+				return -1;
+			}
+			baseline[scenario + "/" + phase] = atof(median.c_str());
+		}
+
+		printf("\n%-24s %-10s %12s %12s %9s\n", "scenario", "phase", "baseline ms", "current ms", "change");
+		int regressions = 0;
+		for (const StressPhaseResult& r : m_Results)
+		{
+			auto it = baseline.find(r.Scenario + "/" + r.Phase);
+			if (it == baseline.end())
+			{
+				printf("%-24s %-10s %12s %12.3f %9s\n", r.Scenario.c_str(), r.Phase.c_str(), "-", r.MedianMs, "new");
+				continue;
+			}
+
+			double change = it->second > 0.0 ? (r.MedianMs - it->second) / it->second : 0.0;
+			bool regressed = change > m_Options.Tolerance;
+			if (regressed)
+				regressions++;
+			printf("%-24s %-10s %12.3f %12.3f %+8.1f%%%s\n", r.Scenario.c_str(), r.Phase.c_str(),
+				it->second, r.MedianMs, change * 100.0, regressed ? "  REGRESSED" : "");
+		}
+		return regressions;
+	}
+
+	int RunStressHarness(int argc, char** argv)
+	{
+		StressOptions options;
+		if (!StressOptions::Parse(argc, argv, options))
+		{
+			StressOptions::PrintUsage("HazelBench");
+			return 1;
+		}
+
+		// the bench process has no Application, start the JobSystem here so the scene update runs
+		// the same parallel paths as the editor / game
+		JobSystemConfig jobConfig;
+		jobConfig.WorkerCount = options.Workers;
+		const bool ownsJobSystem = !JobSystem::IsInitialized();
+		if (ownsJobSystem)
+			JobSystem::Initialize(jobConfig);
+
+		StressHarness harness(options);
+		harness.RunAll();
+		harness.PrintSummary();
+
+		int exitCode = 0;
+		if (!options.OutputPath.empty())
+		{
+			if (harness.WriteResults(options.OutputPath))
+				printf("\nresults written to %s\n", options.OutputPath.c_str());
+			else
+				exitCode = 1;
+		}
+
+		if (!options.BaselinePath.empty())
+		{
+			int regressions = harness.CompareToBaseline(options.BaselinePath);
+			if (regressions != 0)
+			{
+				if (regressions > 0)
+					printf("\n%d phase(s) slower than baseline by more than %.0f%%\n", regressions, options.Tolerance * 100.0);
+				exitCode = 1;
+			}
+		}
+
+		if (ownsJobSystem)
+			JobSystem::Shutdown();
+		return exitCode;
+	}
+
+} }
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "StressScene.h"
+
+#include <string>
+#include <vector>
+
+namespace Hazel { namespace Bench {
+
+	struct StressOptions
+	{
+		// one scenario per entry
+		std::vector<uint32_t> EntityCounts = { 10000, 100000 };
+		uint32_t Frames = 60;
+		uint32_t WarmupFrames = 5;
+		// mesh / material counts, skew, dynamic share and seed for every scenario
+		StressSceneDesc Scene;
+
+		// results in the baseline format, written when set
+		std::string OutputPath;
+		// compare against this file, a phase regresses when its median is more than Tolerance slower
+		std::string BaselinePath;
+		double Tolerance = 0.10;
+		// JobSystem worker threads for the run, 0 = hardware threads - 1. Scene::OnUpdate's systems and
+		// the transform hierarchy only take their parallel paths with the JobSystem running
+		uint32_t Workers = 0;
+
+		// stress --entities N[,N...] --frames N --warmup N --meshes N --materials N --skew X
+		// --dynamic X --seed N --out PATH --baseline PATH --tolerance X --workers N
+		static bool Parse(int argc, char** argv, StressOptions& out);
+		static void PrintUsage(const char* exe);
+	};
+
+	// per phase frame times of one scenario, milliseconds
+	struct StressPhaseResult
+	{
+		std::string Scenario;
+		std::string Phase;
+		double MedianMs = 0.0;
+		double P95Ms = 0.0;
+		double MeanMs = 0.0;
+	};
+
+	// Runs every scenario for a fixed number of frames through the same steps as the main loop
+	// (Update: animate + Scene::OnUpdate, Cull: Culling::CullScene, Extract: RenderQueue build +
+	// sort), times each phase separately and optionally checks the medians against a baseline.
+	class StressHarness
+	{
+	public:
+		StressHarness(const StressOptions& options) : m_Options(options) {}
+
+		void RunAll();
+		void PrintSummary() const;
+
+		// CSV: scenario,phase,median_ms,p95_ms,mean_ms,workers
+		bool WriteResults(const std::string& path) const;
+		// returns the number of regressed phases, or -1 if the baseline can't be read or was
+		// recorded with a different JobSystem worker count
+		int CompareToBaseline(const std::string& path) const;
+
+		inline const std::vector<StressPhaseResult>& GetResults() const { return m_Results; }
+	private:
+		void RunScenario(uint32_t entityCount);
+	private:
+		StressOptions m_Options;
+		std::vector<StressPhaseResult> m_Results;
+		uint32_t m_WorkerCount = 0;
+	};
+
+	// entry point of "HazelBench stress ...", returns the process exit code
+	int RunStressHarness(int argc, char** argv);
+
+} }
@@ -0,0 +1,108 @@
+#include "hzpch.h"
+#include "StressScene.h"
+#include "Benchmarks/BenchShader.h"
+
+#include "Runtime/Graphics/Mesh/Mesh.h"
+#include "Runtime/Graphics/Material/Material.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+
+namespace Hazel { namespace Bench {
+
+	// cumulative Zipf weights, index i has weight 1 / (i + 1)^skew
+	static std::vector<double> MakeZipfTable(uint32_t count, float skew)
+	{
+		std::vector<double> cdf(std::max(1u, count));
+		double sum = 0.0;
+		for (size_t i = 0; i < cdf.size(); i++)
+		{
+			sum += 1.0 / std::pow((double)(i + 1), (double)skew);
+			cdf[i] = sum;
+		}
+		for (double& value : cdf)
+			value /= sum;
+		return cdf;
+	}
+
+	static uint32_t PickZipf(const std::vector<double>& cdf, double u)
+	{
+		auto it = std::lower_bound(cdf.begin(), cdf.end(), u);
+		return (uint32_t)std::min<size_t>(it - cdf.begin(), cdf.size() - 1);
+	}
+
+	StressScene::StressScene(const StressSceneDesc& desc)
+		: m_Desc(desc), m_Scene(new Scene())
+	{
+		std::mt19937 rng(desc.Seed);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		std::uniform_real_distribution<float> signedUnit(-1.0f, 1.0f);
+
+		// meshes between half a unit and a few units across, like props and small buildings
+		m_Meshes.reserve(desc.MeshCount);
+		for (uint32_t i = 0; i < std::max(1u, desc.MeshCount); i++)
+		{
+			Ref<Mesh> mesh = Mesh::Create();
+			mesh->SetBounds(BoundingSphere{ glm::vec3(0.0f, 0.5f, 0.0f), 0.5f + 4.0f * unit(rng) });
+			m_Meshes.push_back(mesh);
+		}
+
+		Ref<Shader> shader = CreateRef<BenchShader>();
+		m_Materials.reserve(desc.MaterialCount);
+		for (uint32_t i = 0; i < std::max(1u, desc.MaterialCount); i++)
+		{
+			Ref<Material> material = Material::Create(shader);
+			material->Set("u_BaseColor", glm::vec4(unit(rng), unit(rng), unit(rng), 1.0f));
+			m_Materials.push_back(material);
+		}
+
+		std::vector<double> meshTable = MakeZipfTable((uint32_t)m_Meshes.size(), desc.DistributionSkew);
+		std::vector<double> materialTable = MakeZipfTable((uint32_t)m_Materials.size(), desc.DistributionSkew);
+
+		uint32_t dynamicCount = (uint32_t)((double)desc.EntityCount * std::min(1.0f, std::max(0.0f, desc.DynamicFraction)));
+		m_DynamicEntities.reserve(dynamicCount);
+		m_DynamicBasePositions.reserve(dynamicCount);
+
+		for (uint32_t i = 0; i < desc.EntityCount; i++)
+		{
+			Entity entity = m_Scene->CreateEntity("Stress");
+			TransformComponent& transform = entity.GetComponent<TransformComponent>();
+			transform.Translation = glm::vec3(signedUnit(rng), signedUnit(rng) * 0.1f, signedUnit(rng)) * desc.WorldExtent;
+			transform.Rotation = glm::vec3(0.0f, 360.0f * unit(rng), 0.0f);
+			transform.Scale = glm::vec3(0.5f + unit(rng));
+
+			entity.AddComponent<MeshFilterComponent>(m_Meshes[PickZipf(meshTable, unit(rng))]);
+			entity.AddComponent<MeshRendererComponent>(m_Materials[PickZipf(materialTable, unit(rng))]);
+
+			if (i < dynamicCount)
+			{
+				m_DynamicEntities.push_back((entt::entity)(uint32_t)entity);
+				m_DynamicBasePositions.push_back(transform.Translation);
+			}
+		}
+
+		Animate(0.0f);
+	}
+
+	void StressScene::Animate(float time)
+	{
+		entt::registry& registry = m_Scene->Reg();
+		for (size_t i = 0; i < m_DynamicEntities.size(); i++)
+		{
+			TransformComponent& transform = registry.get<TransformComponent>(m_DynamicEntities[i]);
+			float phase = time + (float)i * 0.37f;
+			transform.Translation = m_DynamicBasePositions[i] + glm::vec3(std::sin(phase), 0.0f, std::cos(phase)) * 4.0f;
+			transform.Rotation.y = phase * 57.2958f;
+			transform.MarkDirty();
+		}
+
+		// camera circles inside the scene, looking outwards, 60 degree fov
+		float angle = time * 0.25f;
+		glm::vec3 eye(std::cos(angle) * m_Desc.WorldExtent * 0.25f, 20.0f, std::sin(angle) * m_Desc.WorldExtent * 0.25f);
+		glm::vec3 target = eye + glm::vec3(-std::sin(angle), -0.05f, std::cos(angle));
+		glm::mat4 view = glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f));
+		glm::mat4 projection = glm::perspectiveZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, m_Desc.WorldExtent * 2.0f);
+		m_ViewProjection = projection * view;
+	}
+
+} }
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Runtime/Scene/Scene.h"
+#include "Runtime/Scene/Entity.h"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Hazel { namespace Bench {
+
+	struct StressSceneDesc
+	{
+		uint32_t EntityCount = 10000;
+		// distinct meshes / materials shared by all entities
+		uint32_t MeshCount = 16;
+		uint32_t MaterialCount = 64;
+		// Zipf exponent used to pick a mesh / material per entity: 0 = uniform,
+		// 1 = a handful of hot assets and a long tail, like a typical level
+		float DistributionSkew = 1.0f;
+		// share of entities whose transform changes every frame
+		float DynamicFraction = 0.1f;
+		// entities are spread over a cube of this half size around the origin
+		float WorldExtent = 500.0f;
+		uint32_t Seed = 1;
+	};
+
+	// A generated scene: Transform + MeshFilter + MeshRenderer entities that share a small set of
+	// synthetic meshes (bounds only, nothing is uploaded) and materials, plus a camera that orbits
+	// the origin so the visible set changes from frame to frame.
+	class StressScene
+	{
+	public:
+		StressScene(const StressSceneDesc& desc);
+
+		// moves the dynamic entities and the camera to the given time
+		void Animate(float time);
+
+		inline Scene* GetScene() { return m_Scene.get(); }
+		inline const glm::mat4& GetViewProjection() const { return m_ViewProjection; }
+		inline const StressSceneDesc& GetDesc() const { return m_Desc; }
+	private:
+		StressSceneDesc m_Desc;
+		Scope<Scene> m_Scene;
+		std::vector<Ref<Mesh>> m_Meshes;
+		std::vector<Ref<Material>> m_Materials;
+
+		std::vector<entt::entity> m_DynamicEntities;
+		std::vector<glm::vec3> m_DynamicBasePositions;
+		glm::mat4 m_ViewProjection = glm::mat4(1.0f);
+	};
+
+} }
@@ -18,6 +18,26 @@ else
     projectdir = "Project/Generated"
 end
 
+-- 静态分发：所有 RHI 调用在编译期绑定到一个后端，见 Engine/Runtime/Graphics/RHI/Core/RHIBackend.h
+newoption
+{
+	trigger = "rhi-static",
+	value = "BACKEND",
+	description = "Bind every RHI call to one backend at compile time",
+	allowed =
+	{
+		{ "native", "Platform backend: D3D12 on Windows, Null on Linux" },
+		{ "null", "Null backend, for measuring front end CPU cost (headless / HazelBench only)" }
+	}
+}
+
+-- Release / Dist 默认不替换全局 operator new/delete，见 Engine/Runtime/Core/Memory/MemoryTracker.h
+newoption
+{
+	trigger = "memory-tracking",
+	description = "Track allocations per memory tag in every configuration (default: Debug only)"
+}
+
 workspace "ShanEngine"
 	architecture "x64"
 	startproject "Editor"
@@ -30,6 +50,14 @@ workspace "ShanEngine"
 		"Dist"
 	}
 
+	filter "options:rhi-static=native"
+		defines { "HZ_RHI_STATIC_DISPATCH" }
+	filter "options:rhi-static=null"
+		defines { "HZ_RHI_STATIC_DISPATCH", "HZ_RHI_STATIC_NULL" }
+	filter "options:memory-tracking"
+		defines { "HZ_MEMORY_TRACKING=1" }
+	filter {}
+
 outputdir = "%{cfg.buildcfg}-%{cfg.system}-%{cfg.architecture}"
 
 
@@ -118,6 +146,24 @@ project "EngineCore"
 		}
 		buildoptions { "/source-charset:utf-8", "/execution-charset:utf-8" }
 
+	-- Linux only builds the headless runtime (benchmarks / CI perf runs):
+	-- no OS window, no GPU backend and no ImGui layer
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX"
+		}
+		removedefines { "RENDER_API_DIRECTX12" }
+		removefiles
+		{
+			"Engine/Platform/D3D12/**",
+			"Engine/Platform/Windows/**",
+			"Engine/Platform/OpenGL/**",
+			"Engine/ImGui/**"
+		}
+		removelinks { "GLFW", "Glad", "ImGui", "opengl32.lib" }
+		links { "pthread" }
+
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"
 		runtime "Debug"
@@ -207,4 +253,92 @@ project "Editor"
 	filter "configurations:Dist"
 		defines "HZ_DIST"
 		runtime "Release"
-		optimize "On"
\ No newline at end of file
+		optimize "On"
+
+project "HazelBench"
+	location (projectdir .. "/HazelBench")
+	kind "ConsoleApp"
+	language "C++"
+	cppdialect "C++17"
+	staticruntime "on"
+
+	targetdir (projectdir .. "/bin/" .. outputdir .. "/%{prj.name}")
+	objdir (projectdir .. "/bin-int/" .. outputdir .. "/%{prj.name}")
+
+	debugdir "%{cfg.targetdir}"
+
+	-- Mesh 加载的 benchmark 需要模型文件，和 Editor 一样复制到输出目录
+	postbuildcommands {
+		"{COPYDIR} \"%{wks.location}../../../Resource\" \"%{cfg.targetdir}/Resource\""
+	}
+
+	files
+	{
+		"HazelBench/**.h",
+		"HazelBench/**.cpp",
+		"Engine/**.h",
+		"Engine/**.cpp",
+		"ThirdParty/Runtime/Asset/stb_image/**.h",
+		"ThirdParty/Runtime/Asset/stb_image/**.cpp",
+	}
+
+	includedirs
+	{
+		"ThirdParty/Runtime/Core/spdlog/include",
+		"Engine/",
+		"HazelBench",
+		"%{IncludeDir.glm}",
+		"%{IncludeDir.assimp}",
+		"%{IncludeDir.GLFW}",
+		"%{IncludeDir.Glad}",
+		"%{IncludeDir.stb_image}",
+		"%{IncludeDir.ImGui}",
+		"%{IncludeDir.entt}",
+		"%{IncludeDir.boost}"
+	}
+
+	links
+	{
+		"EngineCore"
+	}
+
+	filter "system:windows"
+		systemversion "latest"
+
+		defines
+		{
+			"HZ_PLATFORM_WINDOWS",
+			"GLFW_INCLUDE_NONE",
+			"RENDER_API_DIRECTX12",
+			"NOMINMAX"
+		}
+
+	filter "system:linux"
+		defines
+		{
+			"HZ_PLATFORM_LINUX"
+		}
+		removefiles
+		{
+			"Engine/Platform/D3D12/**",
+			"Engine/Platform/Windows/**",
+			"Engine/Platform/OpenGL/**",
+			"Engine/ImGui/**"
+		}
+		links { "pthread" }
+
+	filter "configurations:Debug"
+		defines "HZ_DEBUG"
+		runtime "Debug"
+		staticruntime "on"
+		symbols "On"
+
+	filter "configurations:Release"
+		defines "HZ_RELEASE"
+		runtime "Release"
+		optimize "On"
+
+	filter "configurations:Dist"
+		defines "HZ_DIST"
+		runtime "Release"
+		optimize "On"